@@ -41,6 +41,12 @@ TableFunctionSet PixelsScanFunction::GetFunctionSet() {
     //table_function.filter_prune = true;
     enable_filter_pushdown = table_function.filter_pushdown;
     MultiFileReader::AddParameters(table_function);
+    // the nearest-neighbour predicate on a VECTOR column pushed down into the record readers
+    table_function.named_parameters["vector_column"] = LogicalType::VARCHAR;
+    table_function.named_parameters["vector_query"] = LogicalType::LIST(LogicalType::FLOAT);
+    table_function.named_parameters["vector_metric"] = LogicalType::VARCHAR;
+    table_function.named_parameters["vector_top_k"] = LogicalType::INTEGER;
+    table_function.named_parameters["vector_max_distance"] = LogicalType::FLOAT;
 	table_function.get_batch_index = PixelsScanGetBatchIndex;
 	table_function.cardinality = PixelsCardinality;
 	table_function.table_scan_progress = PixelsProgress;
@@ -89,8 +95,8 @@ void PixelsScanFunction::PixelsScanImplementation(ClientContext &context,
 
         TransformDuckdbChunk(data, output, resultSchema, thisOutputChunkRows);
 
-        // apply the filter operation
-        if (enable_filter_pushdown) {
+        // apply the filter operation, the filter mask is created if filters or the vector predicate are pushed down
+        if (filterMask != nullptr) {
             idx_t sel_size = 0;
             SelectionVector sel;
             sel.Initialize(thisOutputChunkRows);
@@ -160,6 +166,32 @@ unique_ptr<FunctionData> PixelsScanFunction::PixelsScanBind(
 	result->fileSchema = fileSchema;
 	result->files = files;
 
+	string vectorColumn;
+	std::vector<float> vectorQuery;
+	string vectorMetric = "l2";
+	int vectorTopK = 0;
+	float vectorMaxDistance = -1;
+	for (auto &kv : input.named_parameters) {
+		auto loption = StringUtil::Lower(kv.first);
+		if (loption == "vector_column") {
+			vectorColumn = StringValue::Get(kv.second);
+		} else if (loption == "vector_query") {
+			for (auto &element : ListValue::GetChildren(kv.second)) {
+				vectorQuery.emplace_back(element.GetValue<float>());
+			}
+		} else if (loption == "vector_metric") {
+			vectorMetric = StringValue::Get(kv.second);
+		} else if (loption == "vector_top_k") {
+			vectorTopK = IntegerValue::Get(kv.second);
+		} else if (loption == "vector_max_distance") {
+			vectorMaxDistance = FloatValue::Get(kv.second);
+		}
+	}
+	if (!vectorColumn.empty()) {
+		result->vectorPredicate = std::make_shared<VectorPredicate>(
+		        vectorColumn, vectorQuery, VectorDistance::parseMetric(vectorMetric), vectorTopK, vectorMaxDistance);
+	}
+
 	return std::move(result);
 }
 
@@ -187,6 +219,8 @@ unique_ptr<GlobalTableFunctionState> PixelsScanFunction::PixelsScanInitGlobal(
 
     result->filters = input.filters.get();
 
+    result->vectorPredicate = bind_data.vectorPredicate;
+
 	return std::move(result);
 }
 
@@ -225,51 +259,56 @@ void PixelsScanFunction::TransformDuckdbType(const std::shared_ptr<TypeDescripti
 	auto columnSchemas = type->getChildren();
 	for(auto columnType: columnSchemas) {
         std::cout<<"type = "<<columnType->getCategory()<<std::endl;
-		switch (columnType->getCategory()) {
-			//        case TypeDescription::BOOLEAN:
-			//            break;
-			//        case TypeDescription::BYTE:
-			//            break;
-			case TypeDescription::SHORT:
-			case TypeDescription::INT:
-				return_types.emplace_back(LogicalType::INTEGER);
-			    break;
-			case TypeDescription::LONG:
-				return_types.emplace_back(LogicalType::BIGINT);
-				break;
-			//        case TypeDescription::FLOAT:
-			//            break;
-			//        case TypeDescription::DOUBLE:
-			//            break;
-			case TypeDescription::DECIMAL:
-			    return_types.emplace_back(LogicalType::DECIMAL(columnType->getPrecision(), columnType->getScale()));
-			    break;
-			case TypeDescription::STRING:
-                return_types.emplace_back(LogicalType::VARCHAR);
-			    break;
-			case TypeDescription::DATE:
-			    return_types.emplace_back(LogicalType::DATE);
-			    break;
-			//        case TypeDescription::TIME:
-			//            break;
-            case TypeDescription::TIMESTAMP:
-                return_types.emplace_back(LogicalType::TIMESTAMP);
-                break;
-			//        case TypeDescription::VARBINARY:
-			//            break;
-			//        case TypeDescription::BINARY:
-			//            break;
-			case TypeDescription::VARCHAR:
-				return_types.emplace_back(LogicalType::VARCHAR);
-				break;
-			case TypeDescription::CHAR:
-				return_types.emplace_back(LogicalType::VARCHAR);
-				break;
-				//        case TypeDescription::STRUCT:
-				//            break;
-			default:
-				throw InvalidArgumentException("bad column type in TransformDuckdbType: " + std::to_string(type->getCategory()));
+		return_types.emplace_back(TransformDuckdbColumnType(columnType));
+	}
+}
+
+LogicalType PixelsScanFunction::TransformDuckdbColumnType(const std::shared_ptr<TypeDescription>& columnType) {
+	switch (columnType->getCategory()) {
+		case TypeDescription::BOOLEAN:
+			return LogicalType::BOOLEAN;
+		case TypeDescription::BYTE:
+			return LogicalType::TINYINT;
+		case TypeDescription::SHORT:
+		case TypeDescription::INT:
+			return LogicalType::INTEGER;
+		case TypeDescription::LONG:
+			return LogicalType::BIGINT;
+		case TypeDescription::FLOAT:
+			return LogicalType::FLOAT;
+		case TypeDescription::DOUBLE:
+			return LogicalType::DOUBLE;
+		case TypeDescription::DECIMAL:
+			return LogicalType::DECIMAL(columnType->getPrecision(), columnType->getScale());
+		case TypeDescription::STRING:
+			return LogicalType::VARCHAR;
+		case TypeDescription::DATE:
+			return LogicalType::DATE;
+		case TypeDescription::TIME:
+			return LogicalType::TIME;
+		case TypeDescription::TIMESTAMP:
+			return LogicalType::TIMESTAMP;
+		case TypeDescription::VARBINARY:
+		case TypeDescription::BINARY:
+			return LogicalType::BLOB;
+		case TypeDescription::VARCHAR:
+			return LogicalType::VARCHAR;
+		case TypeDescription::CHAR:
+			return LogicalType::VARCHAR;
+		case TypeDescription::VECTOR:
+			return LogicalType::ARRAY(LogicalType::FLOAT, columnType->getDimension());
+		case TypeDescription::STRUCT: {
+			child_list_t<LogicalType> children;
+			auto fieldNames = columnType->getFieldNames();
+			for(int i = 0; i < fieldNames.size(); i++) {
+				children.emplace_back(fieldNames.at(i), TransformDuckdbColumnType(columnType->getChildren().at(i)));
+			}
+			return LogicalType::STRUCT(std::move(children));
 		}
+		case TypeDescription::ARRAY:
+			return LogicalType::LIST(TransformDuckdbColumnType(columnType->getChildren().at(0)));
+		default:
+			throw InvalidArgumentException("bad column type in TransformDuckdbType: " + std::to_string(columnType->getCategory()));
 	}
 }
 
@@ -286,104 +325,194 @@ void PixelsScanFunction::TransformDuckdbChunk(PixelsReadLocalState & data,
 			    output.data.at(col_id).Reference(constant_42);
 			    continue;
 		}
-		auto col = vectorizedRowBatch->cols.at(row_batch_id);
-		auto colSchema = schema->getChildren().at(row_batch_id);
-		switch (colSchema->getCategory()) {
-				//        case TypeDescription::BOOLEAN:
-				//            break;
-				//        case TypeDescription::BYTE:
-				//            break;
-			case TypeDescription::SHORT:
-			case TypeDescription::INT: {
-			    auto intCol = std::static_pointer_cast<LongColumnVector>(col);
-                Vector vector(LogicalType::INTEGER,
-                              (data_ptr_t)(intCol->current()), col->currentValid());
-                output.data.at(col_id).Reference(vector);
-//			    auto result_ptr = FlatVector::GetData<int>(output.data.at(col_id));
+		TransformDuckdbVector(vectorizedRowBatch->cols.at(row_batch_id), schema->getChildren().at(row_batch_id),
+		                      output.data.at(col_id), thisOutputChunkRows);
+		row_batch_id++;
+	}
+    vectorizedRowBatch->increment(thisOutputChunkRows);
+}
+
+void PixelsScanFunction::TransformDuckdbVector(const std::shared_ptr<ColumnVector> & col,
+                                               const std::shared_ptr<TypeDescription> & colSchema,
+                                               Vector & result, uint64_t rows) {
+	// the validity mask is referenced by 64-bit words, so it is copied if the rows do not start at a word,
+	// which happens for the elements of lists
+	bool alignedValid = col->noNulls || col->readIndex % 64 == 0;
+	uint64_t * valid = alignedValid ? col->currentValid() : nullptr;
+	switch (colSchema->getCategory()) {
+		case TypeDescription::BOOLEAN:
+		case TypeDescription::BYTE: {
+			// booleans are 0 or 1 in one byte, as DuckDB stores them
+			auto byteCol = std::static_pointer_cast<ByteColumnVector>(col);
+			Vector vector(colSchema->getCategory() == TypeDescription::BOOLEAN ? LogicalType::BOOLEAN : LogicalType::TINYINT,
+			              (data_ptr_t)(byteCol->current()), valid);
+			result.Reference(vector);
+			break;
+		}
+		case TypeDescription::SHORT:
+		case TypeDescription::INT: {
+		    auto intCol = std::static_pointer_cast<LongColumnVector>(col);
+            Vector vector(LogicalType::INTEGER,
+                          (data_ptr_t)(intCol->current()), valid);
+            result.Reference(vector);
+//			    auto result_ptr = FlatVector::GetData<int>(result);
 //			    memcpy(result_ptr, intCol->intVector + row_offset, thisOutputChunkRows * sizeof(int));
 //			    for(long i = 0; i < thisOutputChunkRows; i++) {
 //				    result_ptr[i] = intCol->intVector[i + row_offset];
 //			    }
 
-			    break;
-		    }
-			case TypeDescription::LONG: {
-				auto longCol = std::static_pointer_cast<LongColumnVector>(col);
-                Vector vector(LogicalType::BIGINT,
-                              (data_ptr_t)(longCol->current()), col->currentValid());
-                output.data.at(col_id).Reference(vector);
-//			    auto result_ptr = FlatVector::GetData<long>(output.data.at(col_id));
+		    break;
+	    }
+		case TypeDescription::LONG: {
+			auto longCol = std::static_pointer_cast<LongColumnVector>(col);
+            Vector vector(LogicalType::BIGINT,
+                          (data_ptr_t)(longCol->current()), valid);
+            result.Reference(vector);
+//			    auto result_ptr = FlatVector::GetData<long>(result);
 //			    memcpy(result_ptr, longCol->longVector + row_offset, thisOutputChunkRows * sizeof(long));
 //			    for(long i = 0; i < thisOutputChunkRows; i++) {
 //				    result_ptr[i] = longCol->longVector[i + row_offset];
 //			    }
-				break;
-			}
-			//        case TypeDescription::FLOAT:
-			//            break;
-			//        case TypeDescription::DOUBLE:
-			//            break;
-		    case TypeDescription::DECIMAL: {
-			    auto decimalCol = std::static_pointer_cast<DecimalColumnVector>(col);
-                Vector vector(LogicalType::DECIMAL(colSchema->getPrecision(), colSchema->getScale()),
-                              (data_ptr_t)(decimalCol->current()), col->currentValid());
-                output.data.at(col_id).Reference(vector);
-//			    auto result_ptr = FlatVector::GetData<long>(output.data.at(col_id));
+			break;
+		}
+		case TypeDescription::FLOAT:
+		case TypeDescription::DOUBLE: {
+			auto doubleCol = std::static_pointer_cast<DoubleColumnVector>(col);
+			Vector vector(doubleCol->isDoubleVector() ? LogicalType::DOUBLE : LogicalType::FLOAT,
+			              (data_ptr_t)(doubleCol->current()), valid);
+			result.Reference(vector);
+			break;
+		}
+	    case TypeDescription::DECIMAL: {
+		    if (colSchema->getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
+			    // the values of long decimals are laid out as hugeint_t
+			    auto longDecimalCol = std::static_pointer_cast<LongDecimalColumnVector>(col);
+			    Vector vector(LogicalType::DECIMAL(colSchema->getPrecision(), colSchema->getScale()),
+			                  (data_ptr_t)(longDecimalCol->current()), valid);
+			    result.Reference(vector);
+			    break;
+		    }
+		    auto decimalCol = std::static_pointer_cast<DecimalColumnVector>(col);
+            Vector vector(LogicalType::DECIMAL(colSchema->getPrecision(), colSchema->getScale()),
+                          (data_ptr_t)(decimalCol->current()), valid);
+            result.Reference(vector);
+//			    auto result_ptr = FlatVector::GetData<long>(result);
 //			    memcpy(result_ptr, decimalCol->vector + row_offset, thisOutputChunkRows * sizeof(long));
 //			    for(long i = 0; i < thisOutputChunkRows; i++) {
 //				    result_ptr[i] = decimalCol->vector[i + row_offset];
 //			    }
-			    break;
-		    }
-
-			//        case TypeDescription::STRING:
-			//            break;
-			case TypeDescription::DATE:{
-			    auto dateCol = std::static_pointer_cast<DateColumnVector>(col);
-                Vector vector(LogicalType::DATE,
-                              (data_ptr_t)(dateCol->current()), col->currentValid());
-                output.data.at(col_id).Reference(vector);
-//			    auto result_ptr = FlatVector::GetData<int>(output.data.at(col_id));
+		    break;
+	    }
+
+		//        case TypeDescription::STRING:
+		//            break;
+		case TypeDescription::DATE:{
+		    auto dateCol = std::static_pointer_cast<DateColumnVector>(col);
+            Vector vector(LogicalType::DATE,
+                          (data_ptr_t)(dateCol->current()), valid);
+            result.Reference(vector);
+//			    auto result_ptr = FlatVector::GetData<int>(result);
 //			    memcpy(result_ptr, dateCol->dates + row_offset, thisOutputChunkRows * sizeof(int));
 //			    for(long i = 0; i < thisOutputChunkRows; i++) {
 //				    result_ptr[i] = dateCol->dates[i + row_offset];
 //			    }
-			    break;
-		    }
-
-			//        case TypeDescription::TIME:
-			//            break;
-            case TypeDescription::TIMESTAMP: {
-                auto tsCol = std::static_pointer_cast<TimestampColumnVector>(col);
-                Vector vector(LogicalType::TIMESTAMP,
-                              (data_ptr_t)(tsCol->current()), col->currentValid());
-                output.data.at(col_id).Reference(vector);
-                break;
-            }
+		    break;
+	    }
+
+		case TypeDescription::TIME: {
+			// the times are in milliseconds, whereas DuckDB stores times in microseconds
+			auto timeCol = std::static_pointer_cast<TimeColumnVector>(col);
+			auto result_ptr = FlatVector::GetData<dtime_t>(result);
+			auto times = (int *)(timeCol->current());
+			for(uint64_t i = 0; i < rows; i++) {
+				result_ptr[i] = dtime_t((int64_t)times[i] * Interval::MICROS_PER_MSEC);
+			}
+			if (valid != nullptr) {
+				FlatVector::SetValidity(result, ValidityMask(valid));
+			}
+			break;
+		}
+        case TypeDescription::TIMESTAMP: {
+            auto tsCol = std::static_pointer_cast<TimestampColumnVector>(col);
+            Vector vector(LogicalType::TIMESTAMP,
+                          (data_ptr_t)(tsCol->current()), valid);
+            result.Reference(vector);
+            break;
+        }
 
-			//        case TypeDescription::VARBINARY:
-			//            break;
-			//        case TypeDescription::BINARY:
-			//            break;
-			case TypeDescription::VARCHAR:
-			case TypeDescription::CHAR:
-		    {
-			    auto binaryCol = std::static_pointer_cast<BinaryColumnVector>(col);
-                Vector vector(LogicalType::VARCHAR,
-                              (data_ptr_t)(binaryCol->current()), col->currentValid());
-                output.data.at(col_id).Reference(vector);
-//			    auto result_ptr = FlatVector::GetData<duckdb::string_t>(output.data.at(col_id));
+		case TypeDescription::VARBINARY:
+		case TypeDescription::BINARY: {
+			// the blobs reference the column chunk buffer as the strings do
+			auto binaryCol = std::static_pointer_cast<BinaryColumnVector>(col);
+			Vector vector(LogicalType::BLOB,
+			              (data_ptr_t)(binaryCol->current()), valid);
+			result.Reference(vector);
+			break;
+		}
+		case TypeDescription::STRING:
+		case TypeDescription::VARCHAR:
+		case TypeDescription::CHAR:
+	    {
+		    auto binaryCol = std::static_pointer_cast<BinaryColumnVector>(col);
+            Vector vector(LogicalType::VARCHAR,
+                          (data_ptr_t)(binaryCol->current()), valid);
+            result.Reference(vector);
+//			    auto result_ptr = FlatVector::GetData<duckdb::string_t>(result);
 //                memcpy(result_ptr, binaryCol->vector + row_offset, thisOutputChunkRows * sizeof(string_t));
-			    break;
-		    }
-			//        case TypeDescription::STRUCT:
-			//            break;
+		    break;
+	    }
+		case TypeDescription::VECTOR: {
+			// the elements are contiguous as the child vector of a FLOAT[dimension] array, so they are referenced
+			auto vectorCol = std::static_pointer_cast<VectorColumnVector>(col);
+			Vector elements(LogicalType::FLOAT, (data_ptr_t)(vectorCol->current()));
+			ArrayVector::GetEntry(result).Reference(elements);
+			if (valid != nullptr) {
+				FlatVector::SetValidity(result, ValidityMask(valid));
+			}
+			break;
+		}
+		case TypeDescription::STRUCT: {
+			// the fields are read at the same rows as the struct
+			auto structCol = std::static_pointer_cast<StructColumnVector>(col);
+			auto &entries = StructVector::GetEntries(result);
+			for(int i = 0; i < structCol->fields.size(); i++) {
+				structCol->fields.at(i)->readIndex = col->readIndex;
+				TransformDuckdbVector(structCol->fields.at(i), colSchema->getChildren().at(i), *entries.at(i), rows);
+			}
+			if (valid != nullptr) {
+				FlatVector::SetValidity(result, ValidityMask(valid));
+			}
+			break;
+		}
+		case TypeDescription::ARRAY: {
+			// the list entries are rebased to the first element of the rows, which is put at 0 of the child vector
+			auto listCol = std::static_pointer_cast<ListColumnVector>(col);
+			auto listEntries = listCol->entries + col->readIndex;
+			uint64_t base = rows == 0 ? 0 : listEntries[0].offset;
+			uint64_t total = rows == 0 ? 0 : listEntries[rows - 1].offset + listEntries[rows - 1].length - base;
+			auto result_ptr = FlatVector::GetData<list_entry_t>(result);
+			for(uint64_t i = 0; i < rows; i++) {
+				result_ptr[i] = list_entry_t(listEntries[i].offset - base, listEntries[i].length);
+			}
+			if (valid != nullptr) {
+				FlatVector::SetValidity(result, ValidityMask(valid));
+			}
+			ListVector::Reserve(result, total);
+			listCol->child->readIndex = base;
+			TransformDuckdbVector(listCol->child, colSchema->getChildren().at(0), ListVector::GetEntry(result), total);
+			ListVector::SetListSize(result, total);
+			break;
+		}
 //			default:
 //				throw InvalidArgumentException("bad column type " + std::to_string(colSchema->getCategory()));
+	}
+	if (!alignedValid) {
+		for(uint64_t i = 0; i < rows; i++) {
+			if (!col->checkValid(col->readIndex + i)) {
+				FlatVector::SetNull(result, i, true);
+			}
 		}
-		row_batch_id++;
 	}
-    vectorizedRowBatch->increment(thisOutputChunkRows);
 }
 
 bool PixelsScanFunction::PixelsParallelStateNext(ClientContext &context, const PixelsReadBindData &bind_data,
@@ -473,6 +602,7 @@ PixelsReaderOption PixelsScanFunction::GetPixelsReaderOption(PixelsReadLocalStat
     option.setQueryId(1);
     int stride = std::stoi(ConfigFactory::Instance().getProperty("pixel.stride"));
     option.setBatchSize(stride);
+    option.setVectorPredicate(global_state.vectorPredicate);
     return option;
 }
 }
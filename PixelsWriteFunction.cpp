@@ -0,0 +1,376 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "PixelsWriteFunction.hpp"
+#include "PixelsWriterImpl.h"
+#include "utils/ConfigFactory.h"
+#include "exception/InvalidArgumentException.h"
+#include "vector/ByteColumnVector.h"
+#include "vector/LongColumnVector.h"
+#include "vector/DoubleColumnVector.h"
+#include "vector/DecimalColumnVector.h"
+#include "vector/LongDecimalColumnVector.h"
+#include "vector/DateColumnVector.h"
+#include "vector/TimeColumnVector.h"
+#include "vector/TimestampColumnVector.h"
+#include "vector/BinaryColumnVector.h"
+#include "vector/VectorColumnVector.h"
+#include "vector/StructColumnVector.h"
+#include "vector/ListColumnVector.h"
+#include <climits>
+#include <cstring>
+
+namespace duckdb {
+
+CopyFunction PixelsWriteFunction::GetFunction() {
+	CopyFunction function("pixels");
+	function.copy_to_bind = PixelsWriteBind;
+	function.copy_to_initialize_global = PixelsWriteInitGlobal;
+	function.copy_to_initialize_local = PixelsWriteInitLocal;
+	function.copy_to_sink = PixelsWriteSink;
+	function.copy_to_combine = PixelsWriteCombine;
+	function.copy_to_finalize = PixelsWriteFinalize;
+	// without execution_mode, the sinks of a file run on one thread. The writer encodes the columns of each
+	// row batch on its own thread pool, and PER_THREAD_OUTPUT runs the sinks of the files in parallel
+	function.extension = "pxl";
+	return function;
+}
+
+unique_ptr<FunctionData> PixelsWriteFunction::PixelsWriteBind(ClientContext &context, CopyFunctionBindInput &input,
+                                                             const vector<string> &names,
+                                                             const vector<LogicalType> &sql_types) {
+	auto bind_data = make_uniq<PixelsWriteBindData>();
+	bind_data->fileSchema = TypeDescription::createStruct();
+	for (idx_t i = 0; i < names.size(); i++) {
+		bind_data->fileSchema->addField(names[i], TransformPixelsType(sql_types[i]));
+	}
+	bind_data->sql_types = sql_types;
+	bind_data->pixelStride = std::stoi(ConfigFactory::Instance().getProperty("pixel.stride"));
+	bind_data->rowGroupSize = std::stoi(ConfigFactory::Instance().getProperty("row.group.size"));
+	// the block size only matters to the storage with blocks, e.g., hdfs
+	bind_data->blockSize = (int) std::min<int64_t>(std::stoll(ConfigFactory::Instance().getProperty("block.size")), INT_MAX);
+	bind_data->compressionBlockSize = std::stoi(ConfigFactory::Instance().getProperty("column.chunk.compression.block.size"));
+	bind_data->encodingLevel = EncodingLevel(EncodingLevel::EL2);
+	for (auto &option : input.info.options) {
+		auto loption = StringUtil::Lower(option.first);
+		if (option.second.size() != 1) {
+			throw BinderException("Pixels option %s requires exactly one value", option.first);
+		}
+		auto value = option.second[0].GetValue<int64_t>();
+		if (loption == "row_group_size") {
+			// the row group is cut when its encoded size reaches row_group_size bytes
+			if (value <= 0 || value > INT_MAX) {
+				throw BinderException("ROW_GROUP_SIZE must be a positive number of bytes");
+			}
+			bind_data->rowGroupSize = (int) value;
+		} else if (loption == "pixel_stride") {
+			if (value <= 0 || value > INT_MAX) {
+				throw BinderException("PIXEL_STRIDE must be a positive number of rows");
+			}
+			bind_data->pixelStride = (int) value;
+		} else if (loption == "encoding_level") {
+			if (!EncodingLevel::isValid((int) value)) {
+				throw BinderException("ENCODING_LEVEL must be 0, 1 or 2");
+			}
+			bind_data->encodingLevel = EncodingLevel::from((int) value);
+		} else {
+			throw NotImplementedException("Unrecognized option for Pixels: %s", option.first);
+		}
+	}
+	return std::move(bind_data);
+}
+
+unique_ptr<GlobalFunctionData> PixelsWriteFunction::PixelsWriteInitGlobal(ClientContext &context,
+                                                                         FunctionData &bind_data_p,
+                                                                         const string &file_path) {
+	auto &bind_data = (PixelsWriteBindData &)bind_data_p;
+	auto global_state = make_uniq<PixelsWriteGlobalState>();
+	global_state->writer = std::make_shared<PixelsWriterImpl>(bind_data.fileSchema, bind_data.pixelStride,
+	                                                          bind_data.rowGroupSize, file_path, bind_data.blockSize,
+	                                                          true, bind_data.encodingLevel, false, false,
+	                                                          bind_data.compressionBlockSize);
+	return std::move(global_state);
+}
+
+unique_ptr<LocalFunctionData> PixelsWriteFunction::PixelsWriteInitLocal(ExecutionContext &context,
+                                                                       FunctionData &bind_data_p) {
+	auto &bind_data = (PixelsWriteBindData &)bind_data_p;
+	auto local_state = make_uniq<PixelsWriteLocalState>();
+	local_state->rowBatch = bind_data.fileSchema->createRowBatch(STANDARD_VECTOR_SIZE);
+	return std::move(local_state);
+}
+
+void PixelsWriteFunction::PixelsWriteSink(ExecutionContext &context, FunctionData &bind_data_p,
+                                          GlobalFunctionData &gstate_p, LocalFunctionData &lstate_p,
+                                          DataChunk &input) {
+	auto &bind_data = (PixelsWriteBindData &)bind_data_p;
+	auto &global_state = (PixelsWriteGlobalState &)gstate_p;
+	auto &local_state = (PixelsWriteLocalState &)lstate_p;
+	if (input.size() == 0) {
+		return;
+	}
+	auto rowBatch = local_state.rowBatch;
+	input.Flatten();
+	for (idx_t col_id = 0; col_id < input.ColumnCount(); col_id++) {
+		TransformPixelsVector(local_state, input.data[col_id], bind_data.fileSchema->getChildren().at(col_id),
+		                      rowBatch->cols.at(col_id), input.size(), nullptr);
+	}
+	rowBatch->rowCount = (int) input.size();
+	// the row batch is encoded or copied before addRowBatch returns, so the referenced vectors
+	// of the chunk are only needed until then
+	global_state.writer->addRowBatch(rowBatch);
+	// point the column vectors back to their own memory
+	rowBatch->reset();
+	local_state.listElements.clear();
+}
+
+void PixelsWriteFunction::PixelsWriteCombine(ExecutionContext &context, FunctionData &bind_data,
+                                             GlobalFunctionData &gstate, LocalFunctionData &lstate) {
+	// the row batches are added to the writer in the sink, nothing is buffered in the local state
+}
+
+void PixelsWriteFunction::PixelsWriteFinalize(ClientContext &context, FunctionData &bind_data,
+                                              GlobalFunctionData &gstate_p) {
+	auto &global_state = (PixelsWriteGlobalState &)gstate_p;
+	global_state.writer->close();
+}
+
+std::shared_ptr<TypeDescription> PixelsWriteFunction::TransformPixelsType(const LogicalType &type) {
+	switch (type.id()) {
+		case LogicalTypeId::BOOLEAN:
+			return TypeDescription::createBoolean();
+		case LogicalTypeId::TINYINT:
+			return TypeDescription::createByte();
+		case LogicalTypeId::SMALLINT:
+			return TypeDescription::createShort();
+		case LogicalTypeId::INTEGER:
+			return TypeDescription::createInt();
+		case LogicalTypeId::BIGINT:
+			return TypeDescription::createLong();
+		case LogicalTypeId::FLOAT:
+			return TypeDescription::createFloat();
+		case LogicalTypeId::DOUBLE:
+			return TypeDescription::createDouble();
+		case LogicalTypeId::DECIMAL:
+			return TypeDescription::createDecimal(DecimalType::GetWidth(type), DecimalType::GetScale(type));
+		case LogicalTypeId::VARCHAR:
+			return TypeDescription::createString();
+		case LogicalTypeId::BLOB:
+			return TypeDescription::createVarbinary();
+		case LogicalTypeId::DATE:
+			return TypeDescription::createDate();
+		case LogicalTypeId::TIME:
+			return TypeDescription::createTime();
+		case LogicalTypeId::TIMESTAMP:
+			return TypeDescription::createTimestamp();
+		case LogicalTypeId::ARRAY:
+			// only the arrays of floats are stored as vectors
+			if (ArrayType::GetChildType(type).id() != LogicalTypeId::FLOAT) {
+				throw InvalidArgumentException("Pixels writer only supports FLOAT arrays, but got " + type.ToString());
+			}
+			return TypeDescription::createVector(ArrayType::GetSize(type));
+		case LogicalTypeId::STRUCT: {
+			auto structType = TypeDescription::createStruct();
+			for (auto &child : StructType::GetChildTypes(type)) {
+				structType->addField(child.first, TransformPixelsType(child.second));
+			}
+			return structType;
+		}
+		case LogicalTypeId::LIST:
+			return TypeDescription::createArray(TransformPixelsType(ListType::GetChildType(type)));
+		default:
+			throw InvalidArgumentException("Pixels writer does not support the type " + type.ToString());
+	}
+}
+
+void PixelsWriteFunction::TransformPixelsVector(PixelsWriteLocalState &data, Vector &vector,
+                                                const std::shared_ptr<TypeDescription> &colSchema,
+                                                const std::shared_ptr<ColumnVector> &col, idx_t rows,
+                                                const uint8_t *parentIsNull) {
+	auto &validity = FlatVector::Validity(vector);
+	if (validity.AllValid() && parentIsNull == nullptr) {
+		memset(col->isNull, 0, rows);
+		col->noNulls = true;
+	} else {
+		bool noNulls = true;
+		for (idx_t i = 0; i < rows; i++) {
+			col->isNull[i] = !validity.RowIsValid(i) || (parentIsNull != nullptr && parentIsNull[i]);
+			noNulls = noNulls && !col->isNull[i];
+		}
+		col->noNulls = noNulls;
+	}
+	switch (colSchema->getCategory()) {
+		case TypeDescription::BOOLEAN:
+		case TypeDescription::BYTE: {
+			// booleans are 0 or 1 in one byte, as in the byte column vector
+			auto byteCol = std::static_pointer_cast<ByteColumnVector>(col);
+			byteCol->vector = FlatVector::GetData<uint8_t>(vector);
+			break;
+		}
+		case TypeDescription::SHORT: {
+			// shorts are widened to the 32-bit values of the int columns
+			auto intCol = std::static_pointer_cast<LongColumnVector>(col);
+			auto values = FlatVector::GetData<int16_t>(vector);
+			for (idx_t i = 0; i < rows; i++) {
+				intCol->intVector[i] = values[i];
+			}
+			break;
+		}
+		case TypeDescription::INT: {
+			auto intCol = std::static_pointer_cast<LongColumnVector>(col);
+			intCol->intVector = FlatVector::GetData<int32_t>(vector);
+			break;
+		}
+		case TypeDescription::LONG: {
+			auto longCol = std::static_pointer_cast<LongColumnVector>(col);
+			longCol->longVector = (long *)FlatVector::GetData<int64_t>(vector);
+			break;
+		}
+		case TypeDescription::FLOAT:
+		case TypeDescription::DOUBLE: {
+			auto doubleCol = std::static_pointer_cast<DoubleColumnVector>(col);
+			doubleCol->setValues(FlatVector::GetData(vector));
+			break;
+		}
+		case TypeDescription::DECIMAL: {
+			if (colSchema->getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
+				// the values of long decimals are laid out as hugeint_t
+				auto longDecimalCol = std::static_pointer_cast<LongDecimalColumnVector>(col);
+				longDecimalCol->vector = (uint64_t *)FlatVector::GetData<hugeint_t>(vector);
+				break;
+			}
+			// DuckDB stores the decimals of small precisions in 16 or 32 bits, they are widened to 64 bits
+			auto decimalCol = std::static_pointer_cast<DecimalColumnVector>(col);
+			switch (vector.GetType().InternalType()) {
+				case PhysicalType::INT64:
+					decimalCol->vector = (long *)FlatVector::GetData<int64_t>(vector);
+					break;
+				case PhysicalType::INT32: {
+					auto values = FlatVector::GetData<int32_t>(vector);
+					for (idx_t i = 0; i < rows; i++) {
+						decimalCol->vector[i] = values[i];
+					}
+					break;
+				}
+				case PhysicalType::INT16: {
+					auto values = FlatVector::GetData<int16_t>(vector);
+					for (idx_t i = 0; i < rows; i++) {
+						decimalCol->vector[i] = values[i];
+					}
+					break;
+				}
+				default:
+					throw InvalidArgumentException("bad physical type of decimal " + vector.GetType().ToString());
+			}
+			break;
+		}
+		case TypeDescription::DATE: {
+			auto dateCol = std::static_pointer_cast<DateColumnVector>(col);
+			dateCol->dates = FlatVector::GetData<int32_t>(vector);
+			break;
+		}
+		case TypeDescription::TIME: {
+			// DuckDB stores times in microseconds, whereas the times are in milliseconds
+			auto timeCol = std::static_pointer_cast<TimeColumnVector>(col);
+			auto values = FlatVector::GetData<dtime_t>(vector);
+			for (idx_t i = 0; i < rows; i++) {
+				timeCol->times[i] = (int)(values[i].micros / Interval::MICROS_PER_MSEC);
+			}
+			break;
+		}
+		case TypeDescription::TIMESTAMP: {
+			auto tsCol = std::static_pointer_cast<TimestampColumnVector>(col);
+			tsCol->times = (long *)FlatVector::GetData<int64_t>(vector);
+			break;
+		}
+		case TypeDescription::STRING:
+		case TypeDescription::VARCHAR:
+		case TypeDescription::CHAR:
+		case TypeDescription::BINARY:
+		case TypeDescription::VARBINARY: {
+			// the string headers are copied, the strings stay in the memory of the chunk
+			auto binaryCol = std::static_pointer_cast<BinaryColumnVector>(col);
+			auto values = FlatVector::GetData<string_t>(vector);
+			memcpy(binaryCol->vector, values, rows * sizeof(string_t));
+			for (idx_t i = 0; i < rows; i++) {
+				binaryCol->start[i] = 0;
+				binaryCol->lens[i] = col->isNull[i] ? 0 : values[i].GetSize();
+			}
+			break;
+		}
+		case TypeDescription::VECTOR: {
+			// the elements of a FLOAT[dimension] array are contiguous in its child vector
+			auto vectorCol = std::static_pointer_cast<VectorColumnVector>(col);
+			auto &elements = ArrayVector::GetEntry(vector);
+			elements.Flatten(rows * colSchema->getDimension());
+			vectorCol->vector = FlatVector::GetData<float>(elements);
+			break;
+		}
+		case TypeDescription::STRUCT: {
+			// the fields of a null struct value must be null, which DuckDB does not guarantee
+			auto structCol = std::static_pointer_cast<StructColumnVector>(col);
+			auto &entries = StructVector::GetEntries(vector);
+			for (idx_t i = 0; i < entries.size(); i++) {
+				entries[i]->Flatten(rows);
+				TransformPixelsVector(data, *entries[i], colSchema->getChildren().at(i), structCol->fields.at(i), rows,
+				                      col->noNulls ? nullptr : col->isNull);
+			}
+			break;
+		}
+		case TypeDescription::ARRAY: {
+			// the elements of the rows are gathered to the beginning of the child vector in row order,
+			// as the array column writer requires
+			auto listCol = std::static_pointer_cast<ListColumnVector>(col);
+			auto listEntries = FlatVector::GetData<list_entry_t>(vector);
+			idx_t total = 0;
+			for (idx_t i = 0; i < rows; i++) {
+				if (!col->isNull[i]) {
+					total += listEntries[i].length;
+				}
+			}
+			SelectionVector sel(total);
+			idx_t offset = 0;
+			for (idx_t i = 0; i < rows; i++) {
+				listCol->entries[i].offset = offset;
+				listCol->entries[i].length = col->isNull[i] ? 0 : listEntries[i].length;
+				for (idx_t j = 0; j < listCol->entries[i].length; j++) {
+					sel.set_index(offset++, listEntries[i].offset + j);
+				}
+			}
+			auto elements = make_uniq<Vector>(ListVector::GetEntry(vector), sel, total);
+			elements->Flatten(total);
+			auto childSchema = colSchema->getChildren().at(0);
+			if (listCol->child->length < total) {
+				// the child vector is replaced by a larger one if the elements do not fit
+				listCol->child = childSchema->createColumn(total, false);
+			}
+			TransformPixelsVector(data, *elements, childSchema, listCol->child, total, nullptr);
+			listCol->childCount = total;
+			data.listElements.push_back(std::move(elements));
+			break;
+		}
+		default:
+			throw InvalidArgumentException("bad column type in TransformPixelsVector: " +
+			                               std::to_string(colSchema->getCategory()));
+	}
+}
+
+} // namespace duckdb
@@ -20,6 +20,8 @@ struct PixelsReadBindData : public TableFunctionData {
 	std::shared_ptr<PixelsReader> initialPixelsReader;
 	std::shared_ptr<TypeDescription> fileSchema;
 	vector<string> files;
+	//! The vector predicate given by the named parameters, or nullptr
+	std::shared_ptr<VectorPredicate> vectorPredicate;
 	atomic<idx_t> curFileId;
 };
 
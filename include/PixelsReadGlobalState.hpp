@@ -38,6 +38,8 @@ struct PixelsReadGlobalState : public GlobalTableFunctionState {
 	idx_t max_threads;
 
     TableFilterSet * filters;
+    //! The prototype of the vector predicate, each record reader evaluates a copy of it
+    std::shared_ptr<VectorPredicate> vectorPredicate;
 
 	idx_t MaxThreads() const override {
 		return max_threads;
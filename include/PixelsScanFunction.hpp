@@ -92,6 +92,14 @@ private:
 	                            DataChunk &output,
 	                            const std::shared_ptr<TypeDescription> & schema,
 	                            unsigned long thisOutputChunkRows);
+	static LogicalType TransformDuckdbColumnType(const std::shared_ptr<TypeDescription>& columnType);
+	/**
+	 * Put the rows of a column vector from its read index into a DuckDB vector,
+	 * the nested columns are put into the child vectors recursively.
+	 */
+	static void TransformDuckdbVector(const std::shared_ptr<ColumnVector> & col,
+	                                  const std::shared_ptr<TypeDescription> & colSchema,
+	                                  Vector & result, uint64_t rows);
     static bool enable_filter_pushdown;
 };
 
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef EXAMPLE_C_PIXELSWRITEBINDDATA_HPP
+#define EXAMPLE_C_PIXELSWRITEBINDDATA_HPP
+
+#include "duckdb.hpp"
+#include "TypeDescription.h"
+#include "encoding/EncodingLevel.h"
+
+namespace duckdb {
+
+struct PixelsWriteBindData : public TableFunctionData {
+	//! The schema of the written files, converted from the types of the copied columns
+	std::shared_ptr<TypeDescription> fileSchema;
+	vector<LogicalType> sql_types;
+	//! The writer options given by the COPY options, or the defaults in pixels-cxx.properties
+	int pixelStride;
+	int rowGroupSize;
+	int blockSize;
+	int compressionBlockSize;
+	EncodingLevel encodingLevel;
+};
+
+} // namespace duckdb
+
+#endif // EXAMPLE_C_PIXELSWRITEBINDDATA_HPP
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef EXAMPLE_C_PIXELSWRITEFUNCTION_HPP
+#define EXAMPLE_C_PIXELSWRITEFUNCTION_HPP
+
+#include "duckdb.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "duckdb/parser/parsed_data/copy_info.hpp"
+#include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
+#include "PixelsWriteBindData.hpp"
+#include "PixelsWriteGlobalState.hpp"
+#include "PixelsWriteLocalState.hpp"
+#include "TypeDescription.h"
+#include "vector/ColumnVector.h"
+
+namespace duckdb {
+
+/**
+ * COPY ... TO ... (FORMAT pixels) converts the sunk data chunks into row batches of the Pixels writer.
+ * The fixed-width vectors are handed over without copying, the strings are referenced.
+ */
+class PixelsWriteFunction {
+public:
+	static CopyFunction GetFunction();
+	static unique_ptr<FunctionData> PixelsWriteBind(ClientContext &context, CopyFunctionBindInput &input,
+	                                                const vector<string> &names, const vector<LogicalType> &sql_types);
+	static unique_ptr<GlobalFunctionData> PixelsWriteInitGlobal(ClientContext &context, FunctionData &bind_data,
+	                                                            const string &file_path);
+	static unique_ptr<LocalFunctionData> PixelsWriteInitLocal(ExecutionContext &context, FunctionData &bind_data);
+	static void PixelsWriteSink(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+	                            LocalFunctionData &lstate, DataChunk &input);
+	static void PixelsWriteCombine(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+	                               LocalFunctionData &lstate);
+	static void PixelsWriteFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate);
+private:
+	static std::shared_ptr<TypeDescription> TransformPixelsType(const LogicalType &type);
+	/**
+	 * Put the rows of a flat DuckDB vector into a column vector of the row batch, the nested vectors
+	 * are put into the child column vectors recursively. The rows null in parentIsNull are also null
+	 * in the column vector, it is nullptr if the parent has no null.
+	 */
+	static void TransformPixelsVector(PixelsWriteLocalState &data, Vector &vector,
+	                                  const std::shared_ptr<TypeDescription> &colSchema,
+	                                  const std::shared_ptr<ColumnVector> &col, idx_t rows,
+	                                  const uint8_t *parentIsNull);
+};
+
+} // namespace duckdb
+
+#endif // EXAMPLE_C_PIXELSWRITEFUNCTION_HPP
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef EXAMPLE_C_PIXELSWRITEGLOBALSTATE_HPP
+#define EXAMPLE_C_PIXELSWRITEGLOBALSTATE_HPP
+
+#include "duckdb.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "PixelsWriter.h"
+
+namespace duckdb {
+
+struct PixelsWriteGlobalState : public GlobalFunctionData {
+	//! The writer of one file, there is one per thread with PER_THREAD_OUTPUT. The sinks of a file
+	//! are not run in parallel. If a sink fails, the state is destroyed without finalize, and the
+	//! writer is destroyed without being closed
+	std::shared_ptr<PixelsWriter> writer;
+};
+
+} // namespace duckdb
+
+#endif // EXAMPLE_C_PIXELSWRITEGLOBALSTATE_HPP
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef EXAMPLE_C_PIXELSWRITELOCALSTATE_HPP
+#define EXAMPLE_C_PIXELSWRITELOCALSTATE_HPP
+
+#include "duckdb.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "vector/VectorizedRowBatch.h"
+
+namespace duckdb {
+
+struct PixelsWriteLocalState : public LocalFunctionData {
+	//! The row batch whose fixed-width column vectors reference the vectors of the sunk chunk
+	std::shared_ptr<VectorizedRowBatch> rowBatch;
+	//! The flattened elements of the list columns, referenced by the row batch until it is added to the writer
+	vector<unique_ptr<Vector>> listElements;
+};
+
+} // namespace duckdb
+
+#endif // EXAMPLE_C_PIXELSWRITELOCALSTATE_HPP
@@ -31,13 +31,15 @@
 class Parameters {
 public:
     Parameters(const std::string &schema, int maxRowNum, const std::string &regex,
-               const std::string &loadingPath, EncodingLevel encodingLevel, bool nullsPadding);
+               const std::string &loadingPath, EncodingLevel encodingLevel, bool nullsPadding,
+               const std::string &sortKeys = "");
     std::string getLoadingPath() const;
     std::string getSchema() const;
     int getMaxRowNum() const;
     std::string getRegex() const;
     EncodingLevel getEncodingLevel() const;
     bool isNullsPadding() const;
+    std::string getSortKeys() const;
 
 private:
     std::string schema;
@@ -46,5 +48,9 @@ private:
     std::string loadingPath;
     EncodingLevel encodingLevel;
     bool nullsPadding;
+    /**
+     * The comma-separated names of the columns to sort the rows in each row group by, empty if not sorted.
+     */
+    std::string sortKeys;
 };
 #endif //PIXELS_PARAMETERS_H
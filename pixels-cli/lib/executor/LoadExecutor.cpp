@@ -38,12 +38,13 @@ void LoadExecutor::execute(const bpo::variables_map& ns, const std::string& comm
     std::string regex = ns["row_regex"].as<std::string>();
     EncodingLevel encodingLevel = EncodingLevel::from(ns["encoding_level"].as<int>());
     bool nullPadding = ns["nulls_padding"].as<bool>();
+    std::string sortKeys = ns["sort_keys"].as<std::string>();
 
     if(origin.back() != '/') {
         origin += "/";
     }
 
-    Parameters parameters(schema, rowNum, regex, target, encodingLevel, nullPadding);
+    Parameters parameters(schema, rowNum, regex, target, encodingLevel, nullPadding, sortKeys);
     LocalFS localFs;
     std::vector<std::string> fileList = localFs.listPaths(origin);
     std::vector<std::string> inputFiles, loadedFiles;
@@ -25,9 +25,10 @@
 #include <load/Parameters.h>
 
 Parameters::Parameters(const std::string &schema, int maxRowNum, const std::string &regex,
-                       const std::string &loadingPath, EncodingLevel encodingLevel, bool nullsPadding)
+                       const std::string &loadingPath, EncodingLevel encodingLevel, bool nullsPadding,
+                       const std::string &sortKeys)
                        : schema(schema), maxRowNum(maxRowNum), regex(regex), loadingPath(loadingPath),
-                         encodingLevel(encodingLevel), nullsPadding(nullsPadding) {}
+                         encodingLevel(encodingLevel), nullsPadding(nullsPadding), sortKeys(sortKeys) {}
 
 std::string Parameters::getSchema() const {
     return this->schema;
@@ -51,4 +52,8 @@ EncodingLevel Parameters::getEncodingLevel() const {
 
 bool Parameters::isNullsPadding() const {
     return this->nullsPadding;
+}
+
+std::string Parameters::getSortKeys() const {
+    return this->sortKeys;
 }
\ No newline at end of file
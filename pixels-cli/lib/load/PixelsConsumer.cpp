@@ -30,6 +30,8 @@
 #include "vector/VectorizedRowBatch.h"
 #include "physical/storage/LocalFS.h"
 #include "PixelsWriterImpl.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
 #include <boost/regex.hpp>
 #include <iostream>
 #include <fstream>
@@ -64,8 +66,22 @@ void PixelsConsumer::run() {
     int64_t blockSize = 1024;
 
     short replication = static_cast<short>(std::stoi(ConfigFactory::Instance().getProperty("block.replication")));
+    int compressionBlockSize = std::stoi(ConfigFactory::Instance().getProperty("column.chunk.compression.block.size"));
 
     std::shared_ptr<TypeDescription> schema = TypeDescription::fromString(schemaStr);
+    std::vector<int> sortKeyColumns;
+    if (!parameters.getSortKeys().empty()) {
+        std::vector<std::string> fieldNames = schema->getFieldNames();
+        std::stringstream sortKeys(parameters.getSortKeys());
+        std::string sortKey;
+        while (std::getline(sortKeys, sortKey, ',')) {
+            auto it = std::find(fieldNames.begin(), fieldNames.end(), sortKey);
+            if (it == fieldNames.end()) {
+                throw InvalidArgumentException("sort key column " + sortKey + " does not exist in the schema");
+            }
+            sortKeyColumns.push_back(it - fieldNames.begin());
+        }
+    }
     std::shared_ptr<VectorizedRowBatch> rowBatch = schema->createRowBatch(pixelsStride);
     std::vector<std::shared_ptr<ColumnVector>> columnVectors = rowBatch->cols;
 
@@ -102,8 +118,10 @@ void PixelsConsumer::run() {
                     targetFileName = std::to_string(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now())) + ".pxl";
                     targetFilePath = targetPath + targetFileName;
                     std::cout << "Target file path: " << targetFilePath << std::endl;
-                    pixelsWriter = std::make_shared<PixelsWriterImpl>(schema, pixelsStride, rowGroupSize, targetFilePath, blockSize,
-                                                                    true, encodingLevel, nullPadding,false, 1);
+                    auto pixelsWriterImpl = std::make_shared<PixelsWriterImpl>(schema, pixelsStride, rowGroupSize, targetFilePath, blockSize,
+                                                                    true, encodingLevel, nullPadding,false, compressionBlockSize);
+                    pixelsWriterImpl->getColumnWriterOption()->setSortKeyColumns(sortKeyColumns);
+                    pixelsWriter = pixelsWriterImpl;
                     if (!pixelsWriter) {
                         std::cerr << "Failed to create PixelsWriter." << std::endl;
                     }
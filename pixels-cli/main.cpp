@@ -96,7 +96,8 @@ int main () {
                     ("row_num,n", bpo::value<int>()->required(), "specify the max number of rows to write in a file")
                     ("row_regex,r", bpo::value<std::string>()->required(), "specify the split regex of each row in a file")
                     ("encoding_level,e", bpo::value<int>()->default_value(2), "specify the encoding level for data loading")
-                    ("nulls_padding,p", bpo::value<bool>()->default_value(false), "specify whether nulls padding is enabled");
+                    ("nulls_padding,p", bpo::value<bool>()->default_value(false), "specify whether nulls padding is enabled")
+                    ("sort_keys,k", bpo::value<std::string>()->default_value(""), "specify the comma-separated names of the columns to sort the rows in each row group by");
 
             bpo::variables_map vm;
             try {
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_COMPRESSIONCODEC_H
+#define PIXELS_COMPRESSIONCODEC_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * A block compression codec for column chunks.
+ * <p>
+ * A compressed column chunk is a sequence of blocks, each of which covers at most
+ * compressionBlockSize bytes of the original chunk. Every block starts with an 8-byte
+ * header holding the compressed and the original length (both little-endian uint32).
+ * A block that does not shrink is stored as is, in which case the two lengths are equal.
+ */
+class CompressionCodec {
+public:
+    static const int BLOCK_HEADER_SIZE = 8;
+
+    virtual ~CompressionCodec() = default;
+    virtual size_t maxCompressedLength(size_t length) = 0;
+    /**
+     * @return the number of bytes written into dst
+     */
+    virtual size_t compress(const uint8_t *src, size_t length, uint8_t *dst, size_t capacity, int level) = 0;
+    /**
+     * Decompress exactly dstLength bytes into dst, throws if the input is corrupted.
+     */
+    virtual void decompress(const uint8_t *src, size_t length, uint8_t *dst, size_t dstLength) = 0;
+
+    void compressBlocks(const uint8_t *src, size_t length, int blockSize, int level, std::vector<uint8_t> &out);
+    void decompressBlocks(const uint8_t *src, size_t length, uint8_t *dst, size_t dstLength);
+};
+#endif //PIXELS_COMPRESSIONCODEC_H
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_COMPRESSIONCODECFACTORY_H
+#define PIXELS_COMPRESSIONCODECFACTORY_H
+
+#include "compression/CompressionCodec.h"
+#include "pixels-common/pixels.pb.h"
+#include <memory>
+#include <string>
+
+class CompressionCodecFactory {
+public:
+    static CompressionCodecFactory * Instance();
+    /**
+     * @return the codec of the compression kind, nullptr for NONE.
+     * Throws if the codec library was not found when pixels-common was built.
+     */
+    std::shared_ptr<CompressionCodec> getCodec(pixels::proto::CompressionKind kind);
+    /**
+     * Parse the compression kind from its name (none, lz4 or zstd), case-insensitive.
+     */
+    static pixels::proto::CompressionKind parseCompressionKind(std::string name);
+private:
+    std::shared_ptr<CompressionCodec> lz4Codec;
+    std::shared_ptr<CompressionCodec> zstdCodec;
+    CompressionCodecFactory();
+};
+#endif //PIXELS_COMPRESSIONCODECFACTORY_H
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_ZSTDCODEC_H
+#define PIXELS_ZSTDCODEC_H
+
+#include "compression/CompressionCodec.h"
+
+class ZstdCodec : public CompressionCodec {
+public:
+    size_t maxCompressedLength(size_t length) override;
+    size_t compress(const uint8_t *src, size_t length, uint8_t *dst, size_t capacity, int level) override;
+    void decompress(const uint8_t *src, size_t length, uint8_t *dst, size_t dstLength) override;
+};
+#endif //PIXELS_ZSTDCODEC_H
@@ -27,6 +27,11 @@ public:
 	static void Initialize(std::vector<uint32_t> colIds, std::vector<uint64_t> bytes, std::vector<std::string> columnNames);
 	static std::shared_ptr<ByteBuffer> GetBuffer(uint32_t colId);
     static int64_t GetBufferId(uint32_t index);
+	/**
+	 * Get a buffer of at least size bytes to decompress the chunk of the column into.
+	 * Like the chunk buffers, it is double buffered and only grows when a larger chunk comes.
+	 */
+	static std::shared_ptr<ByteBuffer> GetDecompressBuffer(uint32_t colId, uint64_t size);
     static void Switch();
 	static void Reset();
 private:
@@ -35,6 +40,17 @@ private:
 	static thread_local std::map<uint32_t, uint64_t> nrBytes;
 	static thread_local bool isInitialized;
 	static thread_local std::map<uint32_t, std::shared_ptr<ByteBuffer>> buffers[2];
+	static thread_local std::map<uint32_t, std::shared_ptr<ByteBuffer>> decompressBuffers[2];
+	/**
+	 * The buffers replaced while they were pinned by column vectors. A retired buffer is reused
+	 * once no vector refers to it, so that a batch spanning many row groups does not allocate
+	 * new buffers for each row group.
+	 */
+	static thread_local std::vector<std::shared_ptr<ByteBuffer>> retiredBuffers;
+	/**
+	 * Replace the pinned buffer with an unpinned buffer of at least size bytes.
+	 */
+	static void ReplacePinned(std::shared_ptr<ByteBuffer> & buffer, uint64_t size);
 	static std::shared_ptr<DirectIoLib> directIoLib;
     static thread_local int currBufferIdx;
     static thread_local int nextBufferIdx;
@@ -34,7 +34,12 @@
 #include <cmath>
 
 
-class ByteBuffer {
+/**
+ * A buffer sliced from another ByteBuffer does not own its memory. It holds the buffer
+ * that owns the memory (if that buffer is managed by a shared_ptr), so that a slice
+ * which is still referenced keeps the underlying memory alive.
+ */
+class ByteBuffer : public std::enable_shared_from_this<ByteBuffer> {
 public:
     ByteBuffer(uint32_t size = BB_DEFAULT_SIZE);
     ByteBuffer(uint8_t* arr, uint32_t size, bool allocated_by_new = true);
@@ -45,6 +50,7 @@ public:
     void clear(); // Clear our the vector and reset read and write positions
     uint32_t size(); // Size of internal vector
     uint8_t * getPointer(); // get the pointer of bytebuffer
+    std::shared_ptr<ByteBuffer> getOwner(); // get the buffer that owns the memory of this buffer
     void resetPosition();
     // Read
     uint8_t peek(); // Relative peek. Reads and returns the next uint8_t in the buffer from the current position but does not increment the read position
@@ -127,6 +133,8 @@ protected:
     std::string name;
     uint32_t rmark;
     bool fromOtherBB;
+    // the buffer that owns the memory if this buffer is sliced from another buffer
+    std::shared_ptr<ByteBuffer> owner;
 	// Sometimes the buffer is allocated by malloc/poxis_memalign, in this case, we
 	// should use free() to deallocate the buf
 	bool allocated_by_new;
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_SEGMENTEDOUTPUTSTREAM_H
+#define PIXELS_SEGMENTEDOUTPUTSTREAM_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <sys/uio.h>
+
+/**
+ * An append-only stream stored in a chain of page-aligned segments. The first segment is
+ * MIN_SEGMENT_SIZE bytes and each following segment doubles up to MAX_SEGMENT_SIZE, so the
+ * stream grows without reallocating or copying the written content.
+ * <p>
+ * The segments are allocated from an arena shared by the streams in the process. clear() and
+ * the destructor return them to the arena, so the streams of a new row group reuse the memory
+ * released by the previous one. The arena keeps at most writer.segment.cache.size bytes of free
+ * segments and frees the others. resetPosition() keeps the segments of this stream for reuse.
+ */
+class SegmentedOutputStream {
+public:
+    static const size_t MIN_SEGMENT_SIZE;
+    static const size_t MAX_SEGMENT_SIZE;
+
+    SegmentedOutputStream();
+    ~SegmentedOutputStream();
+    SegmentedOutputStream(const SegmentedOutputStream &) = delete;
+    SegmentedOutputStream & operator=(const SegmentedOutputStream &) = delete;
+
+    void put(uint8_t value);
+    void putBytes(const uint8_t *bytes, size_t length);
+    /**
+     * @return the number of bytes written into this stream
+     */
+    size_t getWritePos() const;
+    /**
+     * @return the number of bytes of the segments held by this stream
+     */
+    size_t getCapacity() const;
+    /**
+     * Discard the written content but keep the segments.
+     */
+    void resetPosition();
+    /**
+     * Discard the written content and return the segments to the arena.
+     */
+    void clear();
+    /**
+     * Append the written parts of the segments to the buffers, e.g., for a gather write.
+     */
+    void getBuffers(std::vector<struct iovec> &buffers) const;
+    /**
+     * @return the number of bytes of the free segments kept by the arena
+     */
+    static size_t getFreeBytes();
+    /**
+     * @return the maximum number of bytes of the free segments kept by the arena
+     */
+    static size_t getMaxFreeBytes();
+    /**
+     * Get the written content as a contiguous array. The content of the first segment is returned
+     * in place, otherwise the content is copied into the scratch buffer.
+     */
+    const uint8_t *getContent(std::vector<uint8_t> &scratch) const;
+
+private:
+    struct Segment {
+        uint8_t *data;
+        size_t capacity;
+        size_t length;
+    };
+    void nextSegment();
+    static uint8_t *allocateSegment(size_t capacity);
+    static void releaseSegment(uint8_t *data, size_t capacity);
+
+    std::vector<Segment> segments;
+    // the index of the segment being written
+    size_t curSegment;
+    size_t writePos;
+};
+#endif //PIXELS_SEGMENTEDOUTPUTSTREAM_H
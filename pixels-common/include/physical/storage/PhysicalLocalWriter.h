@@ -28,14 +28,18 @@
 #include "physical/PhysicalWriter.h"
 #include "physical/storage/LocalFS.h"
 #include "physical/natives/ByteBuffer.h"
-#include <fstream>
 
 class PhysicalLocalWriter : public PhysicalWriter {
 public:
     PhysicalLocalWriter(const std::string &path, bool overwrite);
+    ~PhysicalLocalWriter() override;
     std::int64_t prepare(int length) override;
     std::int64_t append(const uint8_t *buffer, int offset, int length) override;
     std::int64_t append(std::shared_ptr<ByteBuffer> byteBuffer) override;
+    /**
+     * Write the buffers with pwritev, at most IOV_MAX buffers per system call.
+     */
+    std::int64_t append(const std::vector<struct iovec> &buffers) override;
     void close() override;
     void flush() override;
     std::string getPath() const override;
@@ -44,6 +48,6 @@ private:
     std::shared_ptr<LocalFS> localFS;
     std::string path;
     std::int64_t position;
-    std::ofstream rawWriter;
+    int fd;
 };
 #endif //PIXELS_PHYSICALLOCALWRITER_H
@@ -19,6 +19,10 @@ public:
 	static ConfigFactory & Instance();
 	void Print();
 	std::string getProperty(std::string key);
+	/**
+	 * Set or override a property after pixels-cxx.properties is loaded, e.g., in tests.
+	 */
+	void addProperty(std::string key, std::string value);
     bool boolCheckProperty(std::string key);
 	std::string getPixelsDirectory();
     std::string getPixelsSourceDirectory();
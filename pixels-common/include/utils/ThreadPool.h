@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_THREADPOOL_H
+#define PIXELS_THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads running the tasks submitted to a bounded queue.
+ * submit() blocks while the queue is full, which applies backpressure to the producers.
+ * <p>
+ * A task must not wait for other tasks of the same pool, otherwise the workers may
+ * all be blocked on tasks that are never run.
+ */
+class ThreadPool {
+public:
+    /**
+     * The pool shared by the pixels writers, its size is set by writer.threads.
+     */
+    static ThreadPool & Instance();
+    /**
+     * The pool running the row group flushes of the pixels writers. A flush waits for the chunk
+     * compression tasks it submits to Instance(), so it must not run on that pool.
+     */
+    static ThreadPool & FlushInstance();
+    ThreadPool(int numThreads, int queueCapacity);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+    /**
+     * Run the task on a worker thread.
+     * @return the future of the task, which rethrows the exception thrown by the task
+     */
+    std::future<void> submit(std::function<void()> task);
+    int getThreadNum() const;
+private:
+    void work();
+    std::vector<std::thread> workers;
+    std::deque<std::packaged_task<void()>> tasks;
+    size_t queueCapacity;
+    bool stopped;
+    std::mutex lock;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+};
+#endif //PIXELS_THREADPOOL_H
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "compression/CompressionCodec.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
+#include <cstring>
+
+static inline void putUInt32(uint8_t *dst, uint32_t value) {
+    dst[0] = value & 0xff;
+    dst[1] = (value >> 8) & 0xff;
+    dst[2] = (value >> 16) & 0xff;
+    dst[3] = (value >> 24) & 0xff;
+}
+
+static inline uint32_t getUInt32(const uint8_t *src) {
+    return (uint32_t) src[0] | ((uint32_t) src[1] << 8) |
+           ((uint32_t) src[2] << 16) | ((uint32_t) src[3] << 24);
+}
+
+void CompressionCodec::compressBlocks(const uint8_t *src, size_t length, int blockSize, int level,
+                                      std::vector<uint8_t> &out) {
+    if (blockSize <= 0) {
+        throw InvalidArgumentException("CompressionCodec::compressBlocks: block size must be positive");
+    }
+    size_t numBlocks = (length + blockSize - 1) / blockSize;
+    out.resize(numBlocks * BLOCK_HEADER_SIZE + maxCompressedLength(length));
+    size_t outPos = 0;
+    for (size_t pos = 0; pos < length; pos += blockSize) {
+        size_t rawLength = std::min((size_t) blockSize, length - pos);
+        size_t bound = maxCompressedLength(rawLength);
+        if (out.size() < outPos + BLOCK_HEADER_SIZE + bound) {
+            out.resize(outPos + BLOCK_HEADER_SIZE + bound);
+        }
+        uint8_t *header = out.data() + outPos;
+        uint8_t *body = header + BLOCK_HEADER_SIZE;
+        size_t compressedLength = compress(src + pos, rawLength, body, bound, level);
+        if (compressedLength >= rawLength) {
+            // incompressible block, keep the original bytes
+            std::memcpy(body, src + pos, rawLength);
+            compressedLength = rawLength;
+        }
+        putUInt32(header, compressedLength);
+        putUInt32(header + 4, rawLength);
+        outPos += BLOCK_HEADER_SIZE + compressedLength;
+    }
+    out.resize(outPos);
+}
+
+void CompressionCodec::decompressBlocks(const uint8_t *src, size_t length, uint8_t *dst, size_t dstLength) {
+    size_t inPos = 0;
+    size_t outPos = 0;
+    while (inPos < length) {
+        if (inPos + BLOCK_HEADER_SIZE > length) {
+            throw InvalidArgumentException("CompressionCodec::decompressBlocks: truncated block header");
+        }
+        uint32_t compressedLength = getUInt32(src + inPos);
+        uint32_t rawLength = getUInt32(src + inPos + 4);
+        inPos += BLOCK_HEADER_SIZE;
+        if (inPos + compressedLength > length || outPos + rawLength > dstLength) {
+            throw InvalidArgumentException("CompressionCodec::decompressBlocks: block exceeds the chunk boundary");
+        }
+        if (compressedLength == rawLength) {
+            std::memcpy(dst + outPos, src + inPos, rawLength);
+        } else {
+            decompress(src + inPos, compressedLength, dst + outPos, rawLength);
+        }
+        inPos += compressedLength;
+        outPos += rawLength;
+    }
+    if (outPos != dstLength) {
+        throw InvalidArgumentException("CompressionCodec::decompressBlocks: decompressed length mismatch");
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "compression/CompressionCodecFactory.h"
+#include "compression/Lz4Codec.h"
+#include "compression/ZstdCodec.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
+#include <cctype>
+
+CompressionCodecFactory * CompressionCodecFactory::Instance() {
+    // the codecs are stateless and shared by the writer and the scan threads
+    static CompressionCodecFactory instance;
+    return &instance;
+}
+
+CompressionCodecFactory::CompressionCodecFactory() {
+#ifdef ENABLE_LZ4
+    lz4Codec = std::make_shared<Lz4Codec>();
+#endif
+#ifdef ENABLE_ZSTD
+    zstdCodec = std::make_shared<ZstdCodec>();
+#endif
+}
+
+std::shared_ptr<CompressionCodec> CompressionCodecFactory::getCodec(pixels::proto::CompressionKind kind) {
+    std::shared_ptr<CompressionCodec> codec;
+    switch (kind) {
+        case pixels::proto::NONE:
+            return nullptr;
+        case pixels::proto::LZ4:
+            codec = lz4Codec;
+            break;
+        case pixels::proto::ZSTD:
+            codec = zstdCodec;
+            break;
+        default:
+            throw InvalidArgumentException("CompressionCodecFactory::getCodec: compression kind " +
+                                           pixels::proto::CompressionKind_Name(kind) + " is not supported");
+    }
+    if (codec == nullptr) {
+        throw InvalidArgumentException("CompressionCodecFactory::getCodec: compression kind " +
+                                       pixels::proto::CompressionKind_Name(kind) + " is not built in");
+    }
+    return codec;
+}
+
+pixels::proto::CompressionKind CompressionCodecFactory::parseCompressionKind(std::string name) {
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c){ return std::tolower(c); });
+    if (name.empty() || name == "none") {
+        return pixels::proto::NONE;
+    } else if (name == "lz4") {
+        return pixels::proto::LZ4;
+    } else if (name == "zstd") {
+        return pixels::proto::ZSTD;
+    }
+    throw InvalidArgumentException("CompressionCodecFactory: unsupported compression kind " + name);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifdef ENABLE_LZ4
+#include "compression/Lz4Codec.h"
+#include "exception/InvalidArgumentException.h"
+#include <lz4.h>
+#include <lz4hc.h>
+
+size_t Lz4Codec::maxCompressedLength(size_t length) {
+    return LZ4_compressBound((int) length);
+}
+
+size_t Lz4Codec::compress(const uint8_t *src, size_t length, uint8_t *dst, size_t capacity, int level) {
+    int ret;
+    if (level < LZ4HC_CLEVEL_MIN) {
+        ret = LZ4_compress_default((const char *) src, (char *) dst, (int) length, (int) capacity);
+    } else {
+        ret = LZ4_compress_HC((const char *) src, (char *) dst, (int) length, (int) capacity, level);
+    }
+    if (ret <= 0) {
+        throw InvalidArgumentException("Lz4Codec::compress: failed to compress the block");
+    }
+    return ret;
+}
+
+void Lz4Codec::decompress(const uint8_t *src, size_t length, uint8_t *dst, size_t dstLength) {
+    int ret = LZ4_decompress_safe((const char *) src, (char *) dst, (int) length, (int) dstLength);
+    if (ret < 0 || (size_t) ret != dstLength) {
+        throw InvalidArgumentException("Lz4Codec::decompress: corrupted block");
+    }
+}
+#endif // ENABLE_LZ4
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifdef ENABLE_ZSTD
+#include "compression/ZstdCodec.h"
+#include "exception/InvalidArgumentException.h"
+#include <memory>
+#include <string>
+#include <zstd.h>
+
+// compression contexts are expensive to create, so each thread keeps its own
+static ZSTD_CCtx *threadCCtx() {
+    static thread_local std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx *)> ctx(ZSTD_createCCtx(), ZSTD_freeCCtx);
+    return ctx.get();
+}
+
+static ZSTD_DCtx *threadDCtx() {
+    static thread_local std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx *)> ctx(ZSTD_createDCtx(), ZSTD_freeDCtx);
+    return ctx.get();
+}
+
+size_t ZstdCodec::maxCompressedLength(size_t length) {
+    return ZSTD_compressBound(length);
+}
+
+size_t ZstdCodec::compress(const uint8_t *src, size_t length, uint8_t *dst, size_t capacity, int level) {
+    size_t ret = ZSTD_compressCCtx(threadCCtx(), dst, capacity, src, length, level);
+    if (ZSTD_isError(ret)) {
+        throw InvalidArgumentException("ZstdCodec::compress: " + std::string(ZSTD_getErrorName(ret)));
+    }
+    return ret;
+}
+
+void ZstdCodec::decompress(const uint8_t *src, size_t length, uint8_t *dst, size_t dstLength) {
+    size_t ret = ZSTD_decompressDCtx(threadDCtx(), dst, dstLength, src, length);
+    if (ZSTD_isError(ret)) {
+        throw InvalidArgumentException("ZstdCodec::decompress: " + std::string(ZSTD_getErrorName(ret)));
+    }
+    if (ret != dstLength) {
+        throw InvalidArgumentException("ZstdCodec::decompress: decompressed length mismatch");
+    }
+}
+#endif // ENABLE_ZSTD
@@ -8,6 +8,8 @@ thread_local int BufferPool::colCount = 0;
 thread_local std::map<uint32_t, uint64_t> BufferPool::nrBytes;
 thread_local bool BufferPool::isInitialized = false;
 thread_local std::map<uint32_t, std::shared_ptr<ByteBuffer>> BufferPool::buffers[2];
+thread_local std::map<uint32_t, std::shared_ptr<ByteBuffer>> BufferPool::decompressBuffers[2];
+thread_local std::vector<std::shared_ptr<ByteBuffer>> BufferPool::retiredBuffers;
 // The currBufferIdx is set to 1. When executing the first file, this value is 0
 // since we call switch function first.
 thread_local int BufferPool::currBufferIdx = 1;
@@ -59,6 +61,12 @@ void BufferPool::Initialize(std::vector<uint32_t> colIds, std::vector<uint64_t>
 			if (BufferPool::nrBytes[colId] < byte) {
 				throw InvalidArgumentException("the new buffer byte cannot larger than the previous buffer byte. ");
 			}
+			// the buffer is still pinned by the column vectors (zero-copy) of a previous batch,
+			// leave it to them and read into a new buffer of the same size
+			auto & buffer = BufferPool::buffers[currBufferIdx][colId];
+			if (buffer.use_count() > 1) {
+				BufferPool::ReplacePinned(buffer, BufferPool::nrBytes[colId]);
+			}
 		}
 	}
 }
@@ -71,12 +79,48 @@ std::shared_ptr<ByteBuffer> BufferPool::GetBuffer(uint32_t colId) {
 	return BufferPool::buffers[currBufferIdx][colId];
 }
 
+std::shared_ptr<ByteBuffer> BufferPool::GetDecompressBuffer(uint32_t colId, uint64_t size) {
+	auto & buffer = BufferPool::decompressBuffers[currBufferIdx][colId];
+	if (buffer != nullptr && buffer.use_count() > 1) {
+		// the buffer is still pinned by the column vectors of a previous batch
+		BufferPool::ReplacePinned(buffer, size);
+	}
+	if (buffer == nullptr || buffer->size() < size) {
+		// grow to the next power of two so that slightly larger chunks do not trigger reallocation
+		uint64_t capacity = 1;
+		while (capacity < size) {
+			capacity <<= 1;
+		}
+		buffer = BufferPool::directIoLib->allocateDirectBuffer(capacity);
+	}
+	return buffer;
+}
+
+void BufferPool::ReplacePinned(std::shared_ptr<ByteBuffer> & buffer, uint64_t size) {
+	std::shared_ptr<ByteBuffer> replacement;
+	for (auto it = BufferPool::retiredBuffers.begin(); it != BufferPool::retiredBuffers.end(); ++it) {
+		// only the pool refers to a retired buffer once the vectors release it
+		if (it->use_count() == 1 && (*it)->size() >= size) {
+			replacement = *it;
+			BufferPool::retiredBuffers.erase(it);
+			break;
+		}
+	}
+	if (replacement == nullptr) {
+		replacement = BufferPool::directIoLib->allocateDirectBuffer(size);
+	}
+	BufferPool::retiredBuffers.emplace_back(buffer);
+	buffer = replacement;
+}
+
 void BufferPool::Reset() {
 	BufferPool::isInitialized = false;
 	BufferPool::nrBytes.clear();
     for(int idx = 0; idx < 2; idx++) {
         BufferPool::buffers[idx].clear();
+        BufferPool::decompressBuffers[idx].clear();
     }
+	BufferPool::retiredBuffers.clear();
 	BufferPool::colCount = 0;
 }
 
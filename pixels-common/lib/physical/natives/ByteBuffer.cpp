@@ -64,6 +64,7 @@ ByteBuffer::ByteBuffer(ByteBuffer & bb, uint32_t startId, uint32_t length) {
     name = "";
     fromOtherBB = true;
 	allocated_by_new = true;
+    owner = bb.getOwner();
 }
 
 /**
@@ -350,6 +351,14 @@ uint8_t *ByteBuffer::getPointer() {
     return buf;
 }
 
+std::shared_ptr<ByteBuffer> ByteBuffer::getOwner() {
+    if(owner != nullptr) {
+        return owner;
+    }
+    // nullptr if this buffer is not managed by a shared_ptr
+    return weak_from_this().lock();
+}
+
 void ByteBuffer::markReaderIndex() {
     rmark = rpos;
 }
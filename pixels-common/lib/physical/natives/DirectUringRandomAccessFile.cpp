@@ -14,26 +14,39 @@ DirectUringRandomAccessFile::DirectUringRandomAccessFile(const std::string &file
 
 void DirectUringRandomAccessFile::RegisterBufferFromPool(std::vector<uint32_t> colIds) {
     std::vector<std::shared_ptr<ByteBuffer>> tmpBuffers;
-    if(!isRegistered) {
-        for(auto buffer : ::BufferPool::buffers) {
-            for(auto colId : colIds) {
-                tmpBuffers.emplace_back(buffer[colId]);
-            }
+    for(auto & buffer : ::BufferPool::buffers) {
+        for(auto colId : colIds) {
+            tmpBuffers.emplace_back(buffer[colId]);
         }
-        iovecs = (iovec *)calloc(tmpBuffers.size() ,sizeof(struct iovec));
-        iovecSize = tmpBuffers.size();
-        for(auto i = 0; i < tmpBuffers.size(); i++) {
-            auto buffer = tmpBuffers.at(i);
-            iovecs[i].iov_base = buffer->getPointer();
-            iovecs[i].iov_len = buffer->size();
-            memset(iovecs[i].iov_base, 0, buffer->size());
+    }
+    if(isRegistered) {
+        // the buffer pool replaces the buffers that are still pinned by column vectors,
+        // in which case the new buffers must be registered instead of the old ones
+        bool changed = tmpBuffers.size() != iovecSize;
+        for(auto i = 0; !changed && i < tmpBuffers.size(); i++) {
+            changed = iovecs[i].iov_base != tmpBuffers.at(i)->getPointer();
         }
-        int ret = io_uring_register_buffers(ring, iovecs, iovecSize);
-        if(ret != 0) {
-            throw InvalidArgumentException("DirectUringRandomAccessFile::RegisterBuffer: register buffer fails. ");
+        if(!changed) {
+            return;
         }
-        isRegistered = true;
+        io_uring_unregister_buffers(ring);
+        free(iovecs);
+        iovecs = nullptr;
+        isRegistered = false;
+    }
+    iovecs = (iovec *)calloc(tmpBuffers.size() ,sizeof(struct iovec));
+    iovecSize = tmpBuffers.size();
+    for(auto i = 0; i < tmpBuffers.size(); i++) {
+        auto buffer = tmpBuffers.at(i);
+        iovecs[i].iov_base = buffer->getPointer();
+        iovecs[i].iov_len = buffer->size();
+        memset(iovecs[i].iov_base, 0, buffer->size());
+    }
+    int ret = io_uring_register_buffers(ring, iovecs, iovecSize);
+    if(ret != 0) {
+        throw InvalidArgumentException("DirectUringRandomAccessFile::RegisterBuffer: register buffer fails. ");
     }
+    isRegistered = true;
 }
 
 
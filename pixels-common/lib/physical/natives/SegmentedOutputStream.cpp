@@ -0,0 +1,208 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "physical/natives/SegmentedOutputStream.h"
+#include "utils/ConfigFactory.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+const size_t SegmentedOutputStream::MIN_SEGMENT_SIZE = 64 * 1024;
+const size_t SegmentedOutputStream::MAX_SEGMENT_SIZE = 1024 * 1024;
+
+namespace {
+    const size_t SEGMENT_ALIGNMENT = 4096;
+    /**
+     * The free segments of each size, from MIN_SEGMENT_SIZE to MAX_SEGMENT_SIZE. The arena keeps at most
+     * maxFreeBytes of the segments released by the streams, the other segments are freed, so that the
+     * memory of the process shrinks after the writers are closed.
+     */
+    struct SegmentArena {
+        std::mutex lock;
+        std::vector<std::vector<uint8_t *>> freeSegments;
+        size_t freeBytes = 0;
+        size_t maxFreeBytes = std::stoull(ConfigFactory::Instance().getProperty("writer.segment.cache.size"));
+    };
+
+    SegmentArena &arena() {
+        // never destroyed, so that the streams with static storage duration can still release their segments
+        static SegmentArena *instance = new SegmentArena();
+        return *instance;
+    }
+
+    size_t sizeClass(size_t capacity) {
+        size_t sizeClass = 0;
+        while ((SegmentedOutputStream::MIN_SEGMENT_SIZE << sizeClass) < capacity) {
+            sizeClass++;
+        }
+        return sizeClass;
+    }
+}
+
+SegmentedOutputStream::SegmentedOutputStream() : curSegment(0), writePos(0) {}
+
+SegmentedOutputStream::~SegmentedOutputStream() {
+    clear();
+}
+
+void SegmentedOutputStream::put(uint8_t value) {
+    if (segments.empty() || segments[curSegment].length == segments[curSegment].capacity) {
+        nextSegment();
+    }
+    Segment &segment = segments[curSegment];
+    segment.data[segment.length++] = value;
+    writePos++;
+}
+
+void SegmentedOutputStream::putBytes(const uint8_t *bytes, size_t length) {
+    while (length > 0) {
+        if (segments.empty() || segments[curSegment].length == segments[curSegment].capacity) {
+            nextSegment();
+        }
+        Segment &segment = segments[curSegment];
+        size_t toCopy = std::min(length, segment.capacity - segment.length);
+        std::memcpy(segment.data + segment.length, bytes, toCopy);
+        segment.length += toCopy;
+        writePos += toCopy;
+        bytes += toCopy;
+        length -= toCopy;
+    }
+}
+
+size_t SegmentedOutputStream::getWritePos() const {
+    return writePos;
+}
+
+size_t SegmentedOutputStream::getCapacity() const {
+    size_t capacity = 0;
+    for (const auto &segment : segments) {
+        capacity += segment.capacity;
+    }
+    return capacity;
+}
+
+void SegmentedOutputStream::resetPosition() {
+    for (auto &segment : segments) {
+        segment.length = 0;
+    }
+    curSegment = 0;
+    writePos = 0;
+}
+
+void SegmentedOutputStream::clear() {
+    for (auto &segment : segments) {
+        releaseSegment(segment.data, segment.capacity);
+    }
+    segments.clear();
+    curSegment = 0;
+    writePos = 0;
+}
+
+void SegmentedOutputStream::getBuffers(std::vector<struct iovec> &buffers) const {
+    for (const auto &segment : segments) {
+        if (segment.length == 0) {
+            break;
+        }
+        struct iovec buffer;
+        buffer.iov_base = segment.data;
+        buffer.iov_len = segment.length;
+        buffers.push_back(buffer);
+    }
+}
+
+const uint8_t *SegmentedOutputStream::getContent(std::vector<uint8_t> &scratch) const {
+    if (segments.empty()) {
+        return nullptr;
+    }
+    if (writePos == segments[0].length) {
+        return segments[0].data;
+    }
+    scratch.resize(writePos);
+    size_t offset = 0;
+    for (const auto &segment : segments) {
+        std::memcpy(scratch.data() + offset, segment.data, segment.length);
+        offset += segment.length;
+    }
+    return scratch.data();
+}
+
+void SegmentedOutputStream::nextSegment() {
+    if (!segments.empty()) {
+        curSegment++;
+    }
+    if (curSegment < segments.size()) {
+        // reuse the segment kept by resetPosition
+        return;
+    }
+    size_t capacity = std::min(MIN_SEGMENT_SIZE << std::min(segments.size(), (size_t) 16), MAX_SEGMENT_SIZE);
+    segments.push_back({allocateSegment(capacity), capacity, 0});
+    curSegment = segments.size() - 1;
+}
+
+uint8_t *SegmentedOutputStream::allocateSegment(size_t capacity) {
+    {
+        SegmentArena &segmentArena = arena();
+        std::lock_guard<std::mutex> guard(segmentArena.lock);
+        auto &freeSegments = segmentArena.freeSegments;
+        size_t index = sizeClass(capacity);
+        if (index < freeSegments.size() && !freeSegments[index].empty()) {
+            uint8_t *data = freeSegments[index].back();
+            freeSegments[index].pop_back();
+            segmentArena.freeBytes -= capacity;
+            return data;
+        }
+    }
+    void *data = nullptr;
+    if (posix_memalign(&data, SEGMENT_ALIGNMENT, capacity) != 0) {
+        throw std::bad_alloc();
+    }
+    return static_cast<uint8_t *>(data);
+}
+
+void SegmentedOutputStream::releaseSegment(uint8_t *data, size_t capacity) {
+    {
+        SegmentArena &segmentArena = arena();
+        std::lock_guard<std::mutex> guard(segmentArena.lock);
+        if (segmentArena.freeBytes + capacity <= segmentArena.maxFreeBytes) {
+            auto &freeSegments = segmentArena.freeSegments;
+            size_t index = sizeClass(capacity);
+            if (index >= freeSegments.size()) {
+                freeSegments.resize(index + 1);
+            }
+            freeSegments[index].push_back(data);
+            segmentArena.freeBytes += capacity;
+            return;
+        }
+    }
+    free(data);
+}
+
+size_t SegmentedOutputStream::getFreeBytes() {
+    SegmentArena &segmentArena = arena();
+    std::lock_guard<std::mutex> guard(segmentArena.lock);
+    return segmentArena.freeBytes;
+}
+
+size_t SegmentedOutputStream::getMaxFreeBytes() {
+    return arena().maxFreeBytes;
+}
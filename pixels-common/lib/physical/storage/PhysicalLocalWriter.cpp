@@ -24,14 +24,25 @@
 
 #include "physical/storage/PhysicalLocalWriter.h"
 #include "utils/Constants.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <climits>
+#include <cstring>
 
 PhysicalLocalWriter::PhysicalLocalWriter(const std::string &path, bool overwrite) {
     this->position = 0;
     this->path = path;
-    this->rawWriter.open(this->path, overwrite ? std::ios::trunc : std::ios::app);
-    if (!this->rawWriter.is_open()) {
+    this->fd = open(this->path.c_str(), O_WRONLY | O_CREAT | (overwrite ? O_TRUNC : O_APPEND), 0644);
+    if (this->fd < 0) {
         throw std::runtime_error("Failed to open file: " + this->path);
     }
+    if (!overwrite) {
+        this->position = lseek(this->fd, 0, SEEK_END);
+    }
+}
+
+PhysicalLocalWriter::~PhysicalLocalWriter() {
+    close();
 }
 
 std::int64_t PhysicalLocalWriter::prepare(int length) {
@@ -39,20 +50,50 @@ std::int64_t PhysicalLocalWriter::prepare(int length) {
 }
 
 std::int64_t PhysicalLocalWriter::append(const uint8_t *buffer, int offset, int length) {
+    std::vector<struct iovec> buffers(1);
+    buffers[0].iov_base = const_cast<uint8_t *>(buffer + offset);
+    buffers[0].iov_len = length;
+    return append(buffers);
+}
+
+std::int64_t PhysicalLocalWriter::append(const std::vector<struct iovec> &buffers) {
     std::int64_t start = position;
-    rawWriter.write(reinterpret_cast<const char *>(buffer + offset), length);
-    position += length;
+    std::vector<struct iovec> remaining(buffers);
+    size_t first = 0;
+    while (first < remaining.size()) {
+        int count = std::min(remaining.size() - first, (size_t) IOV_MAX);
+        ssize_t written = pwritev(fd, remaining.data() + first, count, position);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Failed to write file " + path + ": " + std::strerror(errno));
+        }
+        position += written;
+        // skip the buffers that are fully written and resume from the partially written one
+        while (first < remaining.size() && written >= (ssize_t) remaining[first].iov_len) {
+            written -= remaining[first].iov_len;
+            first++;
+        }
+        if (written > 0) {
+            remaining[first].iov_base = static_cast<uint8_t *>(remaining[first].iov_base) + written;
+            remaining[first].iov_len -= written;
+        }
+    }
     return start;
 }
 
 
 
 void PhysicalLocalWriter::close() {
-    rawWriter.close();
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
 }
 
 void PhysicalLocalWriter::flush() {
-    rawWriter.flush();
+    // the content is written to the file without user-space buffering
 }
 
 std::string PhysicalLocalWriter::getPath() const {
@@ -52,6 +52,10 @@ std::string ConfigFactory::getProperty(std::string key) {
 	return prop[key];
 }
 
+void ConfigFactory::addProperty(std::string key, std::string value) {
+	prop[key] = value;
+}
+
 bool ConfigFactory::boolCheckProperty(std::string key) {
 	if(getProperty(key) == "true") {
 		return true;
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "utils/ThreadPool.h"
+#include "utils/ConfigFactory.h"
+
+ThreadPool & ThreadPool::Instance() {
+    static ThreadPool instance([]() {
+        int numThreads = std::stoi(ConfigFactory::Instance().getProperty("writer.threads"));
+        if (numThreads <= 0) {
+            numThreads = (int) std::max(1u, std::thread::hardware_concurrency());
+        }
+        return numThreads;
+    }(), 0);
+    return instance;
+}
+
+ThreadPool & ThreadPool::FlushInstance() {
+    // each writer has at most one row group being flushed, so one worker per encoding thread is enough
+    static ThreadPool instance(Instance().getThreadNum(), 0);
+    return instance;
+}
+
+ThreadPool::ThreadPool(int numThreads, int queueCapacity) {
+    // by default, each worker has a few tasks queued so that it does not wait for the producers
+    this->queueCapacity = queueCapacity > 0 ? queueCapacity : 4 * numThreads;
+    stopped = false;
+    for (int i = 0; i < numThreads; i++) {
+        workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopped = true;
+    }
+    notEmpty.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+    std::packaged_task<void()> packagedTask(std::move(task));
+    std::future<void> future = packagedTask.get_future();
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        notFull.wait(guard, [this]() { return tasks.size() < queueCapacity; });
+        tasks.emplace_back(std::move(packagedTask));
+    }
+    notEmpty.notify_one();
+    return future;
+}
+
+int ThreadPool::getThreadNum() const {
+    return (int) workers.size();
+}
+
+void ThreadPool::work() {
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            notEmpty.wait(guard, [this]() { return stopped || !tasks.empty(); });
+            if (tasks.empty()) {
+                // stopped and all the queued tasks are done
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        notFull.notify_one();
+        task();
+    }
+}
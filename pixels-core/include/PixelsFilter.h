@@ -12,6 +12,7 @@
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 #include "PixelsBitMask.h"
 #include "vector/ColumnVector.h"
 #include "TypeDescription.h"
@@ -26,17 +27,64 @@ public:
                             PixelsBitMask& filterMask,
                             std::shared_ptr<TypeDescription> type);
 
+    /**
+     * Apply the filter to the rows [start, start + length) of the vector. The bits of the other rows
+     * in filterMask are not changed.
+     */
+    static void ApplyFilter(std::shared_ptr<ColumnVector> vector, duckdb::TableFilter &filter,
+                            PixelsBitMask& filterMask,
+                            std::shared_ptr<TypeDescription> type, int start, int length);
+
+    /**
+     * Check whether a column chunk might have the rows matching the filter by the Bloom filter of the chunk.
+     * Only the equality comparisons and their conjunctions, e.g., IN-lists, can be ruled out.
+     * @param bloomFilter the serialized Bloom filter of the column chunk
+     * @return false if no row in the column chunk matches the filter
+     */
+    static bool BloomFilterMightMatch(const duckdb::TableFilter &filter, const std::string &bloomFilter,
+                                      const std::shared_ptr<TypeDescription> &type);
+
+    /**
+     * Hash the constant in the same way as the values of the column are hashed for Bloom filters and hash partitioning.
+     * @return false if the type of the column is not supported
+     */
+    static bool HashConstant(const duckdb::Value &constant, const std::shared_ptr<TypeDescription> &type, uint64_t &hash);
+
+    /**
+     * Collect the hashes of the constants that the matching values of the filter must be equal to,
+     * e.g., the constants of an equality comparison or an IN-list.
+     * @return false if the filter does not restrict the values to a set of constants
+     */
+    static bool EqualityConstantHashes(const duckdb::TableFilter &filter, const std::shared_ptr<TypeDescription> &type,
+                                       std::vector<uint64_t> &hashes);
+
     template <class T, class OP>
     static int CompareAvx2(void * data, T constant);
 
+    /**
+     * Compare values[start, start + length) with the constant, 8 values at a time from the first
+     * row that is a multiple of 8.
+     */
+    template <class T, class OP, class V>
+    static void FilterValues(const V * values, T constant, PixelsBitMask &filter_mask, int start, int length);
+
     template <class T, class OP>
     static void TemplatedFilterOperation(std::shared_ptr<ColumnVector> vector,
                             const duckdb::Value &constant, PixelsBitMask &filter_mask,
-                            std::shared_ptr<TypeDescription> type);
+                            std::shared_ptr<TypeDescription> type, int start, int length);
+
+    /**
+     * Filter the decimals with precision larger than 18, whose values are compared as hugeint_t.
+     */
+    template <class OP>
+    static void LongDecimalFilterOperation(std::shared_ptr<ColumnVector> vector,
+                                           const duckdb::Value &constant, PixelsBitMask &filter_mask,
+                                           int start, int length);
 
     template <class OP>
     static void FilterOperationSwitch(std::shared_ptr<ColumnVector> vector, duckdb::Value &constant,
-                                      PixelsBitMask &filter_mask, std::shared_ptr<TypeDescription> type);
+                                      PixelsBitMask &filter_mask, std::shared_ptr<TypeDescription> type,
+                                      int start, int length);
 
 };
 #endif //DUCKDB_PIXELSFILTER_H
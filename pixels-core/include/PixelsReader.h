@@ -44,6 +44,17 @@ public:
 	virtual std::string getWriterTimeZone() = 0;
 	virtual int getRowGroupNum() = 0;
 	virtual bool isPartitioned() = 0;
+    /**
+     * Get the partition key columns of the hash partitioned file, so that the rows of the file
+     * do not have to be repartitioned to join with another file partitioned in the same way.
+     *
+     * @return the indexes of the partition key columns in the file schema, empty if the file is not hash partitioned
+     */
+	virtual std::vector<int> getPartitionKeyColumns() = 0;
+    /**
+     * @return the number of hash partitions of the file, 0 if the file is not hash partitioned
+     */
+	virtual int getNumPartitions() = 0;
 	virtual ColumnStatisticList getColumnStats() = 0;
 	virtual pixels::proto::ColumnStatistic getColumnStat(std::string columnName) = 0;
 	virtual RowGroupInfoList getRowGroupInfos() = 0;
@@ -33,6 +33,8 @@ public:
 	std::string getWriterTimeZone() override;
 	int getRowGroupNum() override;
 	bool isPartitioned() override;
+	std::vector<int> getPartitionKeyColumns() override;
+	int getNumPartitions() override;
 	ColumnStatisticList getColumnStats() override;
 	pixels::proto::ColumnStatistic getColumnStat(std::string columnName) override;
 	RowGroupInfoList getRowGroupInfos() override;
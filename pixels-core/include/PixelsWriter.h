@@ -39,6 +39,16 @@ public:
      */
     virtual bool addRowBatch(std::shared_ptr<VectorizedRowBatch> rowBatch) = 0;
 
+    /**
+     * Add row batch into the file that is hash partitioned. All the rows in the row batch must be in the
+     * partition of the hash value, and the rows of different partitions are never put into the same row group.
+     *
+     * @param rowBatch the row batch to be written.
+     * @param hashValue the hash value (index) of the partition of the rows in the row batch.
+     * @return if the file adds a new row group, returns false. Otherwise, returns true.
+     */
+    virtual bool addRowBatch(std::shared_ptr<VectorizedRowBatch> rowBatch, int hashValue) = 0;
+
     virtual void close() = 0;
 
 //    /**
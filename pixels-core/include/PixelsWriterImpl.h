@@ -29,6 +29,7 @@
 #include "physical/PhysicalWriter.h"
 #include "writer/PixelsWriterOption.h"
 #include "writer/ColumnWriter.h"
+#include "writer/SortedRowBuffer.h"
 #include "utils/ConfigFactory.h"
 #include "stats/StatsRecorder.h"
 #include "pixels-common/pixels.pb.h"
@@ -36,17 +37,34 @@
 #include <unicode/timezone.h>
 #include <unicode/unistr.h>
 #include <unicode/locid.h>
+#include <future>
+#include <atomic>
 
 class PixelsWriterImpl : public PixelsWriter {
 public:
     PixelsWriterImpl(std::shared_ptr<TypeDescription> schema, int pixelsStride, int rowGroupSize,
                      const std::string &targetFilePath, int blockSize, bool blockPadding,
                      EncodingLevel encodingLevel, bool nullsPadding,bool partitioned, int compressionBlockSize);
+    ~PixelsWriterImpl() override;
     bool addRowBatch(std::shared_ptr<VectorizedRowBatch> rowBatch) override;
+    bool addRowBatch(std::shared_ptr<VectorizedRowBatch> rowBatch, int hashValue) override;
     void writeColumnVectors(std::vector<std::shared_ptr<ColumnVector>> &columnVectors, int rowBatchSize);
-    void writeRowGroup();
+    /**
+     * Flush the column chunks of the given column writers as a row group. The column chunks are
+     * flushed and compressed on ThreadPool::Instance(), so it must not be called on that pool.
+     */
+    void writeRowGroup(std::vector<std::shared_ptr<ColumnWriter>> rowGroupWriters, int rowGroupNumOfRows, int hashValue);
     void writeFileTail();
     void close() override;
+    /**
+     * The option shared by the column writers, e.g., to set the compression level of a column.
+     */
+    std::shared_ptr<PixelsWriterOption> getColumnWriterOption();
+    /**
+     * Request this writer to flush the current row group when the next row batch is added.
+     * It is called by the WriterMemoryManager when the memory budget of the writers is exceeded.
+     */
+    void requestRowGroupFlush();
 
 private:
     /**
@@ -58,6 +76,41 @@ private:
      */
     static const std::vector<uint8_t> CHUNK_PADDING_BUFFER;
 
+    /**
+     * Compress the segments of a column chunk into the compressed buffer, columnId is the index of the column
+     * in the children of the schema. The chunks of nested columns are compressed with the level of their
+     * top-level column.
+     * @return false if compression is disabled or does not shrink the chunk, the content should be kept as is
+     */
+    bool compressColumnChunk(int columnId, const std::vector<struct iovec> &content, std::vector<uint8_t> &compressed);
+    void newColumnWriters();
+    /**
+     * Create the recorders of the file statistics of the type and its nested types in pre-order.
+     */
+    void newFileColStatRecorders(const std::shared_ptr<TypeDescription>& type);
+    /**
+     * Encode the rows of the row batch into the current row group, and flush the row group if it is full.
+     * @return false if a new row group is added
+     */
+    bool writeRowBatch(const std::shared_ptr<VectorizedRowBatch> &rowBatch);
+    /**
+     * Hand the current row group over to the flush stage and continue with the spare column writers.
+     */
+    void flushRowGroup();
+    /**
+     * Reset the column writers of a flushed row group and keep them as the spare column writers.
+     * It is called by the flush stage, also when the row group fails to be written.
+     */
+    void recycleColumnWriters(const std::vector<std::shared_ptr<ColumnWriter>>& rowGroupWriters);
+    /**
+     * Encode the rows buffered in the sort buffer in the order of the sort keys.
+     */
+    void writeSortedRows();
+    /**
+     * Wait until the row group being flushed in the background is written.
+     */
+    void waitForPendingRowGroup();
+
     std::shared_ptr<TypeDescription> schema;
     int rowGroupSize;
     pixels::proto::CompressionKind compressionKind;
@@ -65,21 +118,44 @@ private:
     // std::unique_ptr<icu::TimeZone> timeZone;
     std::shared_ptr<PixelsWriterOption> columnWriterOption;
     std::vector<std::shared_ptr<ColumnWriter>> columnWriters;
-    std::vector<StatsRecorder> fileColStatRecorders;
-    std::int64_t fileContentLength;
-    int fileRowNum;
+    /**
+     * The column writers of the last flushed row group, reset for reuse. They are set by the flush stage
+     * and taken after waiting for it.
+     */
+    std::vector<std::shared_ptr<ColumnWriter>> spareColumnWriters;
+    /**
+     * The statistics of each column in the file, in the order of the column chunks in the row groups.
+     * They are merged from the statistics of the column chunks when each row group is written.
+     */
+    std::vector<std::unique_ptr<StatsRecorder>> fileColStatRecorders;
+    std::int64_t fileContentLength = 0;
+    int fileRowNum = 0;
     std::int64_t writtenBytes = 0;
     std::int64_t curRowGroupOffset = 0;
     std::int64_t curRowGroupFooterOffset = 0;
     std::int64_t curRowGroupNumOfRows = 0;
-    int curRowGroupDataLength = 0;
-    bool haseValueIsSet = false;
+    std::int64_t curRowGroupDataLength = 0;
+    std::int64_t curRowGroupBloomFilterBytes = 0;
+    std::atomic<bool> rowGroupFlushRequested{false};
+    /**
+     * The hash value of the partition that the rows of the current row group are in, if the file is hash partitioned.
+     */
+    bool hashValueIsSet = false;
     int currHashValue = 0;
     bool partitioned;
     std::vector<pixels::proto::RowGroupInformation> rowGroupInfoList;
     std::vector<pixels::proto::RowGroupStatistic> rowGroupStatisticList;
     std::shared_ptr<PhysicalWriter> physicalWriter;
     std::vector<std::shared_ptr<TypeDescription>> children;
+    /**
+     * The flush of the previous row group, which overlaps the encoding of the current row group.
+     */
+    std::future<void> pendingRowGroup;
+    /**
+     * The rows of the current row group if the writer option has sort key columns, they are
+     * encoded in the sorted order when the row group is full.
+     */
+    std::unique_ptr<SortedRowBuffer> sortBuffer;
 
 };
 #endif //PIXELS_PIXELSWRITERIMPL_H
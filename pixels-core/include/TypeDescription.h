@@ -42,8 +42,14 @@
 #include "vector/ByteColumnVector.h"
 #include "vector/BinaryColumnVector.h"
 #include "vector/DecimalColumnVector.h"
+#include "vector/LongDecimalColumnVector.h"
 #include "vector/DateColumnVector.h"
+#include "vector/TimeColumnVector.h"
+#include "vector/VectorColumnVector.h"
 #include "vector/TimestampColumnVector.h"
+#include "vector/DoubleColumnVector.h"
+#include "vector/StructColumnVector.h"
+#include "vector/ListColumnVector.h"
 
 struct CategoryProperty {
     bool isPrimitive;
@@ -69,7 +75,9 @@ public:
         BINARY,
         VARCHAR,
         CHAR,
-        STRUCT
+        STRUCT,
+        VECTOR,
+        ARRAY
     };
     class StringPosition {
         friend class TypeDescription;
@@ -100,6 +108,12 @@ public:
     static std::shared_ptr<TypeDescription> createVarchar();
     static std::shared_ptr<TypeDescription> createChar();
     static std::shared_ptr<TypeDescription> createStruct();
+    static std::shared_ptr<TypeDescription> createVector(int dimension);
+    static std::shared_ptr<TypeDescription> createArray(const std::shared_ptr<TypeDescription>& element);
+    /**
+     * Create the schema from the types in the file footer. The types of nested columns are flattened
+     * in pre-order, so the top-level columns are the types that are not the subtypes of any other type.
+     */
     static std::shared_ptr<TypeDescription> createSchema(const std::vector<std::shared_ptr<pixels::proto::Type>>& types);
     std::shared_ptr<TypeDescription> addField(const std::string& field, const std::shared_ptr<TypeDescription>& fieldType);
     void setParent(const std::shared_ptr<TypeDescription>& p);
@@ -110,6 +124,7 @@ public:
     static int parseInt(StringPosition &source);
     static std::string parseName(StringPosition &source);
     static void parseStruct(std::shared_ptr<TypeDescription> type, StringPosition &source);
+    static void parseArray(std::shared_ptr<TypeDescription> type, StringPosition &source);
     static Category parseCategory(StringPosition &source);
     static std::shared_ptr<TypeDescription> parseType(StringPosition &source);
     static std::shared_ptr<TypeDescription> fromString(const std::string &typeName);
@@ -123,6 +138,20 @@ public:
     TypeDescription withMaxLength(int maxLength);
 
     int getMaxLength();
+    TypeDescription withDimension(int dimension);
+    int getDimension();
+    /**
+     * Get the id of this type, which is its index in the pre-order traversal of the schema (the root is 0).
+     * Each type except the root is stored in the column chunk of index getId() - 1 in the row groups,
+     * and the column chunks of its descendants are in (getId() - 1, getMaximumId() - 1].
+     */
+    int getId();
+    int getMaximumId();
+    /**
+     * Deep copy this type and its descendants, the copy has no parent.
+     */
+    std::shared_ptr<TypeDescription> clone();
+    std::shared_ptr<ColumnVector> createColumn(int maxSize, bool useEncodedVector);
     static std::map<Category, CategoryProperty> categoryMap;
 
     static int SHORT_DECIMAL_MAX_PRECISION;
@@ -149,14 +178,18 @@ public:
     static int MAX_TIMESTAMP_PRECISION;
 
     static int MAX_TIME_PRECISION;
+    static int MAX_VECTOR_DIMENSION;
 
     void writeTypes(std::shared_ptr<pixels::proto::Footer> footer);
 
 
 
 private:
-    std::shared_ptr<ColumnVector> createColumn(int maxSize, bool useEncodedVector);
     std::shared_ptr<ColumnVector> createColumn(int maxSize, std::vector<bool> useEncodedVector);
+    static std::shared_ptr<TypeDescription> createType(const std::vector<std::shared_ptr<pixels::proto::Type>>& types, uint32_t index);
+    static void writeType(const std::shared_ptr<pixels::proto::Footer>& footer, const std::string& name,
+                          const std::shared_ptr<TypeDescription>& type);
+    int assignIds(int startId);
     static long serialVersionUID;
     int id;
     int maxId;
@@ -169,5 +202,6 @@ private:
     uint32_t maxLength;
     uint32_t precision;
     uint32_t scale;
+    uint32_t dimension;
 };
 #endif //PIXELS_TYPEDESCRIPTION_H
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_BYTESTREAMSPLIT_H
+#define PIXELS_BYTESTREAMSPLIT_H
+
+#include <cstdint>
+
+/**
+ * Byte stream split encoding of fixed-width values, e.g., floats and doubles.
+ * The k-th bytes of the values are stored together in the k-th stream, so that the
+ * exponents and the high bytes of the mantissas, which repeat a lot, are compressed well.
+ * The encoded size equals the plain size, the streams are stored one after another.
+ */
+class ByteStreamSplit {
+public:
+    /**
+     * @param values the plain values in little endian
+     * @param numValues the number of values
+     * @param width the width of each value in bytes
+     * @param streams the output, which has numValues * width bytes
+     */
+    static void encode(const uint8_t *values, int numValues, int width, uint8_t *streams);
+
+    /**
+     * Decode a range of the values, so that a pixel can be read in several batches.
+     * @param streams the position of the first value to decode in the first stream
+     * @param streamLength the length of each stream, i.e., the number of values encoded
+     * @param numValues the number of values to decode
+     * @param width the width of each value in bytes
+     * @param values the output, which has numValues * width bytes
+     */
+    static void decode(const uint8_t *streams, int streamLength, int numValues, int width, uint8_t *values);
+};
+#endif //PIXELS_BYTESTREAMSPLIT_H
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_ENCODINGSELECTOR_H
+#define PIXELS_ENCODINGSELECTOR_H
+
+#include "pixels-common/pixels.pb.h"
+
+/**
+ * Chooses the encoding of a column chunk by a simple cost model: the estimated size of the chunk
+ * plus the cost of decoding it, both measured in bytes. Decoding costs are per value for integer
+ * encodings and per decoded byte for FSST. Plain (NONE) encoding is read zero-copy, so its cost
+ * is its size only.
+ * <p>
+ * Integer writers sample the first pixel of each column chunk, while string writers decide when
+ * the chunk is flushed, as the string content is buffered until then anyway.
+ */
+class EncodingSelector {
+public:
+    /**
+     * @param numValues the number of values in the sample
+     * @param plainSize the size of the sample without encoding
+     * @param runLengthSize the size of the sample in run-length encoding
+     */
+    static pixels::proto::ColumnEncoding::Kind selectIntegerEncoding(int numValues, long plainSize, long runLengthSize);
+    /**
+     * @param bitPackedSize the size of the sample with one bit per value
+     * @param runLengthSize the size of the sample in run-length encoding
+     */
+    static pixels::proto::ColumnEncoding::Kind selectBooleanEncoding(long bitPackedSize, long runLengthSize);
+    /**
+     * @param dictionarySize the size in dictionary encoding, or a negative value if not applicable
+     * @param fsstSize the size in FSST encoding, or a negative value if not applicable
+     */
+    static pixels::proto::ColumnEncoding::Kind selectStringEncoding(int numValues, long plainSize,
+                                                                    long dictionarySize, long fsstSize);
+
+private:
+    /**
+     * Run-length decoding of one value costs about as much as reading half a byte more.
+     */
+    static const double RUNLENGTH_DECODE_COST_PER_VALUE;
+    /**
+     * Dictionary encoded strings are referenced in the dictionary without copy, only the ids
+     * are run-length decoded.
+     */
+    static const double DICTIONARY_DECODE_COST_PER_VALUE;
+    static const double FSST_DECODE_COST_PER_BYTE;
+    /**
+     * Bit-packed booleans are unpacked by SIMD and filtered without unpacking, so run-length encoding
+     * is only chosen for long runs, i.e., if it is this many times smaller.
+     */
+    static const int BOOLEAN_RUNLENGTH_MIN_RATIO;
+};
+#endif //PIXELS_ENCODINGSELECTOR_H
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_FSSTDECODER_H
+#define PIXELS_FSSTDECODER_H
+
+#include <cstdint>
+
+/**
+ * Decodes strings encoded by FsstEncoder. Strings are decoded independently of each other,
+ * so callers only pay for the strings they actually materialize.
+ */
+class FsstDecoder {
+public:
+    /**
+     * @param symbolTable the serialized symbol table written by FsstEncoder::writeSymbolTable
+     */
+    FsstDecoder(const uint8_t *symbolTable, int length);
+    /**
+     * Decode a string, dst must have room for maxDecodedLength(length) bytes.
+     * @return the length of the decoded string
+     */
+    int decode(const uint8_t *src, int length, uint8_t *dst) const;
+    /**
+     * Symbols are copied as whole 8-byte words, hence the extra bytes after the decoded string.
+     */
+    static int maxDecodedLength(int length);
+
+private:
+    uint64_t symbols[256];
+    uint8_t lengths[256];
+};
+#endif //PIXELS_FSSTDECODER_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_FSSTENCODER_H
+#define PIXELS_FSSTENCODER_H
+
+#include "encoding/Encoder.h"
+#include "physical/natives/SegmentedOutputStream.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * FSST (Fast Static Symbol Table) string compression, see Boncz et al., VLDB 2020.
+ * <p>
+ * A symbol table maps up to 255 one-byte codes to symbols of 1 to 8 bytes. A string is encoded
+ * as a sequence of codes, bytes that are not covered by any symbol are written as the escape code
+ * followed by the byte itself. Each string is encoded independently, so any string can be decoded
+ * on its own given its encoded start and length.
+ * <p>
+ * The serialized symbol table is one byte for the number of symbols, one byte per symbol for
+ * its length, followed by the concatenated symbol bytes.
+ */
+class FsstEncoder : public Encoder {
+public:
+    static const int MAX_SYMBOLS = 255;
+    static const int MAX_SYMBOL_LENGTH = 8;
+    static const uint8_t ESCAPE_CODE = 255;
+
+    FsstEncoder();
+    /**
+     * Build the symbol table from a sample of strings.
+     * @param content the string bytes
+     * @param starts the start offset of each string in content, plus the end offset of the last one
+     * @param numStrings the number of strings
+     */
+    void train(const uint8_t *content, const int *starts, int numStrings);
+    /**
+     * Encode a string, dst must have room for maxEncodedLength(length) bytes.
+     * @return the number of bytes written into dst
+     */
+    int encode(const uint8_t *src, int length, uint8_t *dst) const;
+    static int maxEncodedLength(int length);
+    int getSymbolTableSize() const;
+    void writeSymbolTable(std::shared_ptr<SegmentedOutputStream> out) const;
+
+private:
+    struct Symbol {
+        uint64_t value;
+        int length;
+    };
+    std::vector<Symbol> symbols;
+    /**
+     * The codes of the symbols starting with each byte, longest symbols first.
+     */
+    std::vector<uint8_t> codesByFirstByte[256];
+
+    void buildIndex();
+    /**
+     * @return the code of the longest symbol that prefixes src, or -1 if no symbol matches
+     */
+    int findLongestSymbol(const uint8_t *src, int remaining) const;
+};
+#endif //PIXELS_FSSTENCODER_H
@@ -17,6 +17,12 @@ public:
     RunLenIntDecoder(const std::shared_ptr<ByteBuffer>& bb, bool isSigned);
     void close() override;
     long next() override;
+    /**
+     * Decode the next len values into buffer, starting at offset.
+     * Runs are copied from the literal buffer in bulk instead of
+     * one value per call.
+     */
+    void next(long * buffer, int offset, int len);
 	bool hasNext() override;
     ~RunLenIntDecoder();
 private:
@@ -24,6 +30,7 @@ private:
     void readValues();
 	void readShortRepeatValues(int firstByte);
     void readDirectValues(int firstByte);
+	void readPatchedBaseValues(int firstByte);
 	void readDeltaValues(int firstByte);
 	long readVulong(const std::shared_ptr<ByteBuffer>& input);
 	long readVslong(const std::shared_ptr<ByteBuffer>& input);
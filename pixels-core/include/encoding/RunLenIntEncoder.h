@@ -38,6 +38,12 @@ public:
     void encode(int* values, int offset, int length, byte* results, int& resultLength);
     void encode(long* values, byte* results, int length, int& resultLength);
     void encode(int* values, byte* results, int length, int& resultLength);
+    /**
+     * The upper bound of the encoded size of length values, i.e., every value
+     * bit-packed in 64 bits plus the header, base and patch list of each run.
+     * The result buffer passed to encode() should be at least this large.
+     */
+    static int getMaxEncodedSize(int length);
     // -----------------------------------------------------------
     void determineEncoding();
     // -----------------------------------------------------------
@@ -69,6 +75,7 @@ public:
 
 // -----------------------------------------------------------
 private:
+    void ensureOutputStream(int length);
     EncodingType encodingType;
     int numLiterals;
     int fixedRunLength;
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIXELS_ARRAYCOLUMNREADER_H
+#define PIXELS_ARRAYCOLUMNREADER_H
+
+#include "reader/ColumnReader.h"
+#include "vector/ListColumnVector.h"
+
+/**
+ * The reader of ARRAY column chunks. The chunk of the array has the number of elements of each row,
+ * from which the range of the elements is found and read from the element column chunk into the child
+ * vector by the element reader.
+ */
+class ArrayColumnReader: public ColumnReader {
+public:
+    explicit ArrayColumnReader(std::shared_ptr<TypeDescription> type);
+    void close() override;
+    void read(std::shared_ptr<ByteBuffer> input,
+              pixels::proto::ColumnEncoding & encoding,
+              int offset, int size, int pixelStride,
+              int vectorIndex, std::shared_ptr<ColumnVector> vector,
+              pixels::proto::ColumnChunkIndex & chunkIndex,
+              std::shared_ptr<PixelsBitMask> filterMask) override;
+    /**
+     * Read the lengths and validity of the rows, then read the elements of the rows at once.
+     * The child vector is enlarged if it can not hold the elements of the row batch.
+     */
+    void readRange(std::shared_ptr<ByteBuffer> input,
+                   pixels::proto::ColumnEncoding & encoding,
+                   int offset, int size, int pixelStride,
+                   int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                   pixels::proto::ColumnChunkIndex & chunkIndex,
+                   std::shared_ptr<PixelsBitMask> filterMask) override;
+    int setChildChunks(const std::vector<ChildColumnChunk> & chunks, int start) override;
+private:
+    std::shared_ptr<TypeDescription> elementType;
+    std::shared_ptr<ColumnReader> elementReader;
+    ChildColumnChunk elementChunk;
+    // the index of the next element to read in the element column chunk
+    int elementPosition;
+};
+#endif //PIXELS_ARRAYCOLUMNREADER_H
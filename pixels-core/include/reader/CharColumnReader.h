@@ -8,8 +8,36 @@
 #include "reader/StringColumnReader.h"
 #include "reader/ColumnReader.h"
 
+/**
+ * The reader of CHAR(n) column chunks. The fixed-width chunks are read in place, each value
+ * refers to its n bytes in the chunk buffer without the trailing spaces. The chunks in other
+ * encodings are read as strings.
+ */
 class CharColumnReader: public StringColumnReader {
 public:
     explicit CharColumnReader(std::shared_ptr<TypeDescription> type);
+    void read(std::shared_ptr<ByteBuffer> input,
+              pixels::proto::ColumnEncoding & encoding,
+              int offset, int size, int pixelStride,
+              int vectorIndex, std::shared_ptr<ColumnVector> vector,
+              pixels::proto::ColumnChunkIndex & chunkIndex,
+              std::shared_ptr<PixelsBitMask> filterMask) override;
+    /**
+     * @return the length of the value without the trailing spaces
+     */
+    static int trimmedLength(const uint8_t * value, int length);
+private:
+    /**
+     * Read kernels of fixed-width chunks, specialized on whether the pixel has nulls and
+     * whether a filter is applied, indexed by ColumnReader::kernelIndex.
+     */
+    typedef void (CharColumnReader::*FixedWidthKernel)(const std::shared_ptr<BinaryColumnVector> & columnVector,
+                                                       uint8_t * values, int vectorIndex, int size,
+                                                       bool nullsPadding, PixelsBitMask * filterMask);
+    static const FixedWidthKernel fixedWidthKernels[4];
+    template <bool HAS_NULLS, bool FILTERED>
+    void readFixedWidth(const std::shared_ptr<BinaryColumnVector> & columnVector, uint8_t * values,
+                        int vectorIndex, int size, bool nullsPadding, PixelsBitMask * filterMask);
+    int maxLength;
 };
 #endif //PIXELS_CHARCOLUMNREADER_H
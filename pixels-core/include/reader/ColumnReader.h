@@ -12,6 +12,16 @@
 #include "duckdb.h"
 #include "duckdb/common/types/vector.hpp"
 #include "PixelsFilter.h"
+#include <cstring>
+
+/**
+ * A column chunk of the current row group, which is read by the reader of a nested column.
+ */
+struct ChildColumnChunk {
+    std::shared_ptr<ByteBuffer> input;
+    std::shared_ptr<pixels::proto::ColumnEncoding> encoding;
+    std::shared_ptr<pixels::proto::ColumnChunkIndex> chunkIndex;
+};
 
 class ColumnReader {
 public:
@@ -44,7 +54,92 @@ public:
                       pixels::proto::ColumnChunkIndex & chunkIndex,
                       std::shared_ptr<PixelsBitMask> filterMask);
 
-    void setValid(const std::shared_ptr<ByteBuffer>& input, int pixelStride, const std::shared_ptr<ColumnVector>& columnVector, int pixelId, bool hasNull);
+    /**
+     * Read values that may span several pixels. [offset, offset + size) is split at the pixel boundaries
+     * and each part is read by {@link #read}, so the values of several pixels are put into one vector.
+     */
+    virtual void readRange(std::shared_ptr<ByteBuffer> input,
+                   pixels::proto::ColumnEncoding & encoding,
+                   int offset, int size, int pixelStride,
+                   int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                   pixels::proto::ColumnChunkIndex & chunkIndex,
+                   std::shared_ptr<PixelsBitMask> filterMask);
+
+    /**
+     * Set the column chunks of the nested columns of this reader in the current row group.
+     * chunks are the column chunks of the descendants in pre-order, the chunks from start are taken
+     * by this reader and its descendants.
+     *
+     * @return the index of the first chunk that is not taken
+     */
+    virtual int setChildChunks(const std::vector<ChildColumnChunk> & chunks, int start) { return start; }
+
+    /**
+     * Set the validity mask of [vectorIndex, vectorIndex + size) in the column vector from the isNull bitmap
+     * of the pixel, starting from the current element in the pixel. If the pixel has no null, the bitmap is
+     * skipped and the column vector is marked as noNulls when it is the first part of the vector.
+     * The bitmap of the pixel is passed over when the last element of the pixel is read.
+     *
+     * @return the number of nulls in [vectorIndex, vectorIndex + size)
+     */
+    int setValid(const std::shared_ptr<ByteBuffer>& input, int pixelStride, const std::shared_ptr<ColumnVector>& columnVector,
+                 int pixelId, bool hasNull, int vectorIndex, int size);
+
+    /**
+     * Move the numValues values at the beginning of values to the non-null positions in [0, size).
+     * It is used when the nulls are not padded in the column chunk. values starts from vectorIndex in the vector.
+     */
+    template <typename T>
+    static void scatterNonNulls(T * values, int numValues, int size, const std::shared_ptr<ColumnVector>& columnVector,
+                                int vectorIndex) {
+        for(int i = size - 1; i >= 0 && numValues < i + 1; i--) {
+            if(columnVector->checkValid(vectorIndex + i)) {
+                values[i] = values[--numValues];
+            }
+        }
+    }
+
+    /**
+     * Copy the stored values to the non-null positions in [0, size) of values in a single pass.
+     * It is used when the nulls are not padded in the column chunk, src holds the non-null values only.
+     * If FILTERED, the positions not selected by the filter mask are left unset.
+     */
+    template <typename T, typename S, bool FILTERED>
+    static void gatherNonNulls(const S * src, T * values, int size, const std::shared_ptr<ColumnVector>& columnVector,
+                               int vectorIndex, PixelsBitMask * filterMask) {
+        int numValues = 0;
+        for(int i = 0; i < size; i++) {
+            if(columnVector->checkValid(vectorIndex + i)) {
+                S value = src[numValues++];
+                if(!FILTERED || filterMask->get(vectorIndex + i)) {
+                    values[i] = (T) value;
+                }
+            }
+        }
+    }
+
+    /**
+     * The index of the read kernel specialized on whether the pixel has nulls and whether a filter is applied.
+     * Readers with specialized kernels keep them in an array of four, selected once per column chunk.
+     */
+    static int kernelIndex(bool hasNulls, bool filtered) {
+        return (hasNulls ? 2 : 0) | (filtered ? 1 : 0);
+    }
+
+    /**
+     * Switch the values of the vector from the chunk buffer (zero-copy) to the decoded buffer of the vector.
+     * The values before vectorIndex, which are read from the previous pixels, are copied to the decoded buffer.
+     * width is the number of elements of type T per value.
+     */
+    template <typename T>
+    static void useDecodedBuffer(T *& values, T * decoded, int vectorIndex, int width = 1) {
+        if(values != decoded) {
+            if(vectorIndex > 0 && values != nullptr) {
+                std::memmove(decoded, values, (size_t) vectorIndex * width * sizeof(T));
+            }
+            values = decoded;
+        }
+    }
 
 protected:
     int elementIndex;
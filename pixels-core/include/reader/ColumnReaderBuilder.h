@@ -10,8 +10,15 @@
 #include "reader/CharColumnReader.h"
 #include "reader/VarcharColumnReader.h"
 #include "reader/DecimalColumnReader.h"
+#include "reader/LongDecimalColumnReader.h"
 #include "reader/DateColumnReader.h"
+#include "reader/TimeColumnReader.h"
 #include "reader/TimestampColumnReader.h"
+#include "reader/DoubleColumnReader.h"
+#include "reader/ByteColumnReader.h"
+#include "reader/VectorColumnReader.h"
+#include "reader/StructColumnReader.h"
+#include "reader/ArrayColumnReader.h"
 
 class ColumnReaderBuilder {
 public:
@@ -6,6 +6,9 @@
 #define PIXELS_DECIMALCOLUMNREADER_H
 
 #include "reader/ColumnReader.h"
+#include "encoding/RunLenIntDecoder.h"
+#include "vector/DecimalColumnVector.h"
+#include <vector>
 
 class DecimalColumnReader: public ColumnReader {
 public:
@@ -19,9 +22,26 @@ public:
               std::shared_ptr<PixelsBitMask> filterMask) override;
 private:
     /**
-     * True if the data type of the values is long (int64), otherwise the data type is int32.
+     * A read kernel puts the numValues stored values of a pixel into [vectorIndex, vectorIndex + size)
+     * of the vector, specialized like the kernels of IntegerColumnReader.
      */
-    bool isLong;
+    typedef void (DecimalColumnReader::*Kernel)(const std::shared_ptr<ByteBuffer> & input,
+                                                const std::shared_ptr<DecimalColumnVector> & columnVector,
+                                                int vectorIndex, int size, int numValues, bool nullsPadding,
+                                                PixelsBitMask * filterMask);
+    Kernel kernels[4];
+    void selectKernels(pixels::proto::ColumnEncoding & encoding);
+    template <bool HAS_NULLS, bool FILTERED>
+    void readPlain(const std::shared_ptr<ByteBuffer> & input, const std::shared_ptr<DecimalColumnVector> & columnVector,
+                   int vectorIndex, int size, int numValues, bool nullsPadding, PixelsBitMask * filterMask);
+    template <bool HAS_NULLS, bool FILTERED>
+    void readRle(const std::shared_ptr<ByteBuffer> & input, const std::shared_ptr<DecimalColumnVector> & columnVector,
+                 int vectorIndex, int size, int numValues, bool nullsPadding, PixelsBitMask * filterMask);
+    std::shared_ptr<RunLenIntDecoder> decoder;
+    /**
+     * The run-length decoded values of a pixel whose nulls are not padded.
+     */
+    std::vector<long> decodeBuffer;
 };
 
 #endif //PIXELS_DECIMALCOLUMNREADER_H
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_DOUBLECOLUMNREADER_H
+#define PIXELS_DOUBLECOLUMNREADER_H
+
+#include "reader/ColumnReader.h"
+
+/**
+ * The reader of FLOAT and DOUBLE column chunks, which are either plain or byte-stream-split encoded.
+ */
+class DoubleColumnReader: public ColumnReader {
+public:
+	explicit DoubleColumnReader(std::shared_ptr<TypeDescription> type);
+	void close() override;
+	void read(std::shared_ptr<ByteBuffer> input,
+	          pixels::proto::ColumnEncoding & encoding,
+	          int offset, int size, int pixelStride,
+	          int vectorIndex, std::shared_ptr<ColumnVector> vector,
+	          pixels::proto::ColumnChunkIndex & chunkIndex,
+			  std::shared_ptr<PixelsBitMask> filterMask) override;
+private:
+	/**
+	 * The width of the values in bytes, 4 for FLOAT and 8 for DOUBLE.
+	 */
+	int width;
+	/**
+	 * The byte-stream-split streams of the current pixel and the index of the next value to read in them.
+	 */
+	int pixelStreamLength = 0;
+	int pixelValueIndex = 0;
+};
+
+#endif //PIXELS_DOUBLECOLUMNREADER_H
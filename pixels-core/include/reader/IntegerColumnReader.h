@@ -7,6 +7,7 @@
 
 #include "reader/ColumnReader.h"
 #include "encoding/RunLenIntDecoder.h"
+#include <vector>
 
 class IntegerColumnReader: public ColumnReader{
 public:
@@ -19,11 +20,46 @@ public:
               pixels::proto::ColumnChunkIndex & chunkIndex,
               std::shared_ptr<PixelsBitMask> filterMask) override;
 private:
+    /**
+     * A read kernel puts the numValues stored values of a pixel into [vectorIndex, vectorIndex + size)
+     * of the vector. It is specialized at compile time on the value width, the encoding of the column
+     * chunk, whether the pixel has nulls and whether a filter is applied.
+     */
+    typedef void (IntegerColumnReader::*Kernel)(const std::shared_ptr<ByteBuffer> & input,
+                                                const std::shared_ptr<LongColumnVector> & columnVector,
+                                                int vectorIndex, int size, int numValues, bool nullsPadding,
+                                                PixelsBitMask * filterMask);
+    Kernel kernels[4];
+    void selectKernels(pixels::proto::ColumnEncoding & encoding);
+    template <typename T>
+    void selectKernels(pixels::proto::ColumnEncoding & encoding);
+    /**
+     * Read plain values. The values are referenced in the chunk buffer (which is then pinned by the vector)
+     * if they are contiguous with the values already in the vector, otherwise they are copied into the
+     * decoded buffer.
+     */
+    template <typename T, bool HAS_NULLS, bool FILTERED>
+    void readPlain(const std::shared_ptr<ByteBuffer> & input, const std::shared_ptr<LongColumnVector> & columnVector,
+                   int vectorIndex, int size, int numValues, bool nullsPadding, PixelsBitMask * filterMask);
+    /**
+     * Read run-length encoded values, which are decoded in bulk into the decoded buffer.
+     */
+    template <typename T, bool HAS_NULLS, bool FILTERED>
+    void readRle(const std::shared_ptr<ByteBuffer> & input, const std::shared_ptr<LongColumnVector> & columnVector,
+                 int vectorIndex, int size, int numValues, bool nullsPadding, PixelsBitMask * filterMask);
+    static long *& values(LongColumnVector & columnVector, long *) { return columnVector.longVector; }
+    static int *& values(LongColumnVector & columnVector, int *) { return columnVector.intVector; }
+    static long * decoded(LongColumnVector & columnVector, long *) { return columnVector.decodedLongVector; }
+    static int * decoded(LongColumnVector & columnVector, int *) { return columnVector.decodedIntVector; }
     /**
      * True if the data type of the values is long (int64), otherwise the data type is int32.
      */
     bool isLong;
     std::shared_ptr<RunLenIntDecoder> decoder;
+    /**
+     * The run-length decoded values that can not be decoded into the vector in place.
+     */
+    std::vector<long> decodeBuffer;
 };
 
 
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef PIXELS_LONGDECIMALCOLUMNREADER_H
+#define PIXELS_LONGDECIMALCOLUMNREADER_H
+
+#include "reader/ColumnReader.h"
+
+/**
+ * The reader of decimal column chunks with precision larger than 18.
+ * A pixel is stored in 64-bit integers if the minimum and maximum in its statistics fit in 64 bits,
+ * otherwise it is stored in 128-bit integers, the lower 64 bits first.
+ */
+class LongDecimalColumnReader: public ColumnReader {
+public:
+	explicit LongDecimalColumnReader(std::shared_ptr<TypeDescription> type);
+	void close() override;
+	void read(std::shared_ptr<ByteBuffer> input,
+	          pixels::proto::ColumnEncoding & encoding,
+	          int offset, int size, int pixelStride,
+	          int vectorIndex, std::shared_ptr<ColumnVector> vector,
+	          pixels::proto::ColumnChunkIndex & chunkIndex,
+			  std::shared_ptr<PixelsBitMask> filterMask) override;
+	/**
+	 * @return true if the values of the pixel are stored in 64-bit integers
+	 */
+	static bool isNarrowPixel(const pixels::proto::ColumnStatistic & statistic);
+};
+
+#endif //PIXELS_LONGDECIMALCOLUMNREADER_H
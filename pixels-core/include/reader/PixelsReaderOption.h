@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include "duckdb/planner/table_filter.hpp"
+#include "reader/VectorPredicate.h"
 
 class PixelsReaderOption {
 public:
@@ -32,10 +33,16 @@ public:
     bool isTolerantSchemaEvolution();
     void setEnableEncodedColumnVector(bool enabled);
     bool isEnableEncodedColumnVector();
+    /**
+     * Push down a nearest-neighbour predicate on a VECTOR column. Each record reader evaluates its own copy.
+     */
+    void setVectorPredicate(std::shared_ptr<VectorPredicate> vectorPredicate);
+    std::shared_ptr<VectorPredicate> getVectorPredicate();
 private:
     std::vector<std::string> includedCols;
     duckdb::TableFilterSet * filter;
     // TODO: pixelsPredicate
+    std::shared_ptr<VectorPredicate> vectorPredicate;
     bool skipCorruptRecords;
     bool tolerantSchemaEvolution;     // this may lead to column missing due to schema evolution
     bool enableEncodedColumnVector;   // whether read encoded column vectors directly when possible
@@ -21,6 +21,7 @@
 #include "physical/BufferPool.h"
 #include "physical/natives/DirectUringRandomAccessFile.h"
 #include "PixelsFilter.h"
+#include "utils/Partitioner.h"
 
 class ChunkId {
 public:
@@ -57,9 +58,31 @@ public:
 private:
     std::vector<int64_t> bufferIds;
     void prepareRead();
+    /**
+     * @return the number of rows of a batch, i.e., batchSize if the target row groups have enough rows
+     */
+    int getBatchCapacity();
     void checkBeforeRead();
+    void decompressChunks();
+    /**
+     * Check the equality predicates on the result columns against the Bloom filters in the row group footer.
+     * @return false if the row group has no matching rows and can be skipped
+     */
+    bool rowGroupMightMatch(const pixels::proto::RowGroupFooter& rowGroupFooter);
+    /**
+     * Check the equality predicates on the partition key columns against the partition of the row group.
+     * @return false if the row group is in a hash partition that no matching row is in
+     */
+    bool rowGroupInPartition(const pixels::proto::RowGroupInformation& rowGroupInfo);
+    /**
+     * The maximum number of combinations of the constants of the partition keys checked by rowGroupInPartition,
+     * the row groups are not pruned by partitions if the IN-lists on the partition keys have more combinations.
+     */
+    static const int MAX_PARTITION_KEY_COMBINATIONS = 1024;
 	std::shared_ptr<VectorizedRowBatch> createEmptyEOFRowBatch(int size);
 	void UpdateRowGroupInfo();
+    std::shared_ptr<TypeDescription> findColumn(const std::string& column, std::string& name);
+    void setNestedColumnChunks();
     std::shared_ptr<PhysicalReader> physicalReader;
     pixels::proto::Footer footer;
     pixels::proto::PostScript postScript;
@@ -81,6 +104,15 @@ private:
 	int curRGRowCount;
     bool enabledFilterPushDown;
     std::shared_ptr<PixelsBitMask> filterMask;
+    /**
+     * The result of the filter of one column, which is combined into filterMask.
+     */
+    std::shared_ptr<PixelsBitMask> columnMask;
+    /**
+     * The vector predicate evaluated by this record reader and the index of its column in the result columns.
+     */
+    std::shared_ptr<VectorPredicate> vectorPredicate;
+    int vectorPredicateColumn;
 	std::shared_ptr<pixels::proto::RowGroupFooter> curRGFooter;
 	std::vector<std::shared_ptr<pixels::proto::ColumnEncoding>> curEncoding;
 	std::vector<int> curChunkBufferIndex;
@@ -97,16 +129,19 @@ private:
 
     // buffers of each chunk in this file, arranged by chunk's row group id and column id
     std::vector<std::shared_ptr<ByteBuffer>> chunkBuffers;
+    // whether some chunks in chunkBuffers are compressed and must be decompressed before reading
+    bool pendingDecompression = false;
     // column readers for each target columns
     std::vector<std::shared_ptr<ColumnReader>> readers;
     std::vector<uint32_t> targetColumns;
     std::vector<uint32_t> resultColumns;
+    // the end (exclusive) of the column chunk ids of each result column and its descendants
+    std::vector<uint32_t> resultColumnsEnd;
     std::vector<bool> resultColumnsEncoded;
     bool enableEncodedVector;
     std::vector<std::shared_ptr<pixels::proto::RowGroupFooter>> rowGroupFooters;
 
     int includedColumnNum; // the number of columns to read
-    std::vector<std::shared_ptr<pixels::proto::Type>> includedColumnTypes;
 
     std::shared_ptr<TypeDescription> fileSchema;
     std::shared_ptr<TypeDescription> resultSchema;
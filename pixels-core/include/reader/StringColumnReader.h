@@ -7,6 +7,9 @@
 
 #include "reader/ColumnReader.h"
 #include "encoding/RunLenIntDecoder.h"
+#include "encoding/FsstDecoder.h"
+#include "vector/BinaryColumnVector.h"
+#include <vector>
 
 class StringColumnReader: public ColumnReader {
 public:
@@ -45,6 +48,41 @@ private:
 
 	int * dictStarts;
     int startsLength;
+
+    std::shared_ptr<FsstDecoder> fsstDecoder;
+    /**
+     * The decoded FSST strings of the current row batch, which the column vector refers to.
+     * A block is never reallocated while it is referred to, a new block is added when it is full.
+     */
+    std::vector<std::vector<uint8_t>> decodeBlocks;
+    int decodeBlockUsed;
+    static const int DECODE_BLOCK_SIZE = 64 * 1024;
+    uint8_t * reserveDecodeBuffer(int length);
+    /**
+     * A read kernel decodes the strings of a pixel into the vector. It is specialized at compile time
+     * on the encoding of the column chunk, whether the pixel has nulls and whether a filter is applied,
+     * so that the dense, non-null and unfiltered case runs without per-row branches.
+     */
+    typedef void (StringColumnReader::*Kernel)(const std::shared_ptr<BinaryColumnVector> & columnVector,
+                                               int vectorIndex, int size, bool nullsPadding,
+                                               PixelsBitMask * filterMask);
+    Kernel kernels[4];
+    void selectKernels(pixels::proto::ColumnEncoding & encoding);
+    template <bool CASCADE_RLE>
+    void selectDictionaryKernels();
+    template <bool HAS_NULLS, bool FILTERED>
+    void readPlain(const std::shared_ptr<BinaryColumnVector> & columnVector, int vectorIndex,
+                   int size, bool nullsPadding, PixelsBitMask * filterMask);
+    template <bool CASCADE_RLE, bool HAS_NULLS, bool FILTERED>
+    void readDictionary(const std::shared_ptr<BinaryColumnVector> & columnVector, int vectorIndex,
+                        int size, bool nullsPadding, PixelsBitMask * filterMask);
+    void readFsst(const std::shared_ptr<BinaryColumnVector> & columnVector, int vectorIndex,
+                  int size, bool nullsPadding, PixelsBitMask * filterMask);
+    static int readInt(const uint8_t * buffer, int index) {
+        int value;
+        std::memcpy(&value, buffer + index * sizeof(int), sizeof(int));
+        return value;
+    }
     /**
      * In this method, we have reduced most of significant memory copies.
      */
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_VECTORCOLUMNREADER_H
+#define PIXELS_VECTORCOLUMNREADER_H
+
+#include "reader/ColumnReader.h"
+
+/**
+ * The reader of VECTOR column chunks. The vectors of a pixel are referenced in the chunk buffer
+ * if possible, so that they can be exposed to DuckDB as FLOAT arrays without copying.
+ */
+class VectorColumnReader: public ColumnReader {
+public:
+	explicit VectorColumnReader(std::shared_ptr<TypeDescription> type);
+	void close() override;
+	void read(std::shared_ptr<ByteBuffer> input,
+	          pixels::proto::ColumnEncoding & encoding,
+	          int offset, int size, int pixelStride,
+	          int vectorIndex, std::shared_ptr<ColumnVector> vector,
+	          pixels::proto::ColumnChunkIndex & chunkIndex,
+	          std::shared_ptr<PixelsBitMask> filterMask) override;
+private:
+	int dimension;
+};
+
+#endif //PIXELS_VECTORCOLUMNREADER_H
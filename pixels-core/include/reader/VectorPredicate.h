@@ -0,0 +1,65 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_VECTORPREDICATE_H
+#define PIXELS_VECTORPREDICATE_H
+
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+#include "PixelsBitMask.h"
+#include "utils/VectorDistance.h"
+#include "vector/VectorColumnVector.h"
+
+/**
+ * The nearest-neighbour predicate on a VECTOR column, which is pushed down into the record reader.
+ * A row passes the predicate if its distance to the query vector is at most maxDistance (if maxDistance >= 0),
+ * and if it is among the topK nearest rows seen so far by the record reader (if topK > 0).
+ * The top-k pruning is conservative: a row that passes may be superseded by the rows read later,
+ * so the scan still has to order the result by the distance and apply the limit.
+ * Null vectors never pass the predicate.
+ */
+class VectorPredicate {
+public:
+    VectorPredicate(std::string columnName, std::vector<float> query, VectorDistance::Metric metric,
+                    int topK, float maxDistance);
+    const std::string & getColumnName() const;
+    int getDimension() const;
+    /**
+     * Evaluate the predicate on the vectors [offset, offset + size) of the column vector,
+     * and clear the bits of the rows that do not pass in the filter mask, which is indexed from offset.
+     */
+    void apply(const std::shared_ptr<VectorColumnVector> & columnVector, int offset, int size, PixelsBitMask & filterMask);
+private:
+    std::string columnName;
+    std::vector<float> query;
+    VectorDistance::Metric metric;
+    int topK;
+    float maxDistance;
+    std::vector<float> distances;
+    /**
+     * The max-heap of the topK smallest distances of the rows that have passed the predicate.
+     */
+    std::priority_queue<float> nearest;
+};
+
+#endif //PIXELS_VECTORPREDICATE_H
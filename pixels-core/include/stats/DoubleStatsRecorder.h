@@ -0,0 +1,51 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_DOUBLESTATSRECORDER_H
+#define PIXELS_DOUBLESTATSRECORDER_H
+
+#include "stats/StatsRecorder.h"
+
+/**
+ * The statistics of FLOAT and DOUBLE columns. Floats are recorded as doubles.
+ */
+class DoubleStatsRecorder : public StatsRecorder {
+private:
+    double minimum;
+    double maximum;
+    double sum;
+    bool hasMinimum;
+
+public:
+    DoubleStatsRecorder();
+    explicit DoubleStatsRecorder(const pixels::proto::ColumnStatistic& statistic);
+
+    void updateFloat(float value) override;
+    void updateDouble(double value) override;
+    void merge(const StatsRecorder& stats) override;
+    void reset() override;
+    pixels::proto::ColumnStatistic serialize() const override;
+
+    double getMinimum() const;
+    double getMaximum() const;
+    double getSum() const;
+};
+#endif //PIXELS_DOUBLESTATSRECORDER_H
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_INTEGER128STATSRECORDER_H
+#define PIXELS_INTEGER128STATSRECORDER_H
+
+#include "stats/StatsRecorder.h"
+
+/**
+ * The statistics of long decimal columns, whose unscaled values are 128-bit integers.
+ */
+class Integer128StatsRecorder : public StatsRecorder {
+private:
+    __int128 minimum;
+    __int128 maximum;
+    bool hasMinimum;
+
+public:
+    Integer128StatsRecorder();
+    explicit Integer128StatsRecorder(const pixels::proto::ColumnStatistic& statistic);
+
+    void updateInteger128(long high, long low, int repetitions) override;
+    void merge(const StatsRecorder& stats) override;
+    void reset() override;
+    pixels::proto::ColumnStatistic serialize() const override;
+
+    bool hasMinMax() const;
+    __int128 getMinimum() const;
+    __int128 getMaximum() const;
+};
+#endif //PIXELS_INTEGER128STATSRECORDER_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef PIXELS_INTEGERSTATSRECORDER_H
+#define PIXELS_INTEGERSTATSRECORDER_H
+
+#include "stats/StatsRecorder.h"
+
+/**
+ * The statistics of SHORT, INT, LONG and short decimal columns, decimals are recorded by their unscaled values.
+ * The sum is not serialized once it overflows.
+ */
+class IntegerStatsRecorder : public StatsRecorder {
+private:
+    long minimum;
+    long maximum;
+    long sum;
+    bool hasMinimum;
+    bool overflow;
+
+    void updateMinMax(long min, long max);
+    void updateSum(long value);
+
+public:
+    IntegerStatsRecorder();
+    explicit IntegerStatsRecorder(const pixels::proto::ColumnStatistic& statistic);
+
+    void updateInteger(long value, int repetitions) override;
+    void updateInteger(const long* values, const uint8_t* isNull, int length) override;
+    void updateInteger(const int* values, const uint8_t* isNull, int length) override;
+    void merge(const StatsRecorder& stats) override;
+    void reset() override;
+    pixels::proto::ColumnStatistic serialize() const override;
+
+    bool hasMinMax() const;
+    long getMinimum() const;
+    long getMaximum() const;
+    bool isSumDefined() const;
+    long getSum() const;
+};
+#endif //PIXELS_INTEGERSTATSRECORDER_H
@@ -27,6 +27,7 @@
 
 #include "TypeDescription.h"
 #include "pixels-common/pixels.pb.h"
+#include <limits>
 
 class StatsRecorder {
 protected:
@@ -53,10 +54,20 @@ public:
     virtual void updateTime(int value);
     virtual void updateTimestamp(long value);
     virtual void updateVector();
+    virtual void updateString(const char* value, int length, int repetitions);
+
+    /**
+     * Update the statistics with the non-null values in a batch, e.g., the part of a column vector
+     * that is written into the current pixel. They are the vectorized versions of the updates above.
+     */
+    virtual void updateInteger(const long* values, const uint8_t* isNull, int length);
+    virtual void updateInteger(const int* values, const uint8_t* isNull, int length);
+    virtual void updateDate(const int* values, const uint8_t* isNull, int length);
+    virtual void updateTimestamp(const long* values, const uint8_t* isNull, int length);
 
     bool isStatsExists() const;
-    void merge(const StatsRecorder& stats);
-    void reset();
+    virtual void merge(const StatsRecorder& stats);
+    virtual void reset();
 
     long getNumberOfValues() const;
     bool hasNullValue() const;
@@ -66,5 +77,29 @@ public:
     static std::unique_ptr<StatsRecorder> create(TypeDescription type);
     static std::unique_ptr<StatsRecorder> create(TypeDescription type, const pixels::proto::ColumnStatistic& statistic);
     static std::unique_ptr<StatsRecorder> create(TypeDescription::Category category, const pixels::proto::ColumnStatistic& statistic);
+
+protected:
+    /**
+     * Get the minimum and maximum of the non-null values without branches, so that the loop is vectorized.
+     * @return the number of non-null values, the minimum and maximum are not set if it is 0
+     */
+    template <typename T>
+    static int minMax(const T* values, const uint8_t* isNull, int length, T& minimum, T& maximum) {
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+        int count = 0;
+        for (int i = 0; i < length; i++) {
+            bool valid = !isNull[i];
+            T value = values[i];
+            min = valid && value < min ? value : min;
+            max = valid && value > max ? value : max;
+            count += valid;
+        }
+        if (count > 0) {
+            minimum = min;
+            maximum = max;
+        }
+        return count;
+    }
 };
 #endif // PIXELS_STATSRECODER_H
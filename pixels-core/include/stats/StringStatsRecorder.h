@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef PIXELS_STRINGSTATSRECORDER_H
+#define PIXELS_STRINGSTATSRECORDER_H
+
+#include "stats/StatsRecorder.h"
+#include <string>
+
+/**
+ * The statistics of STRING, CHAR and VARCHAR columns. The strings are compared byte by byte as unsigned bytes,
+ * and the sum is the total length of the strings.
+ * <p>
+ * The minimum and maximum are truncated to MAX_LENGTH bytes, so that long values do not bloat the footers.
+ * A truncated minimum is a prefix of the real minimum, and a truncated maximum is a prefix of the real
+ * maximum with its last byte incremented, so they are still a lower and an upper bound of the values.
+ */
+class StringStatsRecorder : public StatsRecorder {
+private:
+    std::string minimum;
+    std::string maximum;
+    long sum;
+    bool hasMinimum;
+
+public:
+    static const int MAX_LENGTH;
+
+    StringStatsRecorder();
+    explicit StringStatsRecorder(const pixels::proto::ColumnStatistic& statistic);
+
+    void updateString(const std::string& value, int repetitions) override;
+    void updateString(const char* value, int length, int repetitions) override;
+    void merge(const StatsRecorder& stats) override;
+    void reset() override;
+    pixels::proto::ColumnStatistic serialize() const override;
+
+    bool hasMinMax() const;
+    const std::string& getMinimum() const;
+    const std::string& getMaximum() const;
+    long getSum() const;
+
+    /**
+     * @return the value truncated to a lower bound of at most MAX_LENGTH bytes
+     */
+    static std::string truncateMinimum(const char* value, int length);
+    /**
+     * @return the value truncated to an upper bound of at most MAX_LENGTH bytes, or the value itself
+     * if it has no such upper bound, i.e., its first MAX_LENGTH bytes are all 0xff
+     */
+    static std::string truncateMaximum(const char* value, int length);
+};
+#endif //PIXELS_STRINGSTATSRECORDER_H
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef PIXELS_TIMESTAMPSTATSRECORDER_H
+#define PIXELS_TIMESTAMPSTATSRECORDER_H
+
+#include "stats/StatsRecorder.h"
+
+/**
+ * The statistics of TIMESTAMP columns, the timestamps are recorded in the unit of TimestampColumnVector.
+ */
+class TimestampStatsRecorder : public StatsRecorder {
+private:
+    long minimum;
+    long maximum;
+    bool hasMinimum;
+
+    void updateMinMax(long min, long max);
+
+public:
+    TimestampStatsRecorder();
+    explicit TimestampStatsRecorder(const pixels::proto::ColumnStatistic& statistic);
+
+    void updateTimestamp(long value) override;
+    void updateTimestamp(const long* values, const uint8_t* isNull, int length) override;
+    void merge(const StatsRecorder& stats) override;
+    void reset() override;
+    pixels::proto::ColumnStatistic serialize() const override;
+
+    bool hasMinMax() const;
+    long getMinimum() const;
+    long getMaximum() const;
+};
+#endif //PIXELS_TIMESTAMPSTATSRECORDER_H
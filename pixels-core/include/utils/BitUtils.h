@@ -47,6 +47,44 @@ public:
 public:
     static std::vector<uint8_t> bitWiseCompact(std::vector<uint8_t> values, int length, ByteOrder byteOrder);
 
+    /**
+     * Convert the isNull bitmap of a pixel (little endian bit order) into the validity mask of DuckDB,
+     * which is the inverted bitmap stored in 64-bit words. The words of isValid are written entirely,
+     * so isValid must have at least (numValues + 63) / 64 words.
+     *
+     * @param isNull the isNull bitmap, which has (numValues + 7) / 8 bytes and does not need to be aligned
+     * @param isValid the validity mask
+     * @param numValues the number of values in the bitmap
+     * @return the number of nulls
+     */
+    static int toValidityMask(const uint8_t *isNull, uint64_t *isValid, int numValues);
+
+    /**
+     * Convert numValues bits of the isNull bitmap starting from bit nullBitOffset into the validity mask
+     * starting from bit validBitOffset. Unlike the whole-pixel conversion above, the bits of isValid out of
+     * [validBitOffset, validBitOffset + numValues) are preserved, so a pixel can be read in several parts
+     * and a row batch can be filled from several pixels.
+     *
+     * @return the number of nulls in the converted bits
+     */
+    static int toValidityMask(const uint8_t *isNull, int nullBitOffset, uint64_t *isValid, int validBitOffset,
+                              int numValues);
+
+    /**
+     * Mark numValues bits of the validity mask starting from bit bitOffset as valid.
+     */
+    static void fillValidityMask(uint64_t *isValid, int bitOffset, int numValues);
+
+    /**
+     * Unpack bit-packed values (little endian bit order) into one byte per value, which is 0 or 1.
+     *
+     * @param bits the bit-packed values
+     * @param bitOffset the index of the first bit to unpack
+     * @param values the unpacked values, which has numValues bytes
+     * @param numValues the number of values to unpack
+     */
+    static void unpackBits(const uint8_t *bits, int bitOffset, uint8_t *values, int numValues);
+
 private:
     static std::vector<uint8_t> bitWiseCompactBE(std::vector<uint8_t> values, int length);
     static std::vector<uint8_t> bitWiseCompactLE(std::vector<uint8_t> values, int length);
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_BLOOMFILTER_H
+#define PIXELS_BLOOMFILTER_H
+
+#include "TypeDescription.h"
+#include "vector/ColumnVector.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * The split-block Bloom filter of a column chunk, with the same layout as the one of Parquet.
+ * The filter is an array of 32-byte blocks, each of which holds eight 32-bit words. A value sets
+ * one bit in each word of the block selected by the upper 32 bits of its hash, and the bits are
+ * selected by multiplying the lower 32 bits of the hash with eight odd salts. Thus inserting or
+ * probing a value only touches one block, which is done by a few AVX2 instructions.
+ * <p>
+ * The values are hashed by the hash functions of this class, which must be used by both the writer
+ * and the reader. Integers, dates and short decimals are hashed as int64, long decimals by their two
+ * 64-bit words, and strings by their bytes.
+ */
+class BloomFilter {
+public:
+    static const int BYTES_PER_BLOCK;
+    /**
+     * Create an empty filter that is large enough for the number of distinct values to have
+     * the false positive probability.
+     */
+    BloomFilter(uint64_t numDistinctValues, double fpp);
+    void insert(uint64_t hash);
+    bool mightContain(uint64_t hash) const;
+    /**
+     * @return the blocks of this filter in little endian, it is stored in the column chunk index
+     */
+    std::string serialize() const;
+    uint64_t getMemoryUsage() const {
+        return words.size() * sizeof(uint32_t);
+    }
+    /**
+     * Probe the serialized filter without deserializing it.
+     */
+    static bool mightContain(const std::string &bitset, uint64_t hash);
+
+    static uint64_t hash(int64_t value);
+    static uint64_t hash(const char *data, int length);
+    static uint64_t hash(int64_t high, uint64_t low);
+    /**
+     * Floating point values are rarely looked up by equality, and the time types are not compared with
+     * constants of the same unit by the filters, so they are not supported.
+     */
+    static bool isTypeSupported(TypeDescription::Category category);
+    /**
+     * Hash the first length values of the column vector of a supported type, the hashes of nulls are undefined.
+     */
+    static void hashValues(const std::shared_ptr<ColumnVector> &vector, TypeDescription::Category category,
+                           int length, uint64_t *hashes);
+
+private:
+    static uint32_t blockIndex(uint64_t hash, uint32_t numBlocks);
+    static bool blockContains(const uint32_t *block, uint32_t key);
+    static void blockInsert(uint32_t *block, uint32_t key);
+
+    std::vector<uint32_t> words;
+    uint32_t numBlocks;
+};
+#endif //PIXELS_BLOOMFILTER_H
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include "physical/natives/ByteBuffer.h"
+#include "physical/natives/SegmentedOutputStream.h"
 
 class EncodingUtils {
 public:
@@ -80,6 +81,8 @@ public:
     void writeIntLE(std::shared_ptr<ByteBuffer> output, int val);
     void writeLongLE(std::shared_ptr<ByteBuffer> output, long val);
     void writeIntBE(std::shared_ptr<ByteBuffer> output, int val);
+    void writeIntLE(std::shared_ptr<SegmentedOutputStream> output, int val);
+    void writeIntBE(std::shared_ptr<SegmentedOutputStream> output, int val);
     void writeLongBE(std::shared_ptr<ByteBuffer> output, long val);
     void writeLongBE(std::shared_ptr<ByteBuffer> output, 
                      long* input, int offset, int numHops, int numBytes);
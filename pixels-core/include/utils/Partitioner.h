@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_PARTITIONER_H
+#define PIXELS_PARTITIONER_H
+
+#include "TypeDescription.h"
+#include "vector/VectorizedRowBatch.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Partition the rows of row batches into hash partitions by the key columns. The batches of each
+ * partition are added into a hash partitioned file by PixelsWriterImpl::addRowBatch(rowBatch, hashValue),
+ * so that each row group holds the rows of one partition.
+ * <p>
+ * The hash of a row combines the hashes of its key values, which are hashed by BloomFilter::hashValues.
+ * Thus the reader can find the partition of the rows matching the equality predicates on the key columns.
+ */
+class Partitioner {
+public:
+    /**
+     * @param numPartitions the number of hash partitions
+     * @param batchSize the number of rows in each partitioned row batch
+     * @param schema the schema of the row batches
+     * @param keyColumnIds the ids of the top-level key columns in the schema
+     */
+    Partitioner(int numPartitions, int batchSize, const std::shared_ptr<TypeDescription> &schema,
+                const std::vector<int> &keyColumnIds);
+    /**
+     * Copy the rows of the row batch into the row batches of their partitions.
+     * @return the row batches that are full and their hash values
+     */
+    std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> partition(
+            const std::shared_ptr<VectorizedRowBatch> &rowBatch);
+    /**
+     * @return the row batches that are not empty and their hash values, they are taken out of this partitioner
+     */
+    std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> getRowBatches();
+    int getNumPartitions() const;
+    const std::vector<int> &getKeyColumnIds() const;
+
+    /**
+     * The initial hash of a row, which the hashes of the key values are combined into in the order of the key columns.
+     */
+    static const uint64_t INITIAL_HASH;
+    static uint64_t combineHash(uint64_t rowHash, uint64_t keyHash);
+    /**
+     * @return the hash value, i.e., the index of the partition of the row hash
+     */
+    static int getHashValue(uint64_t rowHash, int numPartitions);
+
+private:
+    int numPartitions;
+    int batchSize;
+    std::shared_ptr<TypeDescription> schema;
+    std::vector<int> keyColumnIds;
+    std::vector<TypeDescription::Category> keyCategories;
+    std::vector<std::shared_ptr<VectorizedRowBatch>> rowBatches;
+};
+#endif //PIXELS_PARTITIONER_H
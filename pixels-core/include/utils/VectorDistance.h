@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_VECTORDISTANCE_H
+#define PIXELS_VECTORDISTANCE_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * The distance kernels of float vectors, which are used to evaluate the vector predicates pushed down
+ * into the record reader. The distances have the same definition as the array distance functions of DuckDB,
+ * i.e., array_distance, array_cosine_distance and array_negative_inner_product, so that smaller is closer.
+ */
+class VectorDistance
+{
+public:
+    enum Metric
+    {
+        L2,
+        COSINE,
+        INNER_PRODUCT
+    };
+
+    /**
+     * Parse the metric name (l2, cosine or ip), which is case insensitive.
+     */
+    static Metric parseMetric(const std::string &name);
+
+    static float distance(Metric metric, const float *a, const float *b, int dimension);
+
+    /**
+     * Compute the distances between the query vector and numVectors contiguous vectors of the same dimension.
+     * The norm of the query vector is computed only once for the cosine distance.
+     */
+    static void distances(Metric metric, const float *query, const float *vectors, int numVectors,
+                          int dimension, float *result);
+
+private:
+    VectorDistance() {};
+    static float dot(const float *a, const float *b, int dimension);
+    static float squaredL2(const float *a, const float *b, int dimension);
+    /**
+     * Compute the dot product of a and b, and the squared norm of b in the same pass.
+     */
+    static float dotAndNorm(const float *a, const float *b, int dimension, float &norm);
+};
+
+#endif //PIXELS_VECTORDISTANCE_H
@@ -65,12 +65,24 @@ public:
 
     void * current() override;
     void close() override;
+    void reset() override;
     //void print(int rowCount) override;
 
     void add(std::string &value) override;
     void add(uint8_t* v, int length);
     void setVal(int elementNum, uint8_t* sourceBuf, int start, int length);
     void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
+private:
+    /**
+     * Allocate the memory for a value copied by gather.
+     */
+    uint8_t * allocateGathered(int length);
+    // the memory holding the values copied by gather, it is released when this vector is reset
+    std::vector<std::unique_ptr<uint8_t[]>> gatheredBuffers;
+    int gatheredBufferFree = 0;
+    int gatheredBufferSize = 0;
+    uint64_t gatheredMemory = 0;
 };
 
 #endif // PIXELS_BINARYCOLUMNVECTOR_H
\ No newline at end of file
@@ -8,16 +8,39 @@
 #include "vector/ColumnVector.h"
 #include "vector/VectorizedRowBatch.h"
 
+/**
+ * The column vector of BYTE and BOOLEAN columns, one byte per value. Booleans are 0 or 1.
+ */
 class ByteColumnVector: public ColumnVector {
 public:
     uint8_t * vector;
+    /**
+     * The memory allocated by this column vector. For plain BYTE column chunks, vector points
+     * directly into the chunk buffer if possible; otherwise the values are decoded into this buffer.
+     */
+    uint8_t * decodedVector;
+    /**
+     * The bit-packed values (little endian bit order) of a BOOLEAN column vector, bit i is the value of row i.
+     * It is set by the reader if the bits in the column chunk can be referenced as is, otherwise it is nullptr.
+     * Filters are evaluated on it without the unpacked values.
+     */
+    const uint8_t * bitVector;
 
     /**
     * Use this constructor by default. All column vectors
     * should normally be the default size.
     */
     ByteColumnVector(int len = VectorizedRowBatch::DEFAULT_SIZE, bool encoding = false);
-
+    ~ByteColumnVector();
+    void * current() override;
+    void print(int rowCount) override;
     void close() override;
+    void reset() override;
+    void add(std::string &value) override;
+    void add(bool value) override;
+    void add(int64_t value) override;
+    void add(int value) override;
+    void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
 };
 #endif //PIXELS_BYTECOLUMNVECTOR_H
@@ -20,7 +20,9 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 #include "exception/InvalidArgumentException.h"
+#include "physical/natives/ByteBuffer.h"
 
 /**
  * ColumnVector derived from org.apache.hadoop.hive.ql.exec.vector.
@@ -56,13 +58,23 @@ public:
     uint8_t * isNull;
 
     // If the whole column vector has no nulls, this is true, otherwise false.
+    // When reading, isValid is not filled if there is no null, and currentValid returns nullptr,
+    // which DuckDB takes as an all-valid mask.
     bool noNulls;
 
     // DuckDB requires that the type of the valid mask should be uint64
     uint64_t * isValid;
+
+    /**
+     * The chunk buffers referenced by the values of this vector (zero-copy).
+     * They are kept alive until the vector is reset or closed.
+     */
+    std::vector<std::shared_ptr<ByteBuffer>> pinnedBuffers;
+
     explicit ColumnVector(uint64_t len, bool encoding);
     void increment(uint64_t size);              // increment the readIndex
     bool isFull();                         // if the readIndex reaches length
+    void pin(const std::shared_ptr<ByteBuffer> &buffer); // keep the buffer alive while the values reference it
     uint64_t position();                   // return readIndex
     void resize(int size);                 // resize the column vector to a smaller one
     virtual void close();
@@ -71,15 +83,31 @@ public:
     uint64_t * currentValid();
     virtual void print(int rowCount);      // this is only used for debug
     bool checkValid(int index);
-    void addNull();
+    virtual void addNull();
     virtual void ensureSize(uint64_t size, bool preserveData);
     virtual void add(std::string &value);
     virtual void add(bool value);
     virtual void add(int64_t value);
     virtual void add(int value);
+    /**
+     * Copy the values of the given rows of the source vectors into this vector from targetOffset.
+     * The high 32 bits of a row id is the index of the source vector and the low 32 bits is the row
+     * in it, see makeRowId. The source vectors must be of the same type as this vector, the values
+     * of variable length are copied into the memory owned by this vector.
+     * It is used by the writer to buffer and reorder rows, e.g., to sort a row group.
+     */
+    virtual void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset);
+    static uint64_t makeRowId(uint32_t source, uint32_t row) {
+        return ((uint64_t) source << 32) | row;
+    }
     int getLength() {
      return length;
     }
+protected:
+    /**
+     * Copy the isNull flags of the given rows, it is called by the gather of the sub-types.
+     */
+    void gatherNulls(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset);
 };
 
 #endif //PIXELS_COLUMNVECTOR_H
@@ -15,6 +15,12 @@ public:
      * representation in Presto.
 	 */
 	int * dates;
+	/**
+	 * The memory allocated by this column vector. For plain column chunks,
+	 * dates points directly into the chunk buffer if possible; otherwise
+	 * the values are decoded into this buffer.
+	 */
+	int * decodedDates;
 
 
 	/**
@@ -26,10 +32,12 @@ public:
     void * current() override;
 	void print(int rowCount) override;
 	void close() override;
+	void reset() override;
 	void set(int elementNum, int days);
  
 	// lab2
     void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
 	inline int date2j(int y, int m, int d);
 	void add(std::string &value) override;
 };
@@ -11,6 +11,12 @@
 class DecimalColumnVector: public ColumnVector {
 public:
     long * vector;
+    /**
+     * The memory allocated by this column vector. For plain column chunks,
+     * vector points directly into the chunk buffer; run-length encoded
+     * chunks are decoded into this buffer.
+     */
+    long * decodedVector;
     int precision;
     int scale;
     static long DEFAULT_UNSCALED_VALUE;
@@ -23,12 +29,14 @@ public:
     ~DecimalColumnVector();
     void print(int rowCount) override;
     void close() override;
+    void reset() override;
     void * current() override;
 	int getPrecision();
 	int getScale();
 
     // lab2
     void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
 	void add(std::string &value) override;
 };
 
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_DOUBLECOLUMNVECTOR_H
+#define PIXELS_DOUBLECOLUMNVECTOR_H
+
+#include "vector/ColumnVector.h"
+#include "vector/VectorizedRowBatch.h"
+
+/**
+ * The column vector of FLOAT and DOUBLE columns. The values are stored in their native width,
+ * i.e., in floatVector for FLOAT and in doubleVector for DOUBLE, so that they can be passed to
+ * DuckDB without conversion.
+ */
+class DoubleColumnVector: public ColumnVector {
+public:
+    double * doubleVector;
+    float * floatVector;
+    /**
+     * The memory allocated by this column vector. For plain column chunks,
+     * doubleVector (or floatVector) points directly into the chunk buffer if possible;
+     * otherwise the values are decoded into this buffer.
+     */
+    uint8_t * decodedVector;
+    /**
+    * Use this constructor by default. All column vectors
+    * should normally be the default size.
+    */
+    explicit DoubleColumnVector(uint64_t len = VectorizedRowBatch::DEFAULT_SIZE, bool encoding = false, bool isDouble = true);
+    ~DoubleColumnVector();
+    void * current() override;
+    void print(int rowCount) override;
+    void close() override;
+    void reset() override;
+    void add(std::string &value) override;
+    void add(int64_t value) override;
+    void add(int value) override;
+    void add(double value);
+    void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
+    bool isDoubleVector();
+    /**
+     * Point doubleVector or floatVector to the given values.
+     */
+    void setValues(uint8_t * values);
+private:
+    bool isDouble;
+};
+#endif //PIXELS_DOUBLECOLUMNVECTOR_H
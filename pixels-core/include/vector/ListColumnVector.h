@@ -0,0 +1,61 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIXELS_LISTCOLUMNVECTOR_H
+#define PIXELS_LISTCOLUMNVECTOR_H
+
+#include "vector/ColumnVector.h"
+#include "vector/VectorizedRowBatch.h"
+
+/**
+ * The offset and length of a list value in the child vector, it has the same layout as list_entry_t of DuckDB.
+ */
+struct ListEntry {
+    uint64_t offset;
+    uint64_t length;
+};
+
+/**
+ * The column vector of ARRAY columns. The elements of the list values are stored contiguously
+ * in the child vector, and entries[i] is the range of the elements of row i in the child vector.
+ * A null list value has no element.
+ */
+class ListColumnVector: public ColumnVector {
+public:
+    ListEntry * entries;
+    std::shared_ptr<ColumnVector> child;
+    /**
+     * The number of elements in the child vector.
+     */
+    uint64_t childCount;
+
+    ListColumnVector(uint64_t len, std::shared_ptr<ColumnVector> child, bool encoding = false);
+    ~ListColumnVector();
+    void * current() override;
+    void print(int rowCount) override;
+    void close() override;
+    void reset() override;
+    /**
+     * Add a non-null list value of the given number of elements. The elements are added to the child vector by the caller.
+     */
+    void addRow(int length);
+    void addNull() override;
+};
+#endif //PIXELS_LISTCOLUMNVECTOR_H
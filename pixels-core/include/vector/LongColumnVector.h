@@ -11,7 +11,14 @@
 class LongColumnVector: public ColumnVector {
 public:
     long * longVector;
-	long * intVector;
+	int * intVector;
+	/**
+	 * The memory allocated by this column vector. For plain column chunks,
+	 * longVector or intVector points directly into the chunk buffer if possible;
+	 * otherwise the values are decoded into these buffers.
+	 */
+	long * decodedLongVector;
+	int * decodedIntVector;
     /**
     * Use this constructor by default. All column vectors
     * should normally be the default size.
@@ -21,11 +28,13 @@ public:
 	~LongColumnVector();
     void print(int rowCount) override;
     void close() override;
+    void reset() override;
     void add(std::string &value) override;
     void add(bool value) override;
     void add(int64_t value) override;
     void add(int value) override;
     void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
     bool isLongVectore();
 private:
     bool isLong;
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_LONGDECIMALCOLUMNVECTOR_H
+#define PIXELS_LONGDECIMALCOLUMNVECTOR_H
+
+#include "vector/ColumnVector.h"
+#include "vector/VectorizedRowBatch.h"
+
+/**
+ * The decimal column vector with precision larger than 18 and up to 38.
+ * Each unscaled value is a 128-bit integer stored in two 64-bit words, the lower word first,
+ * which is the layout of hugeint_t in DuckDB. Hence, the values can be passed to DuckDB
+ * DECIMAL(38,x) vectors without conversion.
+ */
+class LongDecimalColumnVector: public ColumnVector {
+public:
+    /**
+     * vector[2 * i] is the lower word and vector[2 * i + 1] is the upper word of the i-th value.
+     */
+    uint64_t * vector;
+    /**
+     * The memory allocated by this column vector. For column chunks stored in 128 bits,
+     * vector points directly into the chunk buffer if possible; otherwise the values are decoded into this buffer.
+     */
+    uint64_t * decodedVector;
+    int precision;
+    int scale;
+
+    LongDecimalColumnVector(uint64_t len, int precision, int scale, bool encoding = false);
+    ~LongDecimalColumnVector();
+    void print(int rowCount) override;
+    void close() override;
+    void reset() override;
+    void * current() override;
+    int getPrecision();
+    int getScale();
+    void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
+    void add(std::string &value) override;
+    void add(int64_t value) override;
+    void add(int value) override;
+    void set(int index, __int128 value);
+    __int128 get(int index);
+
+    static __int128 parse(const std::string &value, int scale);
+    static std::string toString(__int128 unscaledValue, int scale);
+};
+
+#endif //PIXELS_LONGDECIMALCOLUMNVECTOR_H
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIXELS_STRUCTCOLUMNVECTOR_H
+#define PIXELS_STRUCTCOLUMNVECTOR_H
+
+#include "vector/ColumnVector.h"
+#include "vector/VectorizedRowBatch.h"
+#include <vector>
+
+/**
+ * The column vector of STRUCT columns. It only has the validity of the struct values, the values of
+ * the fields are in the field vectors, which have the same rows as this column vector. For a null
+ * struct value, the fields of the row are also null.
+ */
+class StructColumnVector: public ColumnVector {
+public:
+    std::vector<std::shared_ptr<ColumnVector>> fields;
+
+    StructColumnVector(uint64_t len, std::vector<std::shared_ptr<ColumnVector>> fields, bool encoding = false);
+    ~StructColumnVector();
+    /**
+     * A struct vector has no values of its own, the values are read from the field vectors.
+     */
+    void * current() override;
+    void print(int rowCount) override;
+    void close() override;
+    void reset() override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
+    /**
+     * Add a non-null struct value. The values of the fields are added to the field vectors by the caller.
+     */
+    void addRow();
+    /**
+     * Add a null struct value, a null is also added to each field vector.
+     */
+    void addNull() override;
+};
+#endif //PIXELS_STRUCTCOLUMNVECTOR_H
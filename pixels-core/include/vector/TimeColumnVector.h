@@ -0,0 +1,59 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_TIMECOLUMNVECTOR_H
+#define PIXELS_TIMECOLUMNVECTOR_H
+
+#include "vector/ColumnVector.h"
+#include "vector/VectorizedRowBatch.h"
+
+class TimeColumnVector: public ColumnVector {
+public:
+	/*
+	 * They are the milliseconds from 00:00:00. This is consistent with time type's internal
+	 * representation in Pixels, whose max precision is 3.
+	 */
+	int * times;
+	/**
+	 * The memory allocated by this column vector. For plain column chunks,
+	 * times points directly into the chunk buffer if possible; otherwise
+	 * the values are decoded into this buffer.
+	 */
+	int * decodedTimes;
+	int precision;
+
+	explicit TimeColumnVector(uint64_t len = VectorizedRowBatch::DEFAULT_SIZE, int precision = 3, bool encoding = false);
+	~TimeColumnVector();
+	void * current() override;
+	void print(int rowCount) override;
+	void close() override;
+	void reset() override;
+	void set(int elementNum, int millis);
+	void ensureSize(uint64_t size, bool preserveData) override;
+	void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
+	/**
+	 * Add a time in the format of HH:MM:SS[.fff].
+	 */
+	void add(std::string &value) override;
+	void add(int value) override;
+};
+
+#endif // PIXELS_TIMECOLUMNVECTOR_H
@@ -12,6 +12,12 @@ class TimestampColumnVector: public ColumnVector {
 public:
     int precision;
     long * times;
+    /**
+     * The memory allocated by this column vector. For plain column chunks,
+     * times points directly into the chunk buffer if possible; otherwise
+     * the values are decoded into this buffer.
+     */
+    long * decodedTimes;
     /**
     * Use this constructor by default. All column vectors
     * should normally be the default size.
@@ -23,8 +29,10 @@ public:
     ~TimestampColumnVector();
     void print(int rowCount) override;
     void close() override;
+    void reset() override;
 
     void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
     inline int date2j(int y, int m, int d);
     void add(std::string &value) override;
 
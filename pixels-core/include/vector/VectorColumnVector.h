@@ -0,0 +1,58 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_VECTORCOLUMNVECTOR_H
+#define PIXELS_VECTORCOLUMNVECTOR_H
+
+#include "vector/ColumnVector.h"
+#include "vector/VectorizedRowBatch.h"
+
+/**
+ * The column vector of VECTOR (embedding) columns. Each row is a fixed-dimension float vector,
+ * and the rows are stored contiguously, i.e., vector[i * dimension + j] is the j-th element of the i-th row.
+ * This is the layout of the child vector of DuckDB FLOAT[dimension] arrays.
+ */
+class VectorColumnVector: public ColumnVector {
+public:
+    float * vector;
+    /**
+     * The memory allocated by this column vector. For column chunks without padded nulls,
+     * vector points directly into the chunk buffer if possible; otherwise the values are decoded into this buffer.
+     */
+    float * decodedVector;
+    int dimension;
+
+    VectorColumnVector(uint64_t len, int dimension, bool encoding = false);
+    ~VectorColumnVector();
+    void * current() override;
+    void print(int rowCount) override;
+    void close() override;
+    void reset() override;
+    /**
+     * Add a vector in the format of [v1, v2, ..., vn], where n equals the dimension.
+     */
+    void add(std::string &value) override;
+    void add(const float * value);
+    void ensureSize(uint64_t size, bool preserveData) override;
+    void gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) override;
+    int getDimension();
+};
+#endif //PIXELS_VECTORCOLUMNVECTOR_H
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DUCKDB_ARRAYCOLUMNWRITER_H
+#define DUCKDB_ARRAYCOLUMNWRITER_H
+
+#include "ColumnWriter.h"
+#include "vector/ListColumnVector.h"
+#include "utils/EncodingUtils.h"
+
+/**
+ * The writer of ARRAY column chunks. The column chunk of an array has the number of elements of each row
+ * as plain 32-bit integers, including 0 for the null rows, so that the element range of any rows can be
+ * found without the isNull bitmap. The elements are shredded into their own column chunk by the element writer.
+ */
+class ArrayColumnWriter : public ColumnWriter {
+public:
+    ArrayColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void writeCurPartArray(std::shared_ptr<ListColumnVector> columnVector, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    std::vector<std::shared_ptr<ColumnWriter>> getChildWriters() override;
+    void reset() override;
+    void close() override;
+private:
+    std::shared_ptr<ColumnWriter> elementWriter;
+    EncodingUtils encodingUtils;
+};
+#endif // DUCKDB_ARRAYCOLUMNWRITER_H
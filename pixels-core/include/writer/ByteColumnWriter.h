@@ -25,4 +25,34 @@
 #ifndef DUCKDB_BYTECOLUMNWRITER_H
 #define DUCKDB_BYTECOLUMNWRITER_H
 
+#include "encoding/RunLenIntEncoder.h"
+#include "ColumnWriter.h"
+#include "vector/ByteColumnVector.h"
+
+/**
+ * The writer of BYTE and BOOLEAN column chunks. Bytes are written as is, and booleans are bit-packed
+ * (one bit per value) pixel by pixel. On EL2, run-length encoding is a candidate for both types.
+ */
+class ByteColumnWriter : public ColumnWriter {
+public:
+    ByteColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void reset() override;
+    void close() override;
+    void newPixel() override;
+    void writeCurPartByte(std::shared_ptr<ByteColumnVector> columnVector, uint8_t* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+private:
+    bool isBoolean;
+    bool runlengthEncoding;
+    /**
+     * Whether the encoding of the current column chunk has been chosen by the encoding selector.
+     * It is chosen on the first pixel of the chunk, and all the pixels in the chunk use the same encoding.
+     */
+    bool encodingDecided;
+    std::unique_ptr<RunLenIntEncoder> encoder;
+    std::vector<long> curPixelVector; // current pixel value vector haven't written out yet
+};
 #endif // DUCKDB_BYTECOLUMNWRITER_H
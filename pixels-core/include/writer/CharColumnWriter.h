@@ -25,4 +25,28 @@
 #ifndef DUCKDB_CHARCOLUMNWRITER_H
 #define DUCKDB_CHARCOLUMNWRITER_H
 
+#include "ColumnWriter.h"
+#include "vector/BinaryColumnVector.h"
+#include <vector>
+
+/**
+ * The writer of CHAR(n) column chunks. Each value is padded with spaces to n bytes and the values of a pixel
+ * are written back to back, so the column chunk has no starts array and the i-th value is at i * n.
+ * Values are limited to n bytes, so multi-byte UTF-8 values may not fit. Trailing spaces beyond n bytes are
+ * dropped, any other over-long value is rejected with an InvalidArgumentException.
+ */
+class CharColumnWriter : public ColumnWriter {
+public:
+    CharColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    // vector should be converted to BinaryColumnVector
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void newPixel() override;
+    void writeCurPartChar(std::shared_ptr<BinaryColumnVector> columnVector, duckdb::string_t* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+private:
+    int maxLength;
+    std::vector<uint8_t> curPixelContent; // current pixel values haven't written out yet, maxLength bytes per row
+};
 #endif // DUCKDB_CHARCOLUMNWRITER_H
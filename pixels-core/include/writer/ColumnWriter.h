@@ -27,6 +27,7 @@
 
 #include "TypeDescription.h"
 #include "physical/natives/ByteBuffer.h"
+#include "physical/natives/SegmentedOutputStream.h"
 #include "pixels-common/pixels.pb.h"
 #include <cmath>
 #include <cmath>
@@ -35,6 +36,7 @@
 #include "PixelsFilter.h"
 #include "writer/PixelsWriterOption.h"
 #include "stats/StatsRecorder.h"
+#include "utils/BloomFilter.h"
 
 
 class ColumnWriter{
@@ -48,38 +50,94 @@ public:
      */
     virtual int write(std::shared_ptr<ColumnVector> columnVector,int length )=0;
 
-    virtual std::vector<uint8_t> getColumnChunkContent() const;
+    /**
+     * Append the segments of the flushed column chunk to the buffers. They are valid until this
+     * writer is destroyed or reset.
+     */
+    virtual void getColumnChunkContent(std::vector<struct iovec> &buffers) const;
     virtual int getColumnChunkSize() const;
     virtual bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) =0;
     virtual pixels::proto::ColumnChunkIndex getColumnChunkIndex();
     virtual std::shared_ptr<pixels::proto::ColumnChunkIndex> getColumnChunkIndexPtr();
+    /**
+     * The statistics of the column chunk, which are merged from the statistics of its pixels.
+     * They are complete after the column chunk is flushed.
+     */
+    pixels::proto::ColumnStatistic getColumnChunkStat() const;
+    const StatsRecorder& getColumnChunkStatRecorder() const;
     virtual pixels::proto::ColumnEncoding getColumnChunkEncoding();
+    /**
+     * Prepare the writer for the column chunk of the next row group. The output buffers are
+     * kept and reused, the index, the statistics and the encoding state are cleared.
+     */
     virtual void reset();
     virtual void flush() ;
     virtual void close() ;
 
     // virtual
     virtual void newPixel();
+    /**
+     * Get the writers of the nested columns. Their column chunks follow the chunk of this writer
+     * in pre-order, which is the order of the types in the file footer.
+     */
+    virtual std::vector<std::shared_ptr<ColumnWriter>> getChildWriters() { return {}; }
+    /**
+     * @return the bytes of the memory held for the Bloom filters of the current column chunks of this
+     * writer and the writers of its nested columns
+     */
+    std::int64_t getBloomFilterMemoryUsage();
+    /**
+     * @return the bytes of the stream segments held by this writer and the writers of its nested columns,
+     * they are kept when the writer is reset
+     */
+    std::int64_t getBufferCapacity();
 private:
     static const int ISNULL_ALIGNMENT;
     static const std::vector<uint8_t> ISNULL_PADDING_BUFFER;
 
     std::shared_ptr<pixels::proto::ColumnChunkIndex> columnChunkIndex{};
-    std::shared_ptr<pixels::proto::ColumnStatistic> columnChunkStat{};
 
     int lastPixelPosition = 0;
     int curPixelPosition = 0;
 
-    std::shared_ptr<ByteBuffer> isNullStream;
+    std::shared_ptr<SegmentedOutputStream> isNullStream;
+
+    bool bloomFilterEnabled = false;
+    double bloomFilterFpp = 0;
+    /**
+     * The hashes of the non-null values in the column chunk, the Bloom filter is built from them
+     * when the column chunk is flushed, as the number of distinct values is known by then.
+     * The hashes are deduplicated whenever their number doubles, the first bloomFilterDistinctHashes
+     * of them are distinct and sorted.
+     */
+    std::vector<uint64_t> bloomFilterHashes;
+    size_t bloomFilterDistinctHashes = 0;
+    /**
+     * The Bloom filter of a column chunk with too many distinct values to keep their hashes.
+     * The following values are inserted into it directly.
+     */
+    std::unique_ptr<BloomFilter> bloomFilter;
+    /**
+     * Deduplicate the hashes of the column chunk, and switch to the Bloom filter if there are too many
+     * distinct hashes.
+     */
+    void compactBloomFilterHashes();
 protected:
+    const TypeDescription::Category category;
+    /**
+     * Add the non-null values in the first length elements of the vector to the Bloom filter of the column chunk.
+     * It is called by the writers of the types supporting Bloom filters, and does nothing if they are disabled.
+     */
+    void updateBloomFilter(const std::shared_ptr<ColumnVector> &vector, int length);
+
     const int pixelStride;
     const EncodingLevel encodingLevel;
     int curPixelIsNullIndex = 0;
-    std::shared_ptr<ByteBuffer> outputStream;
+    std::shared_ptr<SegmentedOutputStream> outputStream;
     int curPixelEleIndex = 0;
 //std::unique_ptr<Encoder> encoder;
-    StatsRecorder pixelStatRecorder;
-    StatsRecorder columnChunkStatRecorder;
+    std::unique_ptr<StatsRecorder> pixelStatRecorder;
+    std::unique_ptr<StatsRecorder> columnChunkStatRecorder;
 bool hasNull = false;
     const bool nullsPadding;
     int curPixelVectorIndex = 0;
@@ -33,14 +33,20 @@ public:
     DecimalColumnWriter(std::shared_ptr<TypeDescription> type,std::shared_ptr<PixelsWriterOption> writerOption);
 
     int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void reset() override;
     void close() override;
     void newPixel() override;
     void writeCurPartDecimal(std::shared_ptr<ColumnVector> columnVector, long* values, int curPartLength, int curPartOffset);
     bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
-    pixels::proto::ColumnEncoding getColumnChunkEncoding() const;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
 
 private:
     bool runlengthEncoding;
+    /**
+     * Whether the encoding of the current column chunk has been chosen by the encoding selector.
+     * It is chosen on the first pixel of the chunk, and all the pixels in the chunk use the same encoding.
+     */
+    bool encodingDecided;
     std::unique_ptr<RunLenIntEncoder> encoder;
     std::vector<long> curPixelVector;
 };
@@ -25,4 +25,25 @@
 #ifndef DUCKDB_DOUBLECOLUMNWRITER_H
 #define DUCKDB_DOUBLECOLUMNWRITER_H
 
+#include "ColumnWriter.h"
+#include "vector/DoubleColumnVector.h"
+#include <vector>
+
+/**
+ * The writer of DOUBLE column chunks. The values of each pixel are written in little (or big) endian,
+ * or in byte-stream-split encoding if it is enabled in the writer option and the encoding level is at least EL1.
+ */
+class DoubleColumnWriter : public ColumnWriter {
+public:
+    DoubleColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void newPixel() override;
+    void writeCurPartDouble(std::shared_ptr<DoubleColumnVector> columnVector, double* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+private:
+    bool byteStreamSplit;
+    std::vector<double> curPixelVector; // current pixel value vector haven't written out yet
+};
 #endif // DUCKDB_DOUBLECOLUMNWRITER_H
@@ -25,4 +25,25 @@
 #ifndef DUCKDB_FLOATCOLUMNWRITER_H
 #define DUCKDB_FLOATCOLUMNWRITER_H
 
+#include "ColumnWriter.h"
+#include "vector/DoubleColumnVector.h"
+#include <vector>
+
+/**
+ * The writer of FLOAT column chunks. The values of each pixel are written in little (or big) endian,
+ * or in byte-stream-split encoding if it is enabled in the writer option and the encoding level is at least EL1.
+ */
+class FloatColumnWriter : public ColumnWriter {
+public:
+    FloatColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void newPixel() override;
+    void writeCurPartFloat(std::shared_ptr<DoubleColumnVector> columnVector, float* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+private:
+    bool byteStreamSplit;
+    std::vector<float> curPixelVector; // current pixel value vector haven't written out yet
+};
 #endif // DUCKDB_FLOATCOLUMNWRITER_H
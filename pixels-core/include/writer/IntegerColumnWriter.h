@@ -33,14 +33,21 @@ public:
     IntegerColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
 
     int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void reset() override;
     void close() override;
     void newPixel() override;
-    void writeCurPartLong(std::shared_ptr<ColumnVector> columnVector, long* values, int curPartLength, int curPartOffset);
+    template <typename T>
+    void writeCurPart(std::shared_ptr<ColumnVector> columnVector, T* values, int curPartLength, int curPartOffset);
     bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
     pixels::proto::ColumnEncoding getColumnChunkEncoding();
 private:
     bool isLong; //current column type is long or int, used for the first pixel
     bool runlengthEncoding;
+    /**
+     * Whether the encoding of the current column chunk has been chosen by the encoding selector.
+     * It is chosen on the first pixel of the chunk, and all the pixels in the chunk use the same encoding.
+     */
+    bool encodingDecided;
     std::unique_ptr<RunLenIntEncoder> encoder;
     std::vector<long> curPixelVector; // current pixel value vector haven't written out yet
 
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIXELS_LONGDECIMALCOLUMNWRITER_H
+#define PIXELS_LONGDECIMALCOLUMNWRITER_H
+#include "ColumnWriter.h"
+#include "utils/EncodingUtils.h"
+
+/**
+ * The writer of decimal columns with precision larger than 18.
+ * Each pixel is written in 64-bit integers if all its values fit in 64 bits,
+ * otherwise it is written in 128-bit integers, the lower 64 bits first.
+ * The reader tells the width of a pixel from the minimum and maximum in the pixel statistics.
+ */
+class LongDecimalColumnWriter : public ColumnWriter {
+public:
+    LongDecimalColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void newPixel() override;
+    void writeCurPartLongDecimal(std::shared_ptr<ColumnVector> columnVector, uint64_t* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+
+private:
+    /**
+     * The lower and upper words of the values in the current pixel.
+     */
+    std::vector<uint64_t> curPixelVector;
+    /**
+     * Whether all the values in the current pixel fit in 64 bits.
+     */
+    bool curPixelNarrow;
+};
+
+#endif //PIXELS_LONGDECIMALCOLUMNWRITER_H
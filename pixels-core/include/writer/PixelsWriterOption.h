@@ -27,6 +27,8 @@
 
 #include "encoding/EncodingLevel.h"
 #include <memory>
+#include <map>
+#include <vector>
 #include "physical/natives/ByteOrder.h"
 
 class PixelsWriterOption : public std::enable_shared_from_this<PixelsWriterOption> {
@@ -38,6 +40,24 @@ public:
     std::shared_ptr<PixelsWriterOption> setEncodingLevel(EncodingLevel encodingLevel);
     bool isNullsPadding() const;
     std::shared_ptr<PixelsWriterOption> setNullsPadding(bool nullsPadding);
+    /**
+     * @param columnId the index of the column in the children of the schema
+     */
+    int getCompressionLevel(int columnId) const;
+    std::shared_ptr<PixelsWriterOption> setCompressionLevel(int compressionLevel);
+    std::shared_ptr<PixelsWriterOption> setCompressionLevel(int columnId, int compressionLevel);
+    bool isByteStreamSplit() const;
+    std::shared_ptr<PixelsWriterOption> setByteStreamSplit(bool byteStreamSplit);
+    bool isBloomFilter() const;
+    std::shared_ptr<PixelsWriterOption> setBloomFilter(bool bloomFilter);
+    double getBloomFilterFpp() const;
+    std::shared_ptr<PixelsWriterOption> setBloomFilterFpp(double bloomFilterFpp);
+    const std::vector<int> &getSortKeyColumns() const;
+    std::shared_ptr<PixelsWriterOption> setSortKeyColumns(const std::vector<int> &sortKeyColumns);
+    const std::vector<int> &getPartitionKeyColumns() const;
+    std::shared_ptr<PixelsWriterOption> setPartitionKeyColumns(const std::vector<int> &partitionKeyColumns);
+    int getNumPartitions() const;
+    std::shared_ptr<PixelsWriterOption> setNumPartitions(int numPartitions);
 private:
     int pixelsStride;
     EncodingLevel encodingLevel;
@@ -45,6 +65,32 @@ private:
      * Whether nulls positions in column are padded by arbitrary values and occupy storage and memory space.
      */
     bool nullsPadding;
+    /**
+     * The compression level of the column chunks, columns absent in columnCompressionLevels use the default one.
+     */
+    int compressionLevel = 0;
+    std::map<int, int> columnCompressionLevels;
+    /**
+     * Whether floating point column chunks are written in byte-stream-split encoding.
+     * It only pays off when the column chunks are compressed afterwards.
+     */
+    bool byteStreamSplit = false;
+    /**
+     * Whether a Bloom filter is built for each column chunk of the types supporting it, and its false positive probability.
+     */
+    bool bloomFilter = false;
+    double bloomFilterFpp = 0.01;
+    /**
+     * The ids of the top-level columns by which the rows in each row group are sorted before encoding.
+     * The rows are not sorted if it is empty.
+     */
+    std::vector<int> sortKeyColumns;
+    /**
+     * The ids of the top-level columns by which the rows of a hash partitioned file are partitioned,
+     * and the number of hash partitions. They are recorded in the partition information of each row group.
+     */
+    std::vector<int> partitionKeyColumns;
+    int numPartitions = 0;
     ByteOrder byteOrder{ByteOrder::PIXELS_LITTLE_ENDIAN};
 public:
     ByteOrder getByteOrder() const;
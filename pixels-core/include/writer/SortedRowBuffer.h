@@ -0,0 +1,83 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_SORTEDROWBUFFER_H
+#define PIXELS_SORTEDROWBUFFER_H
+
+#include "TypeDescription.h"
+#include "vector/VectorizedRowBatch.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * Buffers the rows of a row group and emits them sorted by the key columns, so that the column
+ * chunks get longer runs for the run-length and dictionary encodings and tighter pixel statistics.
+ * <p>
+ * The rows are copied into chunks of CHUNK_SIZE rows, nothing is spilled, the writer bounds the
+ * buffered rows by the row group size. Each key is normalized into an order-preserving 64-bit
+ * integer and sorted by an LSD radix sort. The rows with equal normalized keys are ordered by the
+ * full values of strings and long decimals, and then by the following keys. Nulls come first.
+ */
+class SortedRowBuffer {
+public:
+    static const int CHUNK_SIZE;
+    /**
+     * @param schema the schema of the row batches
+     * @param sortKeyColumns the ids of the top-level columns to sort by, in the order of precedence
+     */
+    SortedRowBuffer(const std::shared_ptr<TypeDescription> &schema, const std::vector<int> &sortKeyColumns);
+    /**
+     * Copy the rows of the row batch into this buffer.
+     */
+    void add(const std::shared_ptr<VectorizedRowBatch> &rowBatch);
+    int getNumRows() const;
+    /**
+     * @return the bytes of the memory used by the buffered rows
+     */
+    uint64_t getMemoryUsage() const;
+    /**
+     * Sort the buffered rows and pass them to the consumer in row batches of at most batchSize rows.
+     * The buffer is empty afterwards, the row batch passed to the consumer is reused.
+     */
+    void drain(int batchSize, const std::function<void(const std::shared_ptr<VectorizedRowBatch> &)> &consumer);
+private:
+    /**
+     * Sort the rows in [begin, end) by the keys from keyIndex on, the rows are already equal in the previous keys.
+     */
+    void sort(uint64_t *begin, uint64_t *end, int keyIndex);
+    void radixSort(uint64_t *rowIds, uint64_t *keys, int numRows);
+    uint64_t normalizeKey(int column, uint64_t rowId) const;
+    /**
+     * Compare the values of the non-null rows. It is only needed for the keys that are not exactly normalized.
+     */
+    int compareValues(int column, uint64_t left, uint64_t right) const;
+    bool isNull(int column, uint64_t rowId) const;
+    bool isExactKey(int column) const;
+
+    std::shared_ptr<TypeDescription> schema;
+    std::vector<int> sortKeyColumns;
+    std::vector<TypeDescription::Category> columnCategories;
+    std::vector<std::shared_ptr<VectorizedRowBatch>> chunks;
+    std::shared_ptr<VectorizedRowBatch> outputBatch;
+    int numRows = 0;
+};
+#endif //PIXELS_SORTEDROWBUFFER_H
@@ -29,6 +29,7 @@
 #include "utils/DynamicIntArray.h"
 #include "utils/EncodingUtils.h"
 #include "encoding/RunLenIntEncoder.h"
+#include "encoding/FsstEncoder.h"
 #include <memory>
 #include <vector>
 #include <cstdint>
@@ -38,10 +39,11 @@ public:
 
   // vector should be converted to BinaryColumnVector
   int write(std::shared_ptr<ColumnVector> vector,int length) override;
+  void reset() override;
   void close() override;
   void newPixels() ;
 
-  bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override {};
+  bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override { return false; };
 
   void writeCurPartWithoutDict(std::shared_ptr<BinaryColumnVector> writerOption,duckdb::string_t * values,
                                int* vLens,int* vOffsets,int curPartLength,int curPartOffset);
@@ -50,17 +52,64 @@ public:
 
   void flushStarts();
 
+  pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+
+  void flushDictionary();
+
+  void newPixel() override;
+
+  /**
+   * Choose the encoding of the column chunk among plain, dictionary and FSST by the encoding selector,
+   * and re-encode the string content if plain encoding is not chosen.
+   * It is called after the last pixel is written and before the isNull bitmap is appended.
+   */
+  void selectEncoding();
+
+  /**
+   * Build the dictionary and the run-length encoded ids of the column chunk.
+   * @return the size of the dictionary encoded chunk, or -1 if the cardinality is too high
+   */
+  long tryDictionaryEncode(const uint8_t *content, const std::vector<int> &rawStarts);
+
+  /**
+   * Encode the string content of the column chunk with FSST.
+   * @return the size of the FSST encoded chunk, or -1 if the content is too small
+   */
+  long tryFsstEncode(const uint8_t *content, const std::vector<int> &rawStarts);
+
 
 
     std::vector<long> curPixelVector;
     bool runlengthEncoding;
+    /**
+     * Dictionary encoding is considered for each column chunk if the encoding level is at least EL2.
+     */
     bool dictionaryEncoding;
+    bool dictionaryEncoded = false;
+    std::vector<uint8_t> dictContent;
+    std::vector<uint8_t> encodedDictStarts;
+    int dictionarySize = 0;
+    /**
+     * The ids of the strings, run-length encoded pixel by pixel, and the start position of each pixel.
+     */
+    std::vector<uint8_t> encodedIds;
+    std::vector<int> idPixelPositions;
+    /**
+     * The number of non-null strings written by the end of each pixel.
+     */
+    std::vector<int> pixelStringEnds;
     std::shared_ptr<DynamicIntArray> startsArray;
     std::shared_ptr<EncodingUtils> encodingUtils;
     std::unique_ptr<RunLenIntEncoder> encoder;
     int startOffset = 0;
-    int curPixelIsNullIndex = 0;
-    bool hasNull = false;
+    /**
+     * FSST is considered for each column chunk (row group) if the encoding level is at least EL1.
+     */
+    bool fsstEncoding;
+    bool fsstEncoded = false;
+    std::unique_ptr<FsstEncoder> fsstEncoder;
+    std::vector<uint8_t> fsstContent;
+    std::vector<int> fsstStarts;
 
 
 };
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DUCKDB_STRUCTCOLUMNWRITER_H
+#define DUCKDB_STRUCTCOLUMNWRITER_H
+
+#include "ColumnWriter.h"
+#include "vector/StructColumnVector.h"
+#include <vector>
+
+/**
+ * The writer of STRUCT column chunks. The column chunk of a struct only has the isNull bitmap,
+ * the fields are shredded into their own column chunks by the field writers.
+ */
+class StructColumnWriter : public ColumnWriter {
+public:
+    StructColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void writeCurPartStruct(std::shared_ptr<StructColumnVector> columnVector, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    std::vector<std::shared_ptr<ColumnWriter>> getChildWriters() override;
+    void reset() override;
+    void close() override;
+private:
+    std::vector<std::shared_ptr<ColumnWriter>> fieldWriters;
+};
+#endif // DUCKDB_STRUCTCOLUMNWRITER_H
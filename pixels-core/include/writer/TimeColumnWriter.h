@@ -0,0 +1,51 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIXELS_TIMECOLUMNWRITER_H
+#define PIXELS_TIMECOLUMNWRITER_H
+#include "encoding/RunLenIntEncoder.h"
+#include "ColumnWriter.h"
+
+/**
+ * The writer of time columns. The times are the milliseconds from 00:00:00 in int32,
+ * and they are written in the same way as int columns.
+ */
+class TimeColumnWriter : public ColumnWriter{
+public:
+    TimeColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void reset() override;
+    void close() override;
+    void newPixel() override;
+    void writeCurPartTime(std::shared_ptr<ColumnVector> columnVector, int* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+private:
+    bool runlengthEncoding;
+    /**
+     * Whether the encoding of the current column chunk has been chosen by the encoding selector.
+     * It is chosen on the first pixel of the chunk, and all the pixels in the chunk use the same encoding.
+     */
+    bool encodingDecided;
+    std::unique_ptr<RunLenIntEncoder> encoder;
+    std::vector<long> curPixelVector; // current pixel value vector haven't written out yet
+};
+#endif // PIXELS_TIMECOLUMNWRITER_H
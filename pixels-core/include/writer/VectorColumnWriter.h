@@ -0,0 +1,46 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef DUCKDB_VECTORCOLUMNWRITER_H
+#define DUCKDB_VECTORCOLUMNWRITER_H
+
+#include "ColumnWriter.h"
+#include "vector/VectorColumnVector.h"
+#include <vector>
+
+/**
+ * The writer of VECTOR column chunks. The elements of the vectors in each pixel are written contiguously
+ * as floats, so that the reader can reference a pixel of vectors in the chunk buffer without decoding.
+ */
+class VectorColumnWriter : public ColumnWriter {
+public:
+    VectorColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption);
+
+    int write(std::shared_ptr<ColumnVector> vector, int length) override;
+    void newPixel() override;
+    void writeCurPartVector(std::shared_ptr<VectorColumnVector> columnVector, float* values, int curPartLength, int curPartOffset);
+    bool decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption) override;
+    pixels::proto::ColumnEncoding getColumnChunkEncoding() override;
+private:
+    int dimension;
+    std::vector<float> curPixelVector; // current pixel elements haven't written out yet, dimension floats per row
+};
+#endif // DUCKDB_VECTORCOLUMNWRITER_H
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIXELS_WRITERMEMORYMANAGER_H
+#define PIXELS_WRITERMEMORYMANAGER_H
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+class PixelsWriterImpl;
+
+/**
+ * Tracks the memory of the row groups buffered by the pixels writers in the process, i.e., the
+ * row group being encoded and the row group being flushed by each writer. When the total exceeds
+ * writer.memory.budget, the writer with the largest row group being encoded is requested to
+ * flush its row group early, which it does when its next row batch is added.
+ */
+class WriterMemoryManager {
+public:
+    static WriterMemoryManager & Instance();
+    void addWriter(PixelsWriterImpl *writer);
+    void removeWriter(PixelsWriterImpl *writer);
+    /**
+     * Set the encoded bytes of the row group being encoded by the writer, and request a flush if
+     * the budget is exceeded.
+     */
+    void setEncodingBytes(PixelsWriterImpl *writer, std::int64_t bytes);
+    /**
+     * Set the bytes of the row group being flushed by the writer, it is 0 once the flush is done.
+     */
+    void setFlushingBytes(PixelsWriterImpl *writer, std::int64_t bytes);
+    std::int64_t getBudget() const;
+    std::int64_t getTotalBytes();
+private:
+    WriterMemoryManager();
+    struct WriterMemory {
+        std::int64_t encodingBytes = 0;
+        std::int64_t flushingBytes = 0;
+    };
+    std::int64_t budget;
+    std::int64_t totalBytes;
+    std::unordered_map<PixelsWriterImpl *, WriterMemory> writers;
+    std::mutex lock;
+};
+#endif //PIXELS_WRITERMEMORYMANAGER_H
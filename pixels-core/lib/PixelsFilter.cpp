@@ -3,6 +3,8 @@
 //
 
 #include "PixelsFilter.h"
+#include "utils/BloomFilter.h"
+#include "vector/LongDecimalColumnVector.h"
 
 template<class T, class OP>
 int PixelsFilter::CompareAvx2(void * data, T constant) {
@@ -10,8 +12,25 @@ int PixelsFilter::CompareAvx2(void * data, T constant) {
     __m256i vector_next;
     __m256i constants;
     __m256i mask;
-    if constexpr(sizeof(T) == 4) {
-        vector = _mm256_load_si256((__m256i *)data);
+    if constexpr(std::is_floating_point<T>::value) {
+        // ordered and non-signaling predicates, so that any comparison with NaN is false as in OP::Operation
+        constexpr int predicate = std::is_same<OP, duckdb::Equals>() ? _CMP_EQ_OQ :
+                                  std::is_same<OP, duckdb::LessThan>() ? _CMP_LT_OQ :
+                                  std::is_same<OP, duckdb::LessThanEquals>() ? _CMP_LE_OQ :
+                                  std::is_same<OP, duckdb::GreaterThan>() ? _CMP_GT_OQ : _CMP_GE_OQ;
+        if constexpr(sizeof(T) == 4) {
+            __m256 values = _mm256_loadu_ps((float *)data);
+            return _mm256_movemask_ps(_mm256_cmp_ps(values, _mm256_set1_ps(constant), predicate));
+        } else {
+            __m256d constants_pd = _mm256_set1_pd(constant);
+            __m256d values = _mm256_loadu_pd((double *)data);
+            __m256d values_next = _mm256_loadu_pd((double *)data + 4);
+            int result = _mm256_movemask_pd(_mm256_cmp_pd(values, constants_pd, predicate));
+            result += _mm256_movemask_pd(_mm256_cmp_pd(values_next, constants_pd, predicate)) << 4;
+            return result;
+        }
+    } else if constexpr(sizeof(T) == 4) {
+        vector = _mm256_loadu_si256((__m256i *)data);
         constants = _mm256_set1_epi32(constant);
         if constexpr(std::is_same<OP, duckdb::Equals>()) {
             mask = _mm256_cmpeq_epi32(vector, constants);
@@ -31,8 +50,8 @@ int PixelsFilter::CompareAvx2(void * data, T constant) {
         }
     } else if constexpr(sizeof(T) == 8) {
         constants = _mm256_set1_epi64x(constant);
-        vector = _mm256_load_si256((__m256i *)data);
-        vector_next = _mm256_load_si256((__m256i *)((uint8_t *)data + 32));
+        vector = _mm256_loadu_si256((__m256i *)data);
+        vector_next = _mm256_loadu_si256((__m256i *)((uint8_t *)data + 32));
         int result = 0;
         if constexpr(std::is_same<OP, duckdb::Equals>()) {
             mask = _mm256_cmpeq_epi64(vector, constants);
@@ -71,92 +90,137 @@ int PixelsFilter::CompareAvx2(void * data, T constant) {
 }
 
 
+template <class T, class OP, class V>
+void PixelsFilter::FilterValues(const V * values, T constant, PixelsBitMask &filter_mask, int start, int length) {
+    int i = start;
+    int end = start + length;
+#ifdef ENABLE_SIMD_FILTER
+    // the mask is set a byte at a time, so the SIMD loop starts at a multiple of 8
+    for (; i < end && i % 8 != 0; i++) {
+        filter_mask.set(i, OP::Operation((T)values[i], constant));
+    }
+    for (; i + 8 <= end; i += 8) {
+        uint8_t mask = CompareAvx2<T, OP>((void *)(values + i), constant);
+        filter_mask.setByteAligned(i, mask);
+    }
+#endif
+    for (; i < end; i++) {
+        filter_mask.set(i, OP::Operation((T)values[i], constant));
+    }
+}
+
 template <class T, class OP>
 void PixelsFilter::TemplatedFilterOperation(std::shared_ptr<ColumnVector> vector,
                               const duckdb::Value &constant, PixelsBitMask &filter_mask,
-                                            std::shared_ptr<TypeDescription> type) {
+                                            std::shared_ptr<TypeDescription> type, int start, int length) {
     T constant_value = constant.template GetValueUnsafe<T>();
+    int end = start + length;
     switch (type->getCategory()) {
         case TypeDescription::SHORT:
         case TypeDescription::INT: {
             auto longColumnVector = std::static_pointer_cast<LongColumnVector>(vector);
-            int i = 0;
-#ifdef  ENABLE_SIMD_FILTER
-            for (; i < vector->length - vector->length % 8; i += 8) {
-                uint8_t mask = CompareAvx2<T, OP>(longColumnVector->intVector + i, constant_value);
-                filter_mask.setByteAligned(i, mask);
-            }
-#endif
-            for (; i < vector->length; i++) {
-                filter_mask.set(i, OP::Operation((T)longColumnVector->intVector[i],
-                                                                 constant_value));
-            }
+            FilterValues<T, OP>(longColumnVector->intVector, constant_value, filter_mask, start, length);
             break;
         }
         case TypeDescription::LONG: {
             auto longColumnVector = std::static_pointer_cast<LongColumnVector>(vector);
-            int i = 0;
-#ifdef ENABLE_SIMD_FILTER
-            for (; i < vector->length - vector->length % 8; i += 8) {
-                uint8_t mask = CompareAvx2<T, OP>(longColumnVector->longVector + i, constant_value);
-                filter_mask.setByteAligned(i, mask);
-            }
-#endif
-            for(; i < vector->length; i++) {
-                filter_mask.set(i, OP::Operation((T)longColumnVector->longVector[i],
-                                                 constant_value));
-            }
+            FilterValues<T, OP>(longColumnVector->longVector, constant_value, filter_mask, start, length);
             break;
         }
         case TypeDescription::DATE: {
             auto dateColumnVector = std::static_pointer_cast<DateColumnVector>(vector);
-            int i = 0;
-#ifdef ENABLE_SIMD_FILTER
-            for (; i < vector->length - vector->length % 8; i += 8) {
-                uint8_t mask = CompareAvx2<T, OP>(dateColumnVector->dates + i, constant_value);
-                filter_mask.setByteAligned(i, mask);
+            FilterValues<T, OP>(dateColumnVector->dates, constant_value, filter_mask, start, length);
+            break;
+        }
+        case TypeDescription::TIME: {
+            // the times are in milliseconds, whereas DuckDB compares times in microseconds
+            if constexpr(std::is_same<T, int64_t>::value) {
+                auto timeColumnVector = std::static_pointer_cast<TimeColumnVector>(vector);
+                for (int i = start; i < end; i++) {
+                    filter_mask.set(i, OP::Operation((T)timeColumnVector->times[i] * 1000,
+                                                                     constant_value));
+                }
             }
-#endif
-            for (; i < vector->length; i++) {
-                filter_mask.set(i, OP::Operation((T)dateColumnVector->dates[i],
+            break;
+        }
+        case TypeDescription::BOOLEAN: {
+            auto byteColumnVector = std::static_pointer_cast<ByteColumnVector>(vector);
+            int i = start;
+            if (byteColumnVector->bitVector != nullptr) {
+                // evaluate the predicate on the bitmap: rows of true take the result for true, and vice versa
+                uint8_t trueMask = OP::Operation((T)true, constant_value) ? 0xFF : 0;
+                uint8_t falseMask = OP::Operation((T)false, constant_value) ? 0xFF : 0;
+                for (; i < end && i % 8 != 0; i++) {
+                    filter_mask.set(i, OP::Operation((T)byteColumnVector->vector[i], constant_value));
+                }
+                for (; i + 8 <= end; i += 8) {
+                    uint8_t bits = byteColumnVector->bitVector[i / 8];
+                    filter_mask.setByteAligned(i, (bits & trueMask) | (~bits & falseMask));
+                }
+            }
+            for (; i < end; i++) {
+                filter_mask.set(i, OP::Operation((T)byteColumnVector->vector[i],
                                                                  constant_value));
             }
             break;
         }
-        case TypeDescription::DECIMAL: {
-            auto decimalColumnVector = std::static_pointer_cast<DecimalColumnVector>(vector);
-            int i = 0;
-#ifdef ENABLE_SIMD_FILTER
-            for (; i < vector->length - vector->length % 8; i += 8) {
-                uint8_t mask = CompareAvx2<T, OP>(decimalColumnVector->vector + i, constant_value);
-                filter_mask.setByteAligned(i, mask);
-            }
-#endif
-            for (; i < vector->length; i++) {
-                filter_mask.set(i, OP::Operation((T)decimalColumnVector->vector[i],
+        case TypeDescription::BYTE: {
+            auto byteColumnVector = std::static_pointer_cast<ByteColumnVector>(vector);
+            for (int i = start; i < end; i++) {
+                filter_mask.set(i, OP::Operation((T)(int8_t)byteColumnVector->vector[i],
                                                                  constant_value));
             }
             break;
         }
+        case TypeDescription::FLOAT: {
+            auto doubleColumnVector = std::static_pointer_cast<DoubleColumnVector>(vector);
+            FilterValues<T, OP>(doubleColumnVector->floatVector, constant_value, filter_mask, start, length);
+            break;
+        }
+        case TypeDescription::DOUBLE: {
+            auto doubleColumnVector = std::static_pointer_cast<DoubleColumnVector>(vector);
+            FilterValues<T, OP>(doubleColumnVector->doubleVector, constant_value, filter_mask, start, length);
+            break;
+        }
+        case TypeDescription::DECIMAL: {
+            auto decimalColumnVector = std::static_pointer_cast<DecimalColumnVector>(vector);
+            FilterValues<T, OP>(decimalColumnVector->vector, constant_value, filter_mask, start, length);
+            break;
+        }
         case TypeDescription::STRING:
         case TypeDescription::BINARY:
         case TypeDescription::VARBINARY:
         case TypeDescription::CHAR:
         case TypeDescription::VARCHAR: {
             auto binaryColumnVector = std::static_pointer_cast<BinaryColumnVector>(vector);
-            for (int i = 0; i < vector->length; i++) {
+            for (int i = start; i < end; i++) {
                 filter_mask.set(i, OP::Operation((duckdb::string_t)binaryColumnVector->vector[i],
                                                                  (duckdb::string_t)constant_value));
             }
             break;
         }
+        default:
+            throw InvalidArgumentException("Unsupported type for filter. ");
+    }
+}
+
+template <class OP>
+void PixelsFilter::LongDecimalFilterOperation(std::shared_ptr<ColumnVector> vector,
+                                              const duckdb::Value &constant, PixelsBitMask &filter_mask,
+                                              int start, int length) {
+    auto constant_value = constant.template GetValueUnsafe<duckdb::hugeint_t>();
+    auto longDecimalColumnVector = std::static_pointer_cast<LongDecimalColumnVector>(vector);
+    // the lower and upper words of the values are laid out as hugeint_t
+    auto values = reinterpret_cast<duckdb::hugeint_t *>(longDecimalColumnVector->vector);
+    for (int i = start; i < start + length; i++) {
+        filter_mask.set(i, OP::Operation(values[i], constant_value));
     }
 }
 
 template <class OP>
 void PixelsFilter::FilterOperationSwitch(std::shared_ptr<ColumnVector> vector, duckdb::Value &constant,
                                          PixelsBitMask &filter_mask,
-                                         std::shared_ptr<TypeDescription> type) {
+                                         std::shared_ptr<TypeDescription> type, int start, int length) {
     if (filter_mask.isNone()) {
         return;
     }
@@ -164,20 +228,37 @@ void PixelsFilter::FilterOperationSwitch(std::shared_ptr<ColumnVector> vector, d
         case TypeDescription::SHORT:
         case TypeDescription::INT:
         case TypeDescription::DATE:
-            TemplatedFilterOperation<int32_t, OP>(vector, constant, filter_mask, type);
+            TemplatedFilterOperation<int32_t, OP>(vector, constant, filter_mask, type, start, length);
             break;
         case TypeDescription::LONG:
-            TemplatedFilterOperation<int64_t, OP>(vector, constant, filter_mask, type);
+        case TypeDescription::TIME:
+            TemplatedFilterOperation<int64_t, OP>(vector, constant, filter_mask, type, start, length);
             break;
         case TypeDescription::DECIMAL:
-            TemplatedFilterOperation<int64_t, OP>(vector, constant, filter_mask, type);
+            if (type->getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
+                LongDecimalFilterOperation<OP>(vector, constant, filter_mask, start, length);
+            } else {
+                TemplatedFilterOperation<int64_t, OP>(vector, constant, filter_mask, type, start, length);
+            }
+            break;
+        case TypeDescription::BOOLEAN:
+            TemplatedFilterOperation<bool, OP>(vector, constant, filter_mask, type, start, length);
+            break;
+        case TypeDescription::BYTE:
+            TemplatedFilterOperation<int8_t, OP>(vector, constant, filter_mask, type, start, length);
+            break;
+        case TypeDescription::FLOAT:
+            TemplatedFilterOperation<float, OP>(vector, constant, filter_mask, type, start, length);
+            break;
+        case TypeDescription::DOUBLE:
+            TemplatedFilterOperation<double, OP>(vector, constant, filter_mask, type, start, length);
             break;
         case TypeDescription::STRING:
         case TypeDescription::BINARY:
         case TypeDescription::VARBINARY:
         case TypeDescription::CHAR:
         case TypeDescription::VARCHAR:
-            TemplatedFilterOperation<duckdb::string_t, OP>(vector, constant, filter_mask, type);
+            TemplatedFilterOperation<duckdb::string_t, OP>(vector, constant, filter_mask, type, start, length);
             break;
         default:
             throw InvalidArgumentException("Unsupported type for filter. ");
@@ -187,12 +268,18 @@ void PixelsFilter::FilterOperationSwitch(std::shared_ptr<ColumnVector> vector, d
 void PixelsFilter::ApplyFilter(std::shared_ptr<ColumnVector> vector, duckdb::TableFilter &filter,
                                PixelsBitMask& filterMask,
                                std::shared_ptr<TypeDescription> type) {
+    ApplyFilter(vector, filter, filterMask, type, 0, (int) vector->length);
+}
+
+void PixelsFilter::ApplyFilter(std::shared_ptr<ColumnVector> vector, duckdb::TableFilter &filter,
+                               PixelsBitMask& filterMask,
+                               std::shared_ptr<TypeDescription> type, int start, int length) {
     switch (filter.filter_type) {
         case duckdb::TableFilterType::CONJUNCTION_AND: {
             auto &conjunction = (duckdb::ConjunctionAndFilter &)filter;
             for (auto &child_filter : conjunction.child_filters) {
                 PixelsBitMask childMask(filterMask.maskLength);
-                ApplyFilter(vector, *child_filter, childMask, type);
+                ApplyFilter(vector, *child_filter, childMask, type, start, length);
                 filterMask.And(childMask);
             }
             break;
@@ -200,9 +287,13 @@ void PixelsFilter::ApplyFilter(std::shared_ptr<ColumnVector> vector, duckdb::Tab
         case duckdb::TableFilterType::CONJUNCTION_OR: {
             auto &conjunction = (duckdb::ConjunctionOrFilter &)filter;
             PixelsBitMask orMask(filterMask.maskLength);
+            // the rows out of [start, start + length) are kept as they are by the And below
+            for (int i = start; i < start + length; i++) {
+                orMask.set(i, 0);
+            }
             for (auto &childFilter : conjunction.child_filters) {
                 PixelsBitMask childMask(filterMask);
-                ApplyFilter(vector, *childFilter, childMask, type);
+                ApplyFilter(vector, *childFilter, childMask, type, start, length);
                 orMask.Or(childMask);
             }
             filterMask.And(orMask);
@@ -213,23 +304,23 @@ void PixelsFilter::ApplyFilter(std::shared_ptr<ColumnVector> vector, duckdb::Tab
             switch (constant_filter.comparison_type) {
                 case duckdb::ExpressionType::COMPARE_EQUAL:
                     FilterOperationSwitch<duckdb::Equals>(
-                            vector, constant_filter.constant, filterMask, type);
+                            vector, constant_filter.constant, filterMask, type, start, length);
                     break;
                 case duckdb::ExpressionType::COMPARE_LESSTHAN:
                     FilterOperationSwitch<duckdb::LessThan>(
-                            vector, constant_filter.constant, filterMask, type);
+                            vector, constant_filter.constant, filterMask, type, start, length);
                     break;
                 case duckdb::ExpressionType::COMPARE_LESSTHANOREQUALTO:
                     FilterOperationSwitch<duckdb::LessThanEquals>(
-                            vector, constant_filter.constant, filterMask, type);
+                            vector, constant_filter.constant, filterMask, type, start, length);
                     break;
                 case duckdb::ExpressionType::COMPARE_GREATERTHAN:
                     FilterOperationSwitch<duckdb::GreaterThan>(
-                            vector, constant_filter.constant, filterMask, type);
+                            vector, constant_filter.constant, filterMask, type, start, length);
                     break;
                 case duckdb::ExpressionType::COMPARE_GREATERTHANOREQUALTO:
                     FilterOperationSwitch<duckdb::GreaterThanEquals>(
-                            vector, constant_filter.constant, filterMask, type);
+                            vector, constant_filter.constant, filterMask, type, start, length);
                     break;
                 default:
                     D_ASSERT(0);
@@ -248,6 +339,154 @@ void PixelsFilter::ApplyFilter(std::shared_ptr<ColumnVector> vector, duckdb::Tab
     }
 }
 
+bool PixelsFilter::BloomFilterMightMatch(const duckdb::TableFilter &filter, const std::string &bloomFilter,
+                                         const std::shared_ptr<TypeDescription> &type) {
+    switch (filter.filter_type) {
+        case duckdb::TableFilterType::CONJUNCTION_AND: {
+            auto &conjunction = (const duckdb::ConjunctionAndFilter &)filter;
+            for (auto &childFilter : conjunction.child_filters) {
+                if (!BloomFilterMightMatch(*childFilter, bloomFilter, type)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case duckdb::TableFilterType::CONJUNCTION_OR: {
+            auto &conjunction = (const duckdb::ConjunctionOrFilter &)filter;
+            for (auto &childFilter : conjunction.child_filters) {
+                if (BloomFilterMightMatch(*childFilter, bloomFilter, type)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        case duckdb::TableFilterType::CONSTANT_COMPARISON: {
+            auto &constantFilter = (const duckdb::ConstantFilter &)filter;
+            if (constantFilter.comparison_type != duckdb::ExpressionType::COMPARE_EQUAL ||
+                constantFilter.constant.IsNull()) {
+                return true;
+            }
+            uint64_t hash;
+            if (!HashConstant(constantFilter.constant, type, hash)) {
+                return true;
+            }
+            return BloomFilter::mightContain(bloomFilter, hash);
+        }
+        default:
+            return true;
+    }
+}
 
+/**
+ * Read an integer, date or decimal constant as a 128-bit integer. DuckDB stores a decimal of width w
+ * in the narrowest integer type that holds w digits, and the bytes beyond that type are undefined.
+ * @return false if the constant is not stored as an integer
+ */
+static bool IntegerConstant(const duckdb::Value &constant, int64_t &upper, uint64_t &lower) {
+    int64_t value;
+    switch (constant.type().InternalType()) {
+        case duckdb::PhysicalType::INT16:
+            value = constant.GetValueUnsafe<int16_t>();
+            break;
+        case duckdb::PhysicalType::INT32:
+            value = constant.GetValueUnsafe<int32_t>();
+            break;
+        case duckdb::PhysicalType::INT64:
+            value = constant.GetValueUnsafe<int64_t>();
+            break;
+        case duckdb::PhysicalType::INT128: {
+            auto hugeValue = constant.GetValueUnsafe<duckdb::hugeint_t>();
+            upper = hugeValue.upper;
+            lower = hugeValue.lower;
+            return true;
+        }
+        default:
+            return false;
+    }
+    upper = value < 0 ? -1 : 0;
+    lower = (uint64_t) value;
+    return true;
+}
 
+bool PixelsFilter::HashConstant(const duckdb::Value &constant, const std::shared_ptr<TypeDescription> &type,
+                                uint64_t &hash) {
+    // the constant is hashed in the same way as the values by BloomFilter::hashValues
+    int64_t upper;
+    uint64_t lower;
+    switch (type->getCategory()) {
+        case TypeDescription::SHORT:
+        case TypeDescription::INT:
+        case TypeDescription::DATE:
+        case TypeDescription::LONG:
+        case TypeDescription::DECIMAL:
+            if (!IntegerConstant(constant, upper, lower)) {
+                return false;
+            }
+            if (type->getCategory() == TypeDescription::DECIMAL &&
+                type->getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
+                hash = BloomFilter::hash(upper, lower);
+                return true;
+            }
+            if (upper != ((int64_t) lower >> 63)) {
+                // out of the range of the column, it can not be ruled out by the hash
+                return false;
+            }
+            hash = BloomFilter::hash((int64_t) lower);
+            return true;
+        case TypeDescription::STRING:
+        case TypeDescription::VARCHAR:
+        case TypeDescription::BINARY:
+        case TypeDescription::VARBINARY: {
+            auto value = (duckdb::string_t) constant;
+            hash = BloomFilter::hash(value.GetData(), value.GetSize());
+            return true;
+        }
+        default:
+            return false;
+    }
+}
 
+bool PixelsFilter::EqualityConstantHashes(const duckdb::TableFilter &filter, const std::shared_ptr<TypeDescription> &type,
+                                          std::vector<uint64_t> &hashes) {
+    switch (filter.filter_type) {
+        case duckdb::TableFilterType::CONJUNCTION_AND: {
+            // the matching values are in the constants of any child
+            auto &conjunction = (const duckdb::ConjunctionAndFilter &)filter;
+            for (auto &childFilter : conjunction.child_filters) {
+                std::vector<uint64_t> childHashes;
+                if (EqualityConstantHashes(*childFilter, type, childHashes)) {
+                    hashes.insert(hashes.end(), childHashes.begin(), childHashes.end());
+                    return true;
+                }
+            }
+            return false;
+        }
+        case duckdb::TableFilterType::CONJUNCTION_OR: {
+            auto &conjunction = (const duckdb::ConjunctionOrFilter &)filter;
+            for (auto &childFilter : conjunction.child_filters) {
+                if (!EqualityConstantHashes(*childFilter, type, hashes)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case duckdb::TableFilterType::CONSTANT_COMPARISON: {
+            auto &constantFilter = (const duckdb::ConstantFilter &)filter;
+            if (constantFilter.comparison_type != duckdb::ExpressionType::COMPARE_EQUAL) {
+                return false;
+            }
+            if (constantFilter.constant.IsNull()) {
+                // nothing equals null
+                return true;
+            }
+            uint64_t hash;
+            if (!HashConstant(constantFilter.constant, type, hash)) {
+                return false;
+            }
+            hashes.push_back(hash);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
@@ -68,6 +68,31 @@ bool PixelsReaderImpl::isPartitioned() {
 	return postScript.has_partitioned() && postScript.partitioned();
 }
 
+std::vector<int> PixelsReaderImpl::getPartitionKeyColumns() {
+	std::vector<int> partitionKeyColumns;
+	if(!isPartitioned() || footer.rowgroupinfos_size() == 0) {
+		return partitionKeyColumns;
+	}
+	// all the row groups are partitioned by the same key columns, which are recorded by their type ids
+	auto children = fileSchema->getChildren();
+	for(uint32_t columnId : footer.rowgroupinfos(0).partitioninfo().columnids()) {
+		for(int i = 0; i < children.size(); i++) {
+			if(children.at(i)->getId() == columnId) {
+				partitionKeyColumns.push_back(i);
+				break;
+			}
+		}
+	}
+	return partitionKeyColumns;
+}
+
+int PixelsReaderImpl::getNumPartitions() {
+	if(!isPartitioned() || footer.rowgroupinfos_size() == 0) {
+		return 0;
+	}
+	return footer.rowgroupinfos(0).partitioninfo().numpartitions();
+}
+
 ColumnStatisticList PixelsReaderImpl::getColumnStats() {
 	return footer.columnstats();
 }
@@ -80,7 +105,12 @@ pixels::proto::ColumnStatistic PixelsReaderImpl::getColumnStat(std::string colum
 										 columnName + " is not the field name!");
 	}
 	int fieldId = fieldIter - fieldNames.begin();
-	return footer.columnstats().Get(fieldId);
+	// the column statistics are in the order of the column chunks, which includes the nested columns
+	int columnId = fileSchema->getChildren().at(fieldId)->getId() - 1;
+	if(columnId >= footer.columnstats_size()) {
+		throw InvalidArgumentException("the statistics of column " + columnName + " do not exist!");
+	}
+	return footer.columnstats().Get(columnId);
 }
 
 RowGroupInfoList PixelsReaderImpl::getRowGroupInfos() {
@@ -88,14 +118,14 @@ RowGroupInfoList PixelsReaderImpl::getRowGroupInfos() {
 }
 
 pixels::proto::RowGroupInformation PixelsReaderImpl::getRowGroupInfo(int rowGroupId) {
-	if(rowGroupId < 0 || rowGroupId >= footer.columnstats_size()) {
+	if(rowGroupId < 0 || rowGroupId >= footer.rowgroupinfos_size()) {
 		throw InvalidArgumentException("row group id is out of bound.");
 	}
 	return footer.rowgroupinfos().Get(rowGroupId);
 }
 
 pixels::proto::RowGroupStatistic PixelsReaderImpl::getRowGroupStat(int rowGroupId) {
-	if(rowGroupId < 0 || rowGroupId >= footer.columnstats_size()) {
+	if(rowGroupId < 0 || rowGroupId >= footer.rowgroupstats_size()) {
 		throw InvalidArgumentException("row group id is out of bound.");
 	}
 	return footer.rowgroupstats().Get(rowGroupId);
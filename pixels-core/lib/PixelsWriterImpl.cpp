@@ -35,6 +35,10 @@
 #include "physical/PhysicalReader.h"
 #include "physical/PhysicalReaderUtil.h"
 #include "PixelsVersion.h"
+#include "compression/CompressionCodecFactory.h"
+#include "utils/ThreadPool.h"
+#include "writer/WriterMemoryManager.h"
+#include "exception/InvalidArgumentException.h"
 
 const int PixelsWriterImpl::CHUNK_ALIGNMENT = std::stoi(ConfigFactory::Instance().getProperty("column.chunk.alignment"));
 
@@ -44,13 +48,54 @@ PixelsWriterImpl::PixelsWriterImpl(std::shared_ptr<TypeDescription> schema, int
                                    const std::string &targetFilePath, int blockSize, bool blockPadding,
                                    EncodingLevel encodingLevel, bool nullsPadding, bool partitioned,int compressionBlockSize)
                                    : schema(schema), rowGroupSize(rowGroupSize), compressionBlockSize(compressionBlockSize) {
-    this->columnWriterOption = std::make_shared<PixelsWriterOption>()->setPixelsStride(pixelsStride)->setEncodingLevel(encodingLevel)->setNullsPadding(nullsPadding);
+    this->columnWriterOption = std::make_shared<PixelsWriterOption>()->setPixelsStride(pixelsStride)->setEncodingLevel(encodingLevel)->setNullsPadding(nullsPadding)
+            ->setCompressionLevel(std::stoi(ConfigFactory::Instance().getProperty("column.chunk.compression.level")));
     this->physicalWriter = PhysicalWriterUtil::newPhysicalWriter(targetFilePath, blockSize, blockPadding, false);
-    this->compressionKind = pixels::proto::CompressionKind::NONE;
+    this->compressionKind = CompressionCodecFactory::parseCompressionKind(
+            ConfigFactory::Instance().getProperty("column.chunk.compression"));
+    // make sure the codec is supported before writing anything
+    CompressionCodecFactory::Instance()->getCodec(compressionKind);
+    // byte-stream-split only makes the floating point chunks more compressible, it is useless without compression
+    this->columnWriterOption->setByteStreamSplit(compressionKind != pixels::proto::NONE &&
+            ConfigFactory::Instance().boolCheckProperty("column.chunk.byte.stream.split"));
+    this->columnWriterOption->setBloomFilter(ConfigFactory::Instance().boolCheckProperty("column.chunk.bloom.filter"))
+            ->setBloomFilterFpp(std::stod(ConfigFactory::Instance().getProperty("column.chunk.bloom.filter.fpp")));
     // this->timeZone = std::unique_ptr<icu::TimeZone>(icu::TimeZone::createDefault());
     this->children = schema->getChildren();
     this->partitioned=partitioned;
+    for(const auto& child:children){
+        newFileColStatRecorders(child);
+    }
+
+    newColumnWriters();
+    WriterMemoryManager::Instance().addWriter(this);
+}
+
+PixelsWriterImpl::~PixelsWriterImpl() {
+    // the flush stage of the last row group refers to this writer, wait for it if the writer is
+    // destroyed without close(), e.g., after an error
+    try{
+        waitForPendingRowGroup();
+    }
+    catch (const std::exception& e){
+        std::cerr << "failed to flush the pending row group: " << e.what() << std::endl;
+    }
+    WriterMemoryManager::Instance().removeWriter(this);
+}
 
+void PixelsWriterImpl::requestRowGroupFlush() {
+    rowGroupFlushRequested = true;
+}
+
+void PixelsWriterImpl::newFileColStatRecorders(const std::shared_ptr<TypeDescription>& type) {
+    fileColStatRecorders.push_back(StatsRecorder::create(*type));
+    for(const auto& child:type->getChildren()){
+        newFileColStatRecorders(child);
+    }
+}
+
+void PixelsWriterImpl::newColumnWriters() {
+    columnWriters.clear();
     for(int i=0;i<children.size();i++){
         columnWriters.push_back(ColumnWriterBuilder::newColumnWriter(children.at(i),columnWriterOption));
     }
@@ -58,28 +103,146 @@ PixelsWriterImpl::PixelsWriterImpl(std::shared_ptr<TypeDescription> schema, int
 
 bool PixelsWriterImpl::addRowBatch(std::shared_ptr<VectorizedRowBatch> rowBatch) {
     std::cout << "PixelsWriterImpl::addRowBatch" << std::endl;
-    curRowGroupDataLength=0;
+    if(partitioned){
+        throw InvalidArgumentException("this file is hash partitioned, use addRowBatch(rowBatch, hashValue) instead");
+    }
+    return writeRowBatch(rowBatch);
+}
+
+bool PixelsWriterImpl::addRowBatch(std::shared_ptr<VectorizedRowBatch> rowBatch, int hashValue) {
+    if(!partitioned){
+        throw InvalidArgumentException("this file is not hash partitioned, use addRowBatch(rowBatch) instead");
+    }
+    if(columnWriterOption->getPartitionKeyColumns().empty()){
+        throw InvalidArgumentException("the partition key columns of the hash partitioned file are not set");
+    }
+    if(hashValue<0||hashValue>=columnWriterOption->getNumPartitions()){
+        throw InvalidArgumentException("hash value " + std::to_string(hashValue) + " is out of the range of " +
+                                       std::to_string(columnWriterOption->getNumPartitions()) + " partitions");
+    }
+    bool rowGroupAdded=false;
+    if(hashValueIsSet&&hashValue!=currHashValue){
+        // each row group only holds the rows of one partition, so the rows of the previous partition are flushed
+        if(sortBuffer!=nullptr&&sortBuffer->getNumRows()>0){
+            writeSortedRows();
+        }
+        if(curRowGroupNumOfRows>0){
+            flushRowGroup();
+            rowGroupAdded=true;
+        }
+    }
+    currHashValue=hashValue;
+    hashValueIsSet=true;
+    return writeRowBatch(rowBatch)&&!rowGroupAdded;
+}
+
+bool PixelsWriterImpl::writeRowBatch(const std::shared_ptr<VectorizedRowBatch> &rowBatch) {
+    const auto& sortKeyColumns=columnWriterOption->getSortKeyColumns();
+    if(!sortKeyColumns.empty()){
+        // the rows are encoded when the row group is full, as the size of the encoded rows is unknown
+        // until then, the row group is bounded by the memory of the buffered rows instead
+        if(sortBuffer==nullptr){
+            sortBuffer=std::make_unique<SortedRowBuffer>(schema, sortKeyColumns);
+        }
+        sortBuffer->add(rowBatch);
+        std::int64_t bufferedBytes=sortBuffer->getMemoryUsage();
+        WriterMemoryManager::Instance().setEncodingBytes(this, bufferedBytes);
+        bool flushRequested=rowGroupFlushRequested.exchange(false);
+        if(bufferedBytes>=rowGroupSize||(flushRequested&&sortBuffer->getNumRows()>0)){
+            writeSortedRows();
+            flushRowGroup();
+            return false;
+        }
+        return true;
+    }
     curRowGroupNumOfRows+=rowBatch->count();
     writeColumnVectors(rowBatch->cols,rowBatch->count());
+    WriterMemoryManager::Instance().setEncodingBytes(this, curRowGroupDataLength+curRowGroupBloomFilterBytes);
 
-    if(curRowGroupDataLength>=rowGroupSize){
-        writeRowGroup();
-        curRowGroupNumOfRows=0L;
+    // the row group is also cut early if the memory budget of the writers is exceeded and it is the largest one
+    bool flushRequested=rowGroupFlushRequested.exchange(false);
+    if(curRowGroupDataLength>=rowGroupSize||(flushRequested&&curRowGroupNumOfRows>0)){
+        flushRowGroup();
         return false;
     }
     return true;
 }
 
+void PixelsWriterImpl::writeSortedRows() {
+    sortBuffer->drain(columnWriterOption->getPixelsStride(), [this](const std::shared_ptr<VectorizedRowBatch>& sortedBatch){
+        curRowGroupNumOfRows+=sortedBatch->count();
+        writeColumnVectors(sortedBatch->cols,sortedBatch->count());
+    });
+}
+
+void PixelsWriterImpl::flushRowGroup() {
+    // at most one row group is being flushed, which bounds the memory of the pending column chunks
+    waitForPendingRowGroup();
+    // hand the full row group over to the flush stage and continue encoding into the spare column writers,
+    // so that the following row batches are encoded while this row group is being flushed
+    std::vector<std::shared_ptr<ColumnWriter>> rowGroupWriters;
+    rowGroupWriters.swap(columnWriters);
+    int rowGroupNumOfRows=curRowGroupNumOfRows;
+    std::int64_t rowGroupMemory=curRowGroupDataLength+curRowGroupBloomFilterBytes;
+    int hashValue=currHashValue;
+    try{
+        if(!spareColumnWriters.empty()){
+            columnWriters.swap(spareColumnWriters);
+        }
+        else{
+            newColumnWriters();
+        }
+        WriterMemoryManager::Instance().setFlushingBytes(this, rowGroupMemory);
+        pendingRowGroup=ThreadPool::FlushInstance().submit([this, rowGroupWriters, rowGroupNumOfRows, hashValue]() {
+            try{
+                writeRowGroup(rowGroupWriters, rowGroupNumOfRows, hashValue);
+            } catch(...){
+                recycleColumnWriters(rowGroupWriters);
+                throw;
+            }
+            recycleColumnWriters(rowGroupWriters);
+        });
+    } catch(...){
+        // the row group stays in the column writers of this writer, so that close() still writes it
+        columnWriters.swap(rowGroupWriters);
+        WriterMemoryManager::Instance().setFlushingBytes(this, 0);
+        throw;
+    }
+    curRowGroupNumOfRows=0L;
+    curRowGroupDataLength=0;
+    curRowGroupBloomFilterBytes=0;
+    WriterMemoryManager::Instance().setEncodingBytes(this, 0);
+}
+
+void PixelsWriterImpl::recycleColumnWriters(const std::vector<std::shared_ptr<ColumnWriter>>& rowGroupWriters) {
+    // the writers keep their buffers and encode the row group after the next one
+    std::int64_t capacity=0;
+    for(const auto& writer:rowGroupWriters){
+        writer->reset();
+        capacity+=writer->getBufferCapacity();
+    }
+    spareColumnWriters=rowGroupWriters;
+    // the idle buffers are reported as flushing until the spare writers are taken by the next row group
+    WriterMemoryManager::Instance().setFlushingBytes(this, capacity);
+}
+
+void PixelsWriterImpl::waitForPendingRowGroup() {
+    if(pendingRowGroup.valid()){
+        // rethrows the exception of the flush stage
+        pendingRowGroup.get();
+    }
+}
+
 void PixelsWriterImpl::writeColumnVectors(std::vector<std::shared_ptr<ColumnVector>>& columnVectors, int rowBatchSize)
 {
     std::vector<std::future<void>> futures;
-    std::atomic<int> dataLength(0);
+    std::atomic<std::int64_t> dataLength(0);
     int commonColumnLength = columnVectors.size() ;
 
-    // Writing regular columns
+    // Writing regular columns on the thread pool shared by the writers
     for (int i = 0; i < commonColumnLength; ++i) {
        // dataLength += columnWriters[i]->write(columnVectors[i], rowBatchSize);
-       futures.emplace_back(std::async(std::launch::async, [this, columnVectors, rowBatchSize, i, &dataLength]() {
+       futures.emplace_back(ThreadPool::Instance().submit([this, &columnVectors, rowBatchSize, i, &dataLength]() {
            try {
                dataLength += columnWriters[i]->write(columnVectors[i], rowBatchSize);
            } catch (const std::exception& e) {
@@ -94,41 +257,104 @@ void PixelsWriterImpl::writeColumnVectors(std::vector<std::shared_ptr<ColumnVect
         future.get();  // Blocking until all tasks are completed
     }
 
-    // Simulate curRowGroupDataLength accumulation
-    curRowGroupDataLength += dataLength.load();
+    // each column writer returns the size of the content it has encoded in the current row group
+    curRowGroupDataLength = dataLength.load();
+    // the hashes kept for the Bloom filters are not in the encoded content, but take memory until the flush
+    curRowGroupBloomFilterBytes = 0;
+    for (const auto& columnWriter : columnWriters) {
+        curRowGroupBloomFilterBytes += columnWriter->getBloomFilterMemoryUsage();
+    }
     std::cout << "Data length written: " << curRowGroupDataLength << std::endl;
 }
 
 void PixelsWriterImpl::close(){
     try{
+        waitForPendingRowGroup();
+        if(sortBuffer!=nullptr&&sortBuffer->getNumRows()>0){
+            writeSortedRows();
+        }
         if(curRowGroupNumOfRows!=0){
-            writeRowGroup();
+            writeRowGroup(columnWriters, curRowGroupNumOfRows, currHashValue);
         }
         writeFileTail();
         physicalWriter->close();
         for(auto cw:columnWriters){
             cw->close();
         }
+        for(auto cw:spareColumnWriters){
+            cw->close();
+        }
+        WriterMemoryManager::Instance().removeWriter(this);
     }
     catch (const std::exception& e){
         std::cerr <<e.what()<<std::endl;
         throw;
     }
 }
-    pixels::proto::RowGroupInformation curRowGroupInfo;
-    pixels::proto::RowGroupIndex curRowGroupIndex;
-    pixels::proto::RowGroupEncoding curRowGroupEncoding;
-void PixelsWriterImpl::writeRowGroup() {
+/**
+ * Add the writer and the writers of its nested columns in pre-order, which is the order of the
+ * column chunks in the row group. columnId is the index of the top-level column of the writer,
+ * it is recorded for each chunk in chunkColumnIds.
+ */
+static void collectChunkWriters(const std::shared_ptr<ColumnWriter>& writer, int columnId,
+                                std::vector<std::shared_ptr<ColumnWriter>>& chunkWriters,
+                                std::vector<int>& chunkColumnIds){
+    chunkWriters.push_back(writer);
+    chunkColumnIds.push_back(columnId);
+    for(const auto& childWriter:writer->getChildWriters()){
+        collectChunkWriters(childWriter, columnId, chunkWriters, chunkColumnIds);
+    }
+}
+
+void PixelsWriterImpl::writeRowGroup(std::vector<std::shared_ptr<ColumnWriter>> rowGroupWriters, int rowGroupNumOfRows,
+                                     int hashValue) {
     // TODO
     std::cout<<"Try to write rowGroup"<<std::endl;
+    // per row group, so that entries of earlier row groups or files are not carried over
+    pixels::proto::RowGroupInformation curRowGroupInfo;
+    pixels::proto::RowGroupStatistic curRowGroupStatistic;
+    // the index and the encoding of the column chunks are built in place in the footer
+    std::shared_ptr<pixels::proto::RowGroupFooter> rowGroupFooter=std::make_shared<pixels::proto::RowGroupFooter>();
+    auto curRowGroupIndex=rowGroupFooter->mutable_rowgroupindexentry();
+    auto curRowGroupEncoding=rowGroupFooter->mutable_rowgroupencoding();
     int rowGroupDataLength = 0;
-//    pixels::proto::RowGroupStatistic curRowGroupStatistic;
 
-    // reset each column writer and get current row group content size in bytes
-    for(auto writer:columnWriters){
-        // flush writes the isNull bit map into the internal output stream.
-        writer->flush();
-        rowGroupDataLength+=writer->getColumnChunkSize();
+    // each nested column is stored in the column chunks of itself and its descendants
+    std::vector<std::shared_ptr<ColumnWriter>> chunkWriters;
+    std::vector<int> chunkColumnIds;
+    for(int i=0;i<rowGroupWriters.size();i++){
+        collectChunkWriters(rowGroupWriters[i], i, chunkWriters, chunkColumnIds);
+    }
+    // flush and compress each column chunk, then get current row group content size in bytes.
+    // the uncompressed column chunks are written from the output streams of the column writers without copying
+    std::vector<std::vector<struct iovec>> chunkContents(chunkWriters.size());
+    std::vector<int> chunkLengths(chunkWriters.size());
+    std::vector<std::vector<uint8_t>> compressedContents(chunkWriters.size());
+    std::vector<int> chunkCompressed(chunkWriters.size(), 0);
+    std::vector<std::future<void>> futures;
+    for(int i=0;i<chunkWriters.size();i++){
+        // this stage never runs on the pool, so it is safe to wait for the pool here
+        futures.emplace_back(ThreadPool::Instance().submit([this, i, &chunkWriters, &chunkColumnIds, &chunkContents, &chunkLengths,
+                                                            &compressedContents, &chunkCompressed]() {
+            // flush writes the isNull bit map into the internal output stream.
+            chunkWriters[i]->flush();
+            chunkWriters[i]->getColumnChunkContent(chunkContents[i]);
+            chunkLengths[i] = chunkWriters[i]->getColumnChunkSize();
+            chunkCompressed[i] = compressColumnChunk(chunkColumnIds[i], chunkContents[i], compressedContents[i]);
+            if(chunkCompressed[i]){
+                struct iovec compressed;
+                compressed.iov_base = compressedContents[i].data();
+                compressed.iov_len = compressedContents[i].size();
+                chunkContents[i].assign(1, compressed);
+                chunkLengths[i] = compressedContents[i].size();
+            }
+        }));
+    }
+    for(auto& future:futures){
+        future.get();
+    }
+    for(int length:chunkLengths){
+        rowGroupDataLength+=length;
         if(CHUNK_ALIGNMENT!=0&& rowGroupDataLength%CHUNK_ALIGNMENT!=0){
             /*
             * Issue #519:
@@ -139,37 +365,18 @@ void PixelsWriterImpl::writeRowGroup() {
             rowGroupDataLength+=CHUNK_ALIGNMENT-rowGroupDataLength%CHUNK_ALIGNMENT;
         }
     }
-    // write and flush row group content
+    // reserve the padding before the first column chunk, it is written together with the row group content
+    int alignBytes=0;
     try{
-        curRowGroupOffset=physicalWriter->prepare(rowGroupDataLength);
-        if(curRowGroupOffset!=-1){
-            int tryAlign=0;
-            while(CHUNK_ALIGNMENT!=0&&curRowGroupOffset%CHUNK_ALIGNMENT!=0&&tryAlign++<2){
-                int alignBytes=CHUNK_ALIGNMENT-curRowGroupOffset%CHUNK_ALIGNMENT;
-                physicalWriter->append(CHUNK_PADDING_BUFFER.data(), 0, alignBytes);
-                writtenBytes += alignBytes;
-                curRowGroupOffset = physicalWriter->prepare(rowGroupDataLength);
-            }
-            if(tryAlign>2){
-                std::cerr << "Failed to align the start offset of the column chunks in the row group" << std::endl;
-                throw std::runtime_error("Failed to align the start offset of the column chunks in the row group");
-            }
-
-            for(auto& writer:columnWriters){
-                auto rowGroupBuffer=writer->getColumnChunkContent();
-                physicalWriter->append(rowGroupBuffer.data(), 0, rowGroupBuffer.size());
-                writtenBytes += rowGroupBuffer.size();
-                if (CHUNK_ALIGNMENT != 0 && rowGroupBuffer.size() % CHUNK_ALIGNMENT != 0) {
-                    int alignBytes = CHUNK_ALIGNMENT - rowGroupBuffer.size() % CHUNK_ALIGNMENT;
-                    physicalWriter->append(CHUNK_PADDING_BUFFER.data(), 0, alignBytes);
-                    writtenBytes += alignBytes;
-                }
-            }
-            physicalWriter->flush();
-        }else{
+        curRowGroupOffset=physicalWriter->prepare(rowGroupDataLength+CHUNK_ALIGNMENT);
+        if(curRowGroupOffset==-1){
             std::cerr << "Write row group prepare failed" << std::endl;
             throw std::runtime_error("Write row group prepare failed");
         }
+        if(CHUNK_ALIGNMENT!=0&&curRowGroupOffset%CHUNK_ALIGNMENT!=0){
+            alignBytes=CHUNK_ALIGNMENT-curRowGroupOffset%CHUNK_ALIGNMENT;
+            curRowGroupOffset+=alignBytes;
+        }
     }
     catch (const std::exception& e){
         std::cerr <<e.what()<<std::endl;
@@ -179,60 +386,129 @@ void PixelsWriterImpl::writeRowGroup() {
 
     // update index and stats(necessary?)
     rowGroupDataLength=0;
-    for(int i=0;i<columnWriters.size();i++){
-        std::shared_ptr<ColumnWriter> writer=columnWriters[i];
-        auto chunkIndex=writer->getColumnChunkIndex();
-        chunkIndex.set_chunkoffset(curRowGroupOffset+rowGroupDataLength);
-        chunkIndex.set_chunklength(writer->getColumnChunkSize());
-        chunkIndex.set_littleendian(true);
-        rowGroupDataLength+=writer->getColumnChunkSize();
+    for(int i=0;i<chunkWriters.size();i++){
+        std::shared_ptr<ColumnWriter> writer=chunkWriters[i];
+        // the index of the writer is moved rather than copied, it is rebuilt when the writer is reset
+        auto chunkIndex=curRowGroupIndex->add_columnchunkindexentries();
+        chunkIndex->Swap(writer->getColumnChunkIndexPtr().get());
+        chunkIndex->set_chunkoffset(curRowGroupOffset+rowGroupDataLength);
+        chunkIndex->set_chunklength(chunkLengths[i]);
+        chunkIndex->set_littleendian(true);
+        if(chunkCompressed[i]){
+            chunkIndex->set_compression(compressionKind);
+            chunkIndex->set_uncompressedlength(writer->getColumnChunkSize());
+        }
+        rowGroupDataLength+=chunkLengths[i];
         if(CHUNK_ALIGNMENT!=0&&rowGroupDataLength%CHUNK_ALIGNMENT!=0){
             rowGroupDataLength += CHUNK_ALIGNMENT - rowGroupDataLength % CHUNK_ALIGNMENT;
         }
-        *(curRowGroupIndex.add_columnchunkindexentries()) = chunkIndex;
-        *(curRowGroupEncoding.add_columnchunkencodings()) = writer->getColumnChunkEncoding();
-
-
-        columnWriters[i]=ColumnWriterBuilder::newColumnWriter(children.at(i),columnWriterOption);
+        auto chunkEncoding=writer->getColumnChunkEncoding();
+        curRowGroupEncoding->add_columnchunkencodings()->Swap(&chunkEncoding);
+        auto chunkStat=writer->getColumnChunkStat();
+        curRowGroupStatistic.add_columnchunkstats()->Swap(&chunkStat);
+        fileColStatRecorders.at(i)->merge(writer->getColumnChunkStatRecorder());
     }
+    rowGroupStatisticList.push_back(std::move(curRowGroupStatistic));
 
-    // put curRowGroupIndex into rowGroupFooter
-    std::shared_ptr<pixels::proto::RowGroupFooter> rowGroupFooter=std::make_shared<pixels::proto::RowGroupFooter>();
+    std::string footerContent=rowGroupFooter->SerializeAsString();
 
-    rowGroupFooter->mutable_rowgroupindexentry()->CopyFrom(curRowGroupIndex);
-    rowGroupFooter->mutable_rowgroupencoding()->CopyFrom(curRowGroupEncoding);
-    std::cout<<"curRowGroupEncoding: "<<curRowGroupEncoding.ByteSizeLong()<<std::endl;
-    std::cout<<"curRowGroupEncoding: "<<curRowGroupEncoding.ByteSizeLong()<<std::endl;
+    // write and flush the padded column chunks and the row group footer in one gather write
+    auto padding=[](int length){
+        struct iovec buffer;
+        buffer.iov_base=const_cast<uint8_t *>(CHUNK_PADDING_BUFFER.data());
+        buffer.iov_len=length;
+        return buffer;
+    };
+    std::vector<struct iovec> rowGroupBuffers;
+    if(alignBytes>0){
+        rowGroupBuffers.push_back(padding(alignBytes));
+    }
+    for(int i=0;i<chunkContents.size();i++){
+        rowGroupBuffers.insert(rowGroupBuffers.end(), chunkContents[i].begin(), chunkContents[i].end());
+        if(CHUNK_ALIGNMENT!=0&&chunkLengths[i]%CHUNK_ALIGNMENT!=0){
+            rowGroupBuffers.push_back(padding(CHUNK_ALIGNMENT-chunkLengths[i]%CHUNK_ALIGNMENT));
+        }
+    }
+    struct iovec footerBuffer;
+    footerBuffer.iov_base=const_cast<char *>(footerContent.data());
+    footerBuffer.iov_len=footerContent.size();
+    rowGroupBuffers.push_back(footerBuffer);
     try {
-        ByteBuffer footerBuffer(rowGroupFooter->ByteSizeLong());
-        rowGroupFooter->SerializeToArray(footerBuffer.getPointer(), rowGroupFooter->ByteSizeLong());
-        physicalWriter->prepare(footerBuffer.size());
-        curRowGroupFooterOffset = physicalWriter->append(footerBuffer.getPointer(), 0, footerBuffer.size());
-        writtenBytes += footerBuffer.size();
+        physicalWriter->append(rowGroupBuffers);
         physicalWriter->flush();
     } catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
         throw;
     }
+    curRowGroupFooterOffset=curRowGroupOffset+rowGroupDataLength;
+    writtenBytes+=alignBytes+rowGroupDataLength+footerContent.size();
     // Update RowGroupInformation and add it to the list
     curRowGroupInfo.set_footeroffset(curRowGroupFooterOffset);
     curRowGroupInfo.set_datalength(rowGroupDataLength);
     curRowGroupInfo.set_footerlength(rowGroupFooter->ByteSizeLong());
-    curRowGroupInfo.set_numberofrows(curRowGroupNumOfRows);
+    curRowGroupInfo.set_numberofrows(rowGroupNumOfRows);
+    if(partitioned){
+        // the partition key columns are recorded by their ids in the footer types, like the column chunks
+        auto partitionInfo=curRowGroupInfo.mutable_partitioninfo();
+        for(int columnId:columnWriterOption->getPartitionKeyColumns()){
+            partitionInfo->add_columnids(children.at(columnId)->getId());
+        }
+        partitionInfo->set_hashvalue(hashValue);
+        partitionInfo->set_numpartitions(columnWriterOption->getNumPartitions());
+    }
     rowGroupInfoList.push_back(curRowGroupInfo);
 
-    this->fileRowNum += curRowGroupNumOfRows;
+    this->fileRowNum += rowGroupNumOfRows;
     this->fileContentLength += rowGroupDataLength;
+    WriterMemoryManager::Instance().setFlushingBytes(this, 0);
     std::cout << "PixelsWriterImpl::writeRowGroup" << std::endl;
 }
 
+bool PixelsWriterImpl::compressColumnChunk(int columnId, const std::vector<struct iovec> &content,
+                                           std::vector<uint8_t> &compressed) {
+    auto codec = CompressionCodecFactory::Instance()->getCodec(compressionKind);
+    if(codec == nullptr || content.empty()){
+        return false;
+    }
+    // the codec compresses a contiguous input, so the segments of a large column chunk are copied together
+    std::vector<uint8_t> contiguousContent;
+    const uint8_t *contentData = static_cast<const uint8_t *>(content[0].iov_base);
+    size_t length = content[0].iov_len;
+    if(content.size()>1){
+        for(const auto& segment:content){
+            auto segmentData = static_cast<const uint8_t *>(segment.iov_base);
+            contiguousContent.insert(contiguousContent.end(), segmentData, segmentData + segment.iov_len);
+        }
+        contentData = contiguousContent.data();
+        length = contiguousContent.size();
+    }
+    codec->compressBlocks(contentData, length, compressionBlockSize,
+                          columnWriterOption->getCompressionLevel(columnId), compressed);
+    // keep incompressible chunks uncompressed so that they can be read without copying
+    if(compressed.size()>=length){
+        compressed.clear();
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterImpl::getColumnWriterOption() {
+    return columnWriterOption;
+}
+
 void PixelsWriterImpl::writeFileTail() {
     std::shared_ptr<pixels::proto::Footer> footer=std::make_shared<pixels::proto::Footer>();
     std::shared_ptr<pixels::proto::PostScript> postScript=std::make_shared<pixels::proto::PostScript>();
     schema->writeTypes(footer);
+    for(const auto& fileColStatRecorder: fileColStatRecorders){
+        *(footer->add_columnstats()) = fileColStatRecorder->serialize();
+    }
     for(auto rowGroupInformation: rowGroupInfoList){
         *(footer->add_rowgroupinfos()) = rowGroupInformation;
     }
+    for(const auto& rowGroupStatistic: rowGroupStatisticList){
+        *(footer->add_rowgroupstats()) = rowGroupStatistic;
+    }
     postScript->set_version(PixelsVersion::V1);
     std::string FILE_MAGIC="PIXELS";
     postScript->set_contentlength(fileContentLength);
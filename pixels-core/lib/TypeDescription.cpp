@@ -91,6 +91,10 @@ int TypeDescription::MAX_TIMESTAMP_PRECISION = 6;
  * For simplicity and compatibility to {@link java.sql.Time}, we further limit the precision to 3.</p>
  */
  int TypeDescription::MAX_TIME_PRECISION = 3;
+/**
+ * The max dimension of vector (embedding) columns. The values of a vector are stored contiguously in floats.
+ */
+int TypeDescription::MAX_VECTOR_DIMENSION = 65535;
 
 TypeDescription::StringPosition::StringPosition(const std::string &value)
     : value(value), position(0), length(value.size()) {}
@@ -122,7 +126,9 @@ std::map<TypeDescription::Category, CategoryProperty> TypeDescription::categoryM
         {BINARY, {true, {"binary"}}},
         {VARCHAR, {true, {"varchar"}}},
         {CHAR, {true, {"char"}}},
-        {STRUCT, {false, {"struct"}}}
+        {STRUCT, {false, {"struct"}}},
+        {VECTOR, {true, {"vector"}}},
+        {ARRAY, {false, {"array"}}}
 };
 
 TypeDescription::TypeDescription(Category c) {
@@ -131,66 +137,105 @@ TypeDescription::TypeDescription(Category c) {
     maxLength = DEFAULT_LENGTH;
     precision = SHORT_DECIMAL_DEFAULT_PRECISION;
     scale = SHORT_DECIMAL_DEFAULT_SCALE;
+    dimension = 0;
 
     category = c;
 }
 
 std::shared_ptr<TypeDescription> TypeDescription::createSchema(const std::vector<std::shared_ptr<pixels::proto::Type>>& types) {
 	std::shared_ptr<TypeDescription> schema = createStruct();
+    std::vector<bool> isSubtype(types.size(), false);
     for(const auto& type : types) {
-        const std::string& fieldName = type->name();
-        std::shared_ptr<TypeDescription> fieldType;
-        switch (type->kind()) {
-            case pixels::proto::Type_Kind_BOOLEAN:
-                fieldType = TypeDescription::createBoolean();
-                break;
-            case pixels::proto::Type_Kind_LONG:
-                fieldType = TypeDescription::createLong();
-                break;
-            case pixels::proto::Type_Kind_INT:
-                fieldType = TypeDescription::createInt();
-                break;
-            case pixels::proto::Type_Kind_SHORT:
-                fieldType = TypeDescription::createShort();
-                break;
-            case pixels::proto::Type_Kind_BYTE:
-                fieldType = TypeDescription::createByte();
-                break;
-            case pixels::proto::Type_Kind_FLOAT:
-                fieldType = TypeDescription::createFloat();
-                break;
-            case pixels::proto::Type_Kind_DOUBLE:
-                fieldType = TypeDescription::createDouble();
-                break;
+        for(uint32_t subtype : type->subtypes()) {
+            if(subtype >= types.size()) {
+                throw InvalidArgumentException("TypeDescription::createSchema: subtype out of range: " + type->name());
+            }
+            isSubtype.at(subtype) = true;
+        }
+    }
+    for(uint32_t i = 0; i < types.size(); i++) {
+        if(!isSubtype.at(i)) {
+            schema->addField(types.at(i)->name(), createType(types, i));
+        }
+    }
+    return schema;
+}
+
+std::shared_ptr<TypeDescription> TypeDescription::createType(const std::vector<std::shared_ptr<pixels::proto::Type>>& types, uint32_t index) {
+    const auto& type = types.at(index);
+    std::shared_ptr<TypeDescription> fieldType;
+    switch (type->kind()) {
+        case pixels::proto::Type_Kind_BOOLEAN:
+            fieldType = TypeDescription::createBoolean();
+            break;
+        case pixels::proto::Type_Kind_LONG:
+            fieldType = TypeDescription::createLong();
+            break;
+        case pixels::proto::Type_Kind_INT:
+            fieldType = TypeDescription::createInt();
+            break;
+        case pixels::proto::Type_Kind_SHORT:
+            fieldType = TypeDescription::createShort();
+            break;
+        case pixels::proto::Type_Kind_BYTE:
+            fieldType = TypeDescription::createByte();
+            break;
+        case pixels::proto::Type_Kind_FLOAT:
+            fieldType = TypeDescription::createFloat();
+            break;
+        case pixels::proto::Type_Kind_DOUBLE:
+            fieldType = TypeDescription::createDouble();
+            break;
 		    case pixels::proto::Type_Kind_DECIMAL:
 			    fieldType = TypeDescription::createDecimal(type->precision(), type->scale());
 			    break;
-            case pixels::proto::Type_Kind_VARCHAR:
-                fieldType = TypeDescription::createVarchar();
-                fieldType->maxLength = type->maximumlength();
-                break;
-            case pixels::proto::Type_Kind_CHAR:
-                fieldType = TypeDescription::createChar();
-                fieldType->maxLength = type->maximumlength();
-                break;
-            case pixels::proto::Type_Kind_STRING:
-                fieldType = TypeDescription::createString();
-                break;
-            case pixels::proto::Type_Kind_DATE:
-                fieldType = TypeDescription::createDate();
-                break;
-            case pixels::proto::Type_Kind_TIME:
-                fieldType = TypeDescription::createTime();
-                break;
-            case pixels::proto::Type_Kind_TIMESTAMP:
-                fieldType = TypeDescription::createTimestamp();
-                break;
-            default:
-                throw InvalidArgumentException("TypeDescription::createSchema: Unknown type: " + type->name());
-        }
-        schema->addField(fieldName, fieldType);
+        case pixels::proto::Type_Kind_VARCHAR:
+            fieldType = TypeDescription::createVarchar();
+            fieldType->maxLength = type->maximumlength();
+            break;
+        case pixels::proto::Type_Kind_CHAR:
+            fieldType = TypeDescription::createChar();
+            fieldType->maxLength = type->maximumlength();
+            break;
+        case pixels::proto::Type_Kind_STRING:
+            fieldType = TypeDescription::createString();
+            break;
+        case pixels::proto::Type_Kind_BINARY:
+            fieldType = TypeDescription::createBinary();
+            fieldType->maxLength = type->maximumlength();
+            break;
+        case pixels::proto::Type_Kind_VARBINARY:
+            fieldType = TypeDescription::createVarbinary();
+            fieldType->maxLength = type->maximumlength();
+            break;
+        case pixels::proto::Type_Kind_DATE:
+            fieldType = TypeDescription::createDate();
+            break;
+        case pixels::proto::Type_Kind_TIME:
+            fieldType = TypeDescription::createTime();
+            break;
+        case pixels::proto::Type_Kind_TIMESTAMP:
+            fieldType = TypeDescription::createTimestamp();
+            break;
+        case pixels::proto::Type_Kind_VECTOR:
+            fieldType = TypeDescription::createVector(type->dimension());
+            break;
+        case pixels::proto::Type_Kind_STRUCT:
+            fieldType = TypeDescription::createStruct();
+            for(uint32_t subtype : type->subtypes()) {
+                fieldType->addField(types.at(subtype)->name(), createType(types, subtype));
+            }
+            break;
+        case pixels::proto::Type_Kind_ARRAY:
+            if(type->subtypes_size() != 1) {
+                throw InvalidArgumentException("TypeDescription::createSchema: array must have one subtype: " + type->name());
+            }
+            fieldType = TypeDescription::createArray(createType(types, type->subtypes(0)));
+            break;
+        default:
+            throw InvalidArgumentException("TypeDescription::createSchema: Unknown type: " + type->name());
     }
-    return schema;
+    return fieldType;
 }
 
 std::shared_ptr<TypeDescription> TypeDescription::createBoolean() {
@@ -265,6 +310,19 @@ std::shared_ptr<TypeDescription> TypeDescription::createStruct() {
 	return std::make_shared<TypeDescription>(STRUCT);
 }
 
+std::shared_ptr<TypeDescription> TypeDescription::createVector(int dimension) {
+	auto type = std::make_shared<TypeDescription>(VECTOR);
+	type->withDimension(dimension);
+	return type;
+}
+
+std::shared_ptr<TypeDescription> TypeDescription::createArray(const std::shared_ptr<TypeDescription>& element) {
+	auto type = std::make_shared<TypeDescription>(ARRAY);
+	type->children.emplace_back(element);
+	element->setParent(type);
+	return type;
+}
+
 std::shared_ptr<TypeDescription> TypeDescription::addField(const std::string& field, const std::shared_ptr<TypeDescription>& fieldType) {
     if(category != STRUCT) {
         throw InvalidArgumentException("Can only add fields to struct type,"
@@ -329,18 +387,27 @@ std::shared_ptr<ColumnVector> TypeDescription::createColumn(int maxSize, std::ve
     assert(!useEncodedVector.empty());
     // the length of useEncodedVector is already checked, not need to check again.
     switch (category) {
+        case BOOLEAN:
+        case BYTE:
+            return std::make_shared<ByteColumnVector>(maxSize, useEncodedVector.at(0));
         case SHORT:
         case INT:
 			return std::make_shared<LongColumnVector>(maxSize, useEncodedVector.at(0), false);
         case LONG:
             return std::make_shared<LongColumnVector>(maxSize, useEncodedVector.at(0), true);
+        case FLOAT:
+            return std::make_shared<DoubleColumnVector>(maxSize, useEncodedVector.at(0), false);
+        case DOUBLE:
+            return std::make_shared<DoubleColumnVector>(maxSize, useEncodedVector.at(0), true);
 	    case DATE:
 		    return std::make_shared<DateColumnVector>(maxSize, useEncodedVector.at(0));
+	    case TIME:
+		    return std::make_shared<TimeColumnVector>(maxSize, precision, useEncodedVector.at(0));
 	    case DECIMAL: {
 		    if (precision <= SHORT_DECIMAL_MAX_PRECISION) {
 				return std::make_shared<DecimalColumnVector>(maxSize, precision, scale, useEncodedVector.at(0));
 		    } else {
-				throw InvalidArgumentException("Currently we didn't implement LongDecimalColumnVector.");
+				return std::make_shared<LongDecimalColumnVector>(maxSize, precision, scale, useEncodedVector.at(0));
 		    }
 	    }
         case TIMESTAMP:
@@ -352,6 +419,19 @@ std::shared_ptr<ColumnVector> TypeDescription::createColumn(int maxSize, std::ve
         case VARCHAR: {
 		    return std::make_shared<BinaryColumnVector>(maxSize, useEncodedVector.at(0));
 	    }
+        case VECTOR:
+            return std::make_shared<VectorColumnVector>(maxSize, dimension, useEncodedVector.at(0));
+        case STRUCT: {
+            std::vector<std::shared_ptr<ColumnVector>> fields;
+            for(const auto& child : children) {
+                fields.emplace_back(child->createColumn(maxSize, useEncodedVector.at(0)));
+            }
+            return std::make_shared<StructColumnVector>(maxSize, fields, useEncodedVector.at(0));
+        }
+        case ARRAY:
+            // the child vector grows with the number of elements in the row batch
+            return std::make_shared<ListColumnVector>(maxSize, children.at(0)->createColumn(maxSize, useEncodedVector.at(0)),
+                                                      useEncodedVector.at(0));
         default:
             throw InvalidArgumentException("TypeDescription: Unknown type when creating column");
     }
@@ -376,6 +456,52 @@ int TypeDescription::getMaxLength() {
     return maxLength;
 }
 
+int TypeDescription::getDimension() {
+    return dimension;
+}
+
+int TypeDescription::getId() {
+    if (id == -1) {
+        std::shared_ptr<TypeDescription> root = shared_from_this();
+        while (auto p = root->parent.lock()) {
+            root = p;
+        }
+        root->assignIds(0);
+    }
+    return id;
+}
+
+int TypeDescription::getMaximumId() {
+    if (maxId == -1) {
+        getId();
+    }
+    return maxId;
+}
+
+int TypeDescription::assignIds(int startId) {
+    id = startId++;
+    for (const auto &child : children) {
+        startId = child->assignIds(startId);
+    }
+    maxId = startId - 1;
+    return startId;
+}
+
+std::shared_ptr<TypeDescription> TypeDescription::clone() {
+    auto result = std::make_shared<TypeDescription>(category);
+    result->maxLength = maxLength;
+    result->precision = precision;
+    result->scale = scale;
+    result->dimension = dimension;
+    result->fieldNames = fieldNames;
+    for (const auto &child : children) {
+        auto childClone = child->clone();
+        result->children.emplace_back(childClone);
+        childClone->setParent(result);
+    }
+    return result;
+}
+
 void TypeDescription::requireChar(TypeDescription::StringPosition &source, char required) {
     if (source.position >= source.length || source.value[source.position] != required) {
         throw new InvalidArgumentException("Missing required char " + std::string(1, required) + " at " + source.toString());
@@ -464,6 +590,14 @@ void TypeDescription::parseStruct(std::shared_ptr<TypeDescription> type, TypeDes
     requireChar(source, '>');
 }
 
+void TypeDescription::parseArray(std::shared_ptr<TypeDescription> type, TypeDescription::StringPosition &source) {
+    requireChar(source, '<');
+    auto element = parseType(source);
+    type->children.emplace_back(element);
+    element->setParent(type);
+    requireChar(source, '>');
+}
+
 TypeDescription::Category TypeDescription::parseCategory(TypeDescription::StringPosition &source) {
     int start = source.position;
     while (source.position < source.length && std::isalpha(source.value[source.position])) {
@@ -543,9 +677,18 @@ std::shared_ptr<TypeDescription> TypeDescription::parseType(TypeDescription::Str
                 result->withScale(DEFAULT_DECIMAL_SCALE);
             }
             break;
+        case VECTOR:
+            // the dimension of a vector column is required, e.g., vector(768)
+            requireChar(source, '(');
+            result->withDimension(parseInt(source));
+            requireChar(source, ')');
+            break;
         case STRUCT:
             parseStruct(result, source);
             break;
+        case ARRAY:
+            parseArray(result, source);
+            break;
         default:
             throw new InvalidArgumentException("Unknown type at " + source.toString());
     }
@@ -612,85 +755,111 @@ TypeDescription TypeDescription::withMaxLength(int maxLength) {
     return *this;
 }
 
+TypeDescription TypeDescription::withDimension(int dimension) {
+    if (this->category != Category::VECTOR) {
+        throw InvalidArgumentException(std::string("dimension is only allowed on vector."));
+    }
+    if (dimension < 1 || dimension > MAX_VECTOR_DIMENSION) {
+        throw InvalidArgumentException(std::string("dimension ") + std::to_string(dimension) + " is out of the valid range 1 .. " + std::to_string(MAX_VECTOR_DIMENSION));
+    }
+    this->dimension = dimension;
+    return *this;
+}
+
 void TypeDescription::writeTypes(std::shared_ptr<pixels::proto::Footer> footer) {
     std::vector<std::shared_ptr<TypeDescription>> children= this->getChildren();
     std::vector<std::string> names=this->getFieldNames();
-    if(children.empty()){
-        return;
-    }
     for(int i=0;i<children.size();i++){
-        std::shared_ptr<TypeDescription> child=children.at(i);
-        std::shared_ptr<pixels::proto::Type> tmpType=std::make_shared<pixels::proto::Type>();
-        tmpType->set_name(names.at(i));
-        switch (child->getCategory()) {
-            case TypeDescription::Category::BOOLEAN:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_BOOLEAN);
-                break;
-            case TypeDescription::Category::BYTE:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_BYTE);
-                break;
-            case TypeDescription::Category::SHORT:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_SHORT);
-                break;
-            case TypeDescription::Category::INT:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_INT);
-                break;
-            case TypeDescription::Category::LONG:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_LONG);
-                break;
-            case TypeDescription::Category::FLOAT:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_FLOAT);
-                break;
-            case TypeDescription::Category::DOUBLE:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_DOUBLE);
-                break;
-            case TypeDescription::Category::DECIMAL:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_DECIMAL);
-                tmpType->set_precision(child->getPrecision());
-                tmpType->set_scale(child->getScale());
-                break;
-            case TypeDescription::Category::STRING:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_STRING);
-                break;
-            case TypeDescription::Category::CHAR:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_CHAR);
-                tmpType->set_maximumlength(child->getMaxLength());
-                break;
-            case TypeDescription::Category::VARCHAR:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_VARCHAR);
-                tmpType->set_maximumlength(child->getMaxLength());
-                break;
-            case TypeDescription::Category::BINARY:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_BINARY);
-                tmpType->set_maximumlength(child->getMaxLength());
-                break;
-            case TypeDescription::Category::VARBINARY:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_VARBINARY);
-                tmpType->set_maximumlength(child->getMaxLength());
-                break;
-            case TypeDescription::Category::TIMESTAMP:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_TIMESTAMP);
-                tmpType->set_precision(child->getPrecision());
-                break;
-            case TypeDescription::Category::DATE:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_DATE);
-                break;
-            case TypeDescription::Category::TIME:
-                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_TIME);
-                tmpType->set_precision(child->getPrecision());
-                break;
-//            case TypeDescription::Category::VECTOR:
-//                tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_VECTOR);
-//                tmpType->set_dimension(child->getDimension());
-//                break;
-            default: {
-                std::string errorMsg = "Unknown category: ";
-                errorMsg += static_cast<std::underlying_type_t<Category>>(this->getCategory());
-                throw std::runtime_error(errorMsg);
+        writeType(footer, names.at(i), children.at(i));
+    }
+}
+
+void TypeDescription::writeType(const std::shared_ptr<pixels::proto::Footer>& footer, const std::string& name,
+                                const std::shared_ptr<TypeDescription>& type) {
+    // the type is added before its subtypes, so that the types are in pre-order as the column chunks
+    pixels::proto::Type * tmpType = footer->add_types();
+    tmpType->set_name(name);
+    switch (type->getCategory()) {
+        case TypeDescription::Category::BOOLEAN:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_BOOLEAN);
+            break;
+        case TypeDescription::Category::BYTE:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_BYTE);
+            break;
+        case TypeDescription::Category::SHORT:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_SHORT);
+            break;
+        case TypeDescription::Category::INT:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_INT);
+            break;
+        case TypeDescription::Category::LONG:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_LONG);
+            break;
+        case TypeDescription::Category::FLOAT:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_FLOAT);
+            break;
+        case TypeDescription::Category::DOUBLE:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_DOUBLE);
+            break;
+        case TypeDescription::Category::DECIMAL:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_DECIMAL);
+            tmpType->set_precision(type->getPrecision());
+            tmpType->set_scale(type->getScale());
+            break;
+        case TypeDescription::Category::STRING:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_STRING);
+            break;
+        case TypeDescription::Category::CHAR:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_CHAR);
+            tmpType->set_maximumlength(type->getMaxLength());
+            break;
+        case TypeDescription::Category::VARCHAR:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_VARCHAR);
+            tmpType->set_maximumlength(type->getMaxLength());
+            break;
+        case TypeDescription::Category::BINARY:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_BINARY);
+            tmpType->set_maximumlength(type->getMaxLength());
+            break;
+        case TypeDescription::Category::VARBINARY:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_VARBINARY);
+            tmpType->set_maximumlength(type->getMaxLength());
+            break;
+        case TypeDescription::Category::TIMESTAMP:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_TIMESTAMP);
+            tmpType->set_precision(type->getPrecision());
+            break;
+        case TypeDescription::Category::DATE:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_DATE);
+            break;
+        case TypeDescription::Category::TIME:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_TIME);
+            tmpType->set_precision(type->getPrecision());
+            break;
+        case TypeDescription::Category::VECTOR:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_VECTOR);
+            tmpType->set_dimension(type->getDimension());
+            break;
+        case TypeDescription::Category::STRUCT: {
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_STRUCT);
+            std::vector<std::string> fieldNames = type->getFieldNames();
+            for(int i = 0; i < fieldNames.size(); i++) {
+                tmpType->add_subtypes(footer->types_size());
+                writeType(footer, fieldNames.at(i), type->getChildren().at(i));
             }
+            break;
+        }
+        case TypeDescription::Category::ARRAY:
+            tmpType->set_kind(pixels::proto::Type_Kind::Type_Kind_ARRAY);
+            tmpType->add_subtypes(footer->types_size());
+            writeType(footer, "element", type->getChildren().at(0));
+            break;
+        default: {
+            std::string errorMsg = "Unknown category: ";
+            errorMsg += static_cast<std::underlying_type_t<Category>>(type->getCategory());
+            throw std::runtime_error(errorMsg);
+        }
 
 
-        }
-        *(footer->add_types())=*tmpType;
     }
 }
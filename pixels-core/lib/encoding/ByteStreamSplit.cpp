@@ -0,0 +1,89 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "encoding/ByteStreamSplit.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+void ByteStreamSplit::encode(const uint8_t *values, int numValues, int width, uint8_t *streams) {
+    for (int k = 0; k < width; k++) {
+        uint8_t *stream = streams + (long) k * numValues;
+        for (int i = 0; i < numValues; i++) {
+            stream[i] = values[(long) i * width + k];
+        }
+    }
+}
+
+void ByteStreamSplit::decode(const uint8_t *streams, int streamLength, int numValues, int width, uint8_t *values) {
+    int i = 0;
+#ifdef __SSE2__
+    // interleave 16 values at a time: bytes into 16-bit, then 32-bit, then 64-bit groups
+    if (width == 4) {
+        const uint8_t *s0 = streams, *s1 = s0 + streamLength, *s2 = s1 + streamLength, *s3 = s2 + streamLength;
+        for (; i + 16 <= numValues; i += 16) {
+            __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s0 + i));
+            __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s1 + i));
+            __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s2 + i));
+            __m128i b3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s3 + i));
+            __m128i lo01 = _mm_unpacklo_epi8(b0, b1), hi01 = _mm_unpackhi_epi8(b0, b1);
+            __m128i lo23 = _mm_unpacklo_epi8(b2, b3), hi23 = _mm_unpackhi_epi8(b2, b3);
+            __m128i *out = reinterpret_cast<__m128i *>(values + (long) i * 4);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(lo01, lo23));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo01, lo23));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi01, hi23));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi01, hi23));
+        }
+    } else if (width == 8) {
+        const uint8_t *s[8];
+        for (int k = 0; k < 8; k++) {
+            s[k] = streams + (long) k * streamLength;
+        }
+        for (; i + 16 <= numValues; i += 16) {
+            __m128i b[8];
+            for (int k = 0; k < 8; k++) {
+                b[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s[k] + i));
+            }
+            // 16-bit groups of bytes (0,1), (2,3), (4,5), (6,7) for values 0-7 (lo) and 8-15 (hi)
+            __m128i w[8];
+            for (int k = 0; k < 4; k++) {
+                w[2 * k] = _mm_unpacklo_epi8(b[2 * k], b[2 * k + 1]);
+                w[2 * k + 1] = _mm_unpackhi_epi8(b[2 * k], b[2 * k + 1]);
+            }
+            // 32-bit groups of bytes 0-3 and 4-7 for values 0-3, 4-7, 8-11 and 12-15
+            __m128i d0123[4] = {_mm_unpacklo_epi16(w[0], w[2]), _mm_unpackhi_epi16(w[0], w[2]),
+                                _mm_unpacklo_epi16(w[1], w[3]), _mm_unpackhi_epi16(w[1], w[3])};
+            __m128i d4567[4] = {_mm_unpacklo_epi16(w[4], w[6]), _mm_unpackhi_epi16(w[4], w[6]),
+                                _mm_unpacklo_epi16(w[5], w[7]), _mm_unpackhi_epi16(w[5], w[7])};
+            __m128i *out = reinterpret_cast<__m128i *>(values + (long) i * 8);
+            for (int k = 0; k < 4; k++) {
+                _mm_storeu_si128(out + 2 * k, _mm_unpacklo_epi32(d0123[k], d4567[k]));
+                _mm_storeu_si128(out + 2 * k + 1, _mm_unpackhi_epi32(d0123[k], d4567[k]));
+            }
+        }
+    }
+#endif
+    for (; i < numValues; i++) {
+        for (int k = 0; k < width; k++) {
+            values[(long) i * width + k] = streams[(long) k * streamLength + i];
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "encoding/EncodingSelector.h"
+
+const double EncodingSelector::RUNLENGTH_DECODE_COST_PER_VALUE = 0.5;
+const double EncodingSelector::DICTIONARY_DECODE_COST_PER_VALUE = 0.5;
+const double EncodingSelector::FSST_DECODE_COST_PER_BYTE = 0.125;
+const int EncodingSelector::BOOLEAN_RUNLENGTH_MIN_RATIO = 4;
+
+pixels::proto::ColumnEncoding::Kind EncodingSelector::selectIntegerEncoding(int numValues, long plainSize,
+                                                                            long runLengthSize) {
+    double runLengthCost = runLengthSize + RUNLENGTH_DECODE_COST_PER_VALUE * numValues;
+    if (runLengthCost < plainSize) {
+        return pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH;
+    }
+    return pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE;
+}
+
+pixels::proto::ColumnEncoding::Kind EncodingSelector::selectBooleanEncoding(long bitPackedSize, long runLengthSize) {
+    if (runLengthSize * BOOLEAN_RUNLENGTH_MIN_RATIO < bitPackedSize) {
+        return pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH;
+    }
+    return pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE;
+}
+
+pixels::proto::ColumnEncoding::Kind EncodingSelector::selectStringEncoding(int numValues, long plainSize,
+                                                                           long dictionarySize, long fsstSize) {
+    auto kind = pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE;
+    double minCost = plainSize;
+    if (dictionarySize >= 0) {
+        double cost = dictionarySize + DICTIONARY_DECODE_COST_PER_VALUE * numValues;
+        if (cost < minCost) {
+            minCost = cost;
+            kind = pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_DICTIONARY;
+        }
+    }
+    if (fsstSize >= 0) {
+        // the decoded size is about the plain size
+        double cost = fsstSize + FSST_DECODE_COST_PER_BYTE * plainSize;
+        if (cost < minCost) {
+            kind = pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_FSST;
+        }
+    }
+    return kind;
+}
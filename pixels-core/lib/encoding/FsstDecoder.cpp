@@ -0,0 +1,62 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "encoding/FsstDecoder.h"
+#include "encoding/FsstEncoder.h"
+#include "exception/InvalidArgumentException.h"
+#include <cstring>
+
+FsstDecoder::FsstDecoder(const uint8_t *symbolTable, int length) {
+    std::memset(symbols, 0, sizeof(symbols));
+    std::memset(lengths, 0, sizeof(lengths));
+    if (length < 1 || length < 1 + symbolTable[0]) {
+        throw InvalidArgumentException("FsstDecoder: the symbol table is truncated");
+    }
+    int numSymbols = symbolTable[0];
+    int pos = 1 + numSymbols;
+    for (int code = 0; code < numSymbols; code++) {
+        lengths[code] = symbolTable[1 + code];
+        if (lengths[code] < 1 || lengths[code] > FsstEncoder::MAX_SYMBOL_LENGTH || pos + lengths[code] > length) {
+            throw InvalidArgumentException("FsstDecoder: the symbol table is corrupted");
+        }
+        std::memcpy(&symbols[code], symbolTable + pos, lengths[code]);
+        pos += lengths[code];
+    }
+}
+
+int FsstDecoder::decode(const uint8_t *src, int length, uint8_t *dst) const {
+    uint8_t *out = dst;
+    const uint8_t *end = src + length;
+    while (src < end) {
+        uint8_t code = *src++;
+        if (code != FsstEncoder::ESCAPE_CODE) {
+            std::memcpy(out, &symbols[code], sizeof(uint64_t));
+            out += lengths[code];
+        } else if (src < end) {
+            *out++ = *src++;
+        }
+    }
+    return (int) (out - dst);
+}
+
+int FsstDecoder::maxDecodedLength(int length) {
+    return length * FsstEncoder::MAX_SYMBOL_LENGTH + sizeof(uint64_t);
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "encoding/FsstEncoder.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+/**
+ * The number of bytes sampled to train the symbol table, as recommended by the FSST paper.
+ */
+static const int SAMPLE_SIZE = 16 * 1024;
+static const int TRAIN_ROUNDS = 5;
+
+static inline uint64_t loadSymbol(const uint8_t *src, int length) {
+    uint64_t value = 0;
+    std::memcpy(&value, src, length);
+    return value;
+}
+
+static inline uint64_t symbolMask(int length) {
+    return length == 8 ? ~0UL : ((1UL << (length * 8)) - 1);
+}
+
+FsstEncoder::FsstEncoder() = default;
+
+void FsstEncoder::buildIndex() {
+    for (auto &codes : codesByFirstByte) {
+        codes.clear();
+    }
+    for (int code = 0; code < (int) symbols.size(); code++) {
+        codesByFirstByte[symbols[code].value & 0xff].push_back(code);
+    }
+    for (auto &codes : codesByFirstByte) {
+        std::stable_sort(codes.begin(), codes.end(), [this](uint8_t a, uint8_t b) {
+            return symbols[a].length > symbols[b].length;
+        });
+    }
+}
+
+int FsstEncoder::findLongestSymbol(const uint8_t *src, int remaining) const {
+    uint64_t word = loadSymbol(src, std::min(remaining, (int) MAX_SYMBOL_LENGTH));
+    for (uint8_t code : codesByFirstByte[src[0]]) {
+        const Symbol &symbol = symbols[code];
+        if (symbol.length <= remaining && (word & symbolMask(symbol.length)) == symbol.value) {
+            return code;
+        }
+    }
+    return -1;
+}
+
+void FsstEncoder::train(const uint8_t *content, const int *starts, int numStrings) {
+    symbols.clear();
+    buildIndex();
+    if (numStrings == 0) {
+        return;
+    }
+    // take evenly spaced strings until the sample is full
+    std::vector<int> sample;
+    long totalBytes = starts[numStrings] - starts[0];
+    int step = std::max(1L, totalBytes / SAMPLE_SIZE);
+    long sampleBytes = 0;
+    for (int i = 0; i < numStrings && sampleBytes < SAMPLE_SIZE; i += step) {
+        sample.push_back(i);
+        sampleBytes += starts[i + 1] - starts[i];
+    }
+
+    // candidate ids below 256 are the current symbols, 256 + b is the single byte b
+    const int numIds = 512;
+    std::vector<int> singleCounts(numIds);
+    std::vector<int> pairCounts(numIds * numIds);
+    for (int round = 0; round < TRAIN_ROUNDS; round++) {
+        std::fill(singleCounts.begin(), singleCounts.end(), 0);
+        std::fill(pairCounts.begin(), pairCounts.end(), 0);
+        for (int i : sample) {
+            const uint8_t *str = content + starts[i];
+            int length = starts[i + 1] - starts[i];
+            int prev = -1;
+            for (int pos = 0; pos < length; ) {
+                int code = findLongestSymbol(str + pos, length - pos);
+                int id = code >= 0 ? code : 256 + str[pos];
+                singleCounts[id]++;
+                if (prev >= 0) {
+                    pairCounts[prev * numIds + id]++;
+                }
+                prev = id;
+                pos += code >= 0 ? symbols[code].length : 1;
+            }
+        }
+
+        auto symbolOf = [this](int id) {
+            return id < 256 ? symbols[id] : Symbol{(uint64_t) (id - 256), 1};
+        };
+        // the gain of a candidate is the number of bytes it would cover in the sample
+        std::map<std::pair<uint64_t, int>, long> gains;
+        auto addCandidate = [&gains](const Symbol &symbol, long count) {
+            gains[std::make_pair(symbol.value, symbol.length)] += count * symbol.length;
+        };
+        for (int id = 0; id < numIds; id++) {
+            if (singleCounts[id] == 0) {
+                continue;
+            }
+            Symbol single = symbolOf(id);
+            addCandidate(single, singleCounts[id]);
+            if (single.length == MAX_SYMBOL_LENGTH) {
+                continue;
+            }
+            for (int next = 0; next < numIds; next++) {
+                int count = pairCounts[id * numIds + next];
+                if (count == 0) {
+                    continue;
+                }
+                Symbol second = symbolOf(next);
+                int length = std::min((int) MAX_SYMBOL_LENGTH, single.length + second.length);
+                uint64_t value = single.value | (second.value << (single.length * 8));
+                addCandidate(Symbol{value & symbolMask(length), length}, count);
+            }
+        }
+
+        std::vector<std::pair<long, Symbol>> ranked;
+        ranked.reserve(gains.size());
+        for (const auto &gain : gains) {
+            ranked.emplace_back(gain.second, Symbol{gain.first.first, gain.first.second});
+        }
+        std::sort(ranked.begin(), ranked.end(), [](const std::pair<long, Symbol> &a, const std::pair<long, Symbol> &b) {
+            if (a.first != b.first) {
+                return a.first > b.first;
+            }
+            return a.second.length > b.second.length;
+        });
+        symbols.clear();
+        for (int i = 0; i < (int) ranked.size() && i < MAX_SYMBOLS; i++) {
+            symbols.push_back(ranked[i].second);
+        }
+        buildIndex();
+    }
+}
+
+int FsstEncoder::encode(const uint8_t *src, int length, uint8_t *dst) const {
+    uint8_t *out = dst;
+    for (int pos = 0; pos < length; ) {
+        int code = findLongestSymbol(src + pos, length - pos);
+        if (code >= 0) {
+            *out++ = (uint8_t) code;
+            pos += symbols[code].length;
+        } else {
+            *out++ = ESCAPE_CODE;
+            *out++ = src[pos++];
+        }
+    }
+    return (int) (out - dst);
+}
+
+int FsstEncoder::maxEncodedLength(int length) {
+    return length * 2;
+}
+
+int FsstEncoder::getSymbolTableSize() const {
+    int size = 1 + (int) symbols.size();
+    for (const auto &symbol : symbols) {
+        size += symbol.length;
+    }
+    return size;
+}
+
+void FsstEncoder::writeSymbolTable(std::shared_ptr<SegmentedOutputStream> out) const {
+    out->put((uint8_t) symbols.size());
+    for (const auto &symbol : symbols) {
+        out->put((uint8_t) symbol.length);
+    }
+    for (const auto &symbol : symbols) {
+        uint8_t bytes[MAX_SYMBOL_LENGTH];
+        std::memcpy(bytes, &symbol.value, MAX_SYMBOL_LENGTH);
+        out->putBytes(bytes, symbol.length);
+    }
+}
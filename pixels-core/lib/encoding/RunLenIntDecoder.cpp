@@ -35,6 +35,25 @@ long RunLenIntDecoder::next() {
     return result;
 }
 
+void RunLenIntDecoder::next(long *buffer, int offset, int len) {
+    while(len > 0) {
+        if(used == numLiterals) {
+            numLiterals = 0;
+            used = 0;
+            readValues();
+            if(numLiterals == 0) {
+                throw InvalidArgumentException("RunLenIntDecoder::next: "
+                                               "no more values to decode.");
+            }
+        }
+        int n = std::min(len, numLiterals - used);
+        std::memcpy(buffer + offset, literals + used, n * sizeof(long));
+        used += n;
+        offset += n;
+        len -= n;
+    }
+}
+
 void RunLenIntDecoder::readValues() {
 	// read the first 2 bits and determine the encoding type
 	isRepeating = false;
@@ -55,8 +74,8 @@ void RunLenIntDecoder::readValues() {
             readDirectValues(firstByte);
             break;
         case RunLenIntEncoder::PATCHED_BASE:
-            throw InvalidArgumentException("Currently "
-                                           "we don't support PATCHED_BASE encoding.");
+            readPatchedBaseValues(firstByte);
+            break;
         case RunLenIntEncoder::DELTA:
 		    readDeltaValues(firstByte);
 		    break;
@@ -88,6 +107,130 @@ void RunLenIntDecoder::readDirectValues(int firstByte) {
     }
 }
 
+void RunLenIntDecoder::readPatchedBaseValues(int firstByte) {
+	// extract the number of fixed bits
+	uint8_t fbo = (((uint32_t)firstByte) >> 1) & 0x1f;
+	int fb = encodingUtils.decodeBitWidth(fbo);
+
+	// extract the run length of data blob
+	int len = (firstByte & 0x01) << 8;
+	len |= inputStream->get();
+	// runs are always one off
+	len += 1;
+
+	// extract the number of bytes occupied by base
+	int thirdByte = inputStream->get();
+	int bw = (((uint32_t)thirdByte) >> 5) & 0x07;
+	// base width is one off
+	bw += 1;
+
+	// extract patch width
+	int pwo = thirdByte & 0x1f;
+	int pw = encodingUtils.decodeBitWidth(pwo);
+
+	// read fourth byte and extract patch gap width
+	int fourthByte = inputStream->get();
+	int pgw = (((uint32_t)fourthByte) >> 5) & 0x07;
+	// patch gap width is one off
+	pgw += 1;
+
+	// extract the length of the patch list
+	int pl = fourthByte & 0x1f;
+
+	// read the next base width number of bytes to extract base value,
+	// the msb of base is the sign bit
+	long base = bytesToLongBE(inputStream, bw);
+	long mask = (1L << ((bw * 8) - 1));
+	if((base & mask) != 0) {
+		base = base & ~mask;
+		base = -base;
+	}
+
+	// unpack the data blob
+	std::vector<long> unpacked(len);
+	readInts(unpacked.data(), 0, len, fb, inputStream);
+
+	// unpack the patch blob
+	std::vector<long> unpackedPatch(pl);
+	if((pw + pgw) > 64) {
+		throw InvalidArgumentException("RunLenIntDecoder::readPatchedBaseValues: "
+		                               "patch width and gap width exceed 64 bits.");
+	}
+	int cfb = encodingUtils.getClosestFixedBits(pw + pgw);
+	readInts(unpackedPatch.data(), 0, pl, cfb, inputStream);
+
+	if(pl == 0) {
+		// the encoder may choose patched base without any patch
+		for(int i = 0; i < len; i++) {
+			literals[numLiterals++] = base + unpacked[i];
+		}
+		return;
+	}
+
+	// apply the patch directly when decoding the packed data
+	int patchIdx = 0;
+	long currGap = 0;
+	long currPatch = 0;
+	long patchMask = ((1L << pw) - 1);
+	currGap = ((uint64_t)unpackedPatch[patchIdx]) >> pw;
+	currPatch = unpackedPatch[patchIdx] & patchMask;
+	long actualGap = 0;
+
+	// special case: gap is >255 then patch value will be 0.
+	// if gap is <=255 then patch value cannot be 0
+	while(currGap == 255 && currPatch == 0) {
+		actualGap += 255;
+		patchIdx++;
+		if(patchIdx >= pl) {
+			throw InvalidArgumentException("RunLenIntDecoder::readPatchedBaseValues: "
+			                               "patch list ends inside a gap.");
+		}
+		currGap = ((uint64_t)unpackedPatch[patchIdx]) >> pw;
+		currPatch = unpackedPatch[patchIdx] & patchMask;
+	}
+	// add the left over gap
+	actualGap += currGap;
+
+	for(int i = 0; i < len; i++) {
+		if(i == actualGap) {
+			// extract the patch value and apply it to the unpacked value
+			long patchedVal = unpacked[i] | (currPatch << fb);
+			literals[numLiterals++] = base + patchedVal;
+
+			// increment the patch to point to next entry in patch list
+			patchIdx++;
+
+			if(patchIdx < pl) {
+				// read the next gap and patch
+				currGap = ((uint64_t)unpackedPatch[patchIdx]) >> pw;
+				currPatch = unpackedPatch[patchIdx] & patchMask;
+				actualGap = 0;
+
+				// special case: gap is >255 then patch will be 0. if gap is
+				// <=255 then patch cannot be 0
+				while(currGap == 255 && currPatch == 0) {
+					actualGap += 255;
+					patchIdx++;
+					if(patchIdx >= pl) {
+						throw InvalidArgumentException("RunLenIntDecoder::readPatchedBaseValues: "
+						                               "patch list ends inside a gap.");
+					}
+					currGap = ((uint64_t)unpackedPatch[patchIdx]) >> pw;
+					currPatch = unpackedPatch[patchIdx] & patchMask;
+				}
+				// add the left over gap
+				actualGap += currGap;
+
+				// next gap is relative to the current gap
+				actualGap += i;
+			}
+		} else {
+			// no patching required. add base to unpacked value to get final value
+			literals[numLiterals++] = base + unpacked[i];
+		}
+	}
+}
+
 long RunLenIntDecoder::zigzagDecode(long val) {
     return (long) (((uint64_t)val >> 1) ^ -(val & 1));
 }
@@ -134,10 +277,28 @@ void RunLenIntDecoder::readInts(long *buffer, int offset, int len, int bitSize,
 		    encodingUtils.unrolledUnPack64(buffer, offset, len, input);
 		    return;
         default:
-            throw InvalidArgumentException("RunLenIntDecoder::readInts: "
-                                           "not supported bitSize.");
+            break;
+    }
+    // the bit size is not byte aligned (e.g., the patch list of PATCHED_BASE),
+    // read the values bit by bit in big endian order
+    for(int i = offset; i < (offset + len); i++) {
+        long result = 0;
+        int bitsLeftToRead = bitSize;
+        while(bitsLeftToRead > bitsLeft) {
+            result <<= bitsLeft;
+            result |= current & ((1 << bitsLeft) - 1);
+            bitsLeftToRead -= bitsLeft;
+            current = input->get();
+            bitsLeft = 8;
+        }
+        // handle the left over bits
+        if(bitsLeftToRead > 0) {
+            result <<= bitsLeftToRead;
+            bitsLeft -= bitsLeftToRead;
+            result |= (current >> bitsLeft) & ((1 << bitsLeftToRead) - 1);
+        }
+        buffer[i] = result;
     }
-    // TODO: if notthe case, we should write the following code.
 }
 
 void RunLenIntDecoder::readDeltaValues(int firstByte) {
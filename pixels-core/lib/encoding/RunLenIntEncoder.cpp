@@ -37,6 +37,9 @@ RunLenIntEncoder::RunLenIntEncoder(bool isSigned, bool isAlignedBitPacking) :
     baseRedLiterals = new long[Constants::MAX_SCOPE];
     adjDeltas = new long[Constants::MAX_SCOPE];
     gapVsPatchList = new long[Constants::MAX_SCOPE];
+    fixedRunLength = 0;
+    variableRunLength = 0;
+    gapVsPatchListSize = 0;
     clear();
 }
 
@@ -67,6 +70,7 @@ RunLenIntEncoder::~RunLenIntEncoder() {
 // -----------------------------------------------------------
 // Encoding Handles
 void RunLenIntEncoder::encode(long* values, int offset, int length, byte* results, int& resLen) {
+    ensureOutputStream(length);
     for(int i = 0; i < length; ++i) {
         // std::cout << encodingType << " value : " << values[i + offset] << std::endl;
         this->write(values[i + offset]);
@@ -80,6 +84,7 @@ void RunLenIntEncoder::encode(long* values, int offset, int length, byte* result
 }
 
 void RunLenIntEncoder::encode(int* values, int offset, int length, byte* results, int& resLen) {
+    ensureOutputStream(length);
     for(int i = 0; i < length; ++i) {
         this->write(values[i + offset]);
     }
@@ -98,6 +103,19 @@ void RunLenIntEncoder::encode(int* values, byte* results, int length, int& resLe
 }
 
 
+int RunLenIntEncoder::getMaxEncodedSize(int length) {
+    // each run has at most 512 values, a 4-byte header, an 8-byte base
+    // and a patch list of 5% of the values, which is less than 256 bytes
+    return length * sizeof(long) + (length / Constants::MAX_SCOPE + 1) * (Constants::MAX_SCOPE / 2);
+}
+
+void RunLenIntEncoder::ensureOutputStream(int length) {
+    int maxSize = getMaxEncodedSize(length);
+    if(outputStream->size() < maxSize) {
+        outputStream = std::make_shared<ByteBuffer>(maxSize);
+    }
+}
+
 // -----------------------------------------------------------
 
 void RunLenIntEncoder::determineEncoding() {
@@ -321,6 +339,7 @@ void RunLenIntEncoder::preparePatchedBlob() {
     // 255 gap => 0 for patch value
     // 1 gap => actual patch value
     if(patchGapWidth > 8) {
+        patchGapWidth = 8;
         // for gap = 511, we need two extra entries in patch list
         if(maxGap == 511) {
             patchLength += 2;
@@ -853,7 +872,7 @@ int RunLenIntEncoder::percentileBits(long*  data, int offset, int length, double
         return -1;
     }
 
-    int hist[32];
+    int hist[32] = {0};
     for(int i = offset; i < (offset + length); ++i) {
         // QUESTION: there is calling of getClosestFixedBits in encodeBitWidth function, 
         //           is it redundant here to call it? maybe just count is enough
@@ -971,7 +990,7 @@ void RunLenIntEncoder::writeVulong(std::shared_ptr<ByteBuffer> output, long valu
         }
         else {
             output->put((byte) (0x80 | (value & 0x7f)));
-            value = ((unsigned)value) >> 7;
+            value = ((unsigned long)value) >> 7;
         }
     }
 }
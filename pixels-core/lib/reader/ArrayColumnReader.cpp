@@ -0,0 +1,95 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "reader/ArrayColumnReader.h"
+#include "reader/ColumnReaderBuilder.h"
+#include "exception/InvalidArgumentException.h"
+#include <cstring>
+
+ArrayColumnReader::ArrayColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+    elementType = type->getChildren().at(0);
+    elementReader = ColumnReaderBuilder::newColumnReader(elementType);
+    elementPosition = 0;
+}
+
+void ArrayColumnReader::close() {
+    elementReader->close();
+}
+
+void ArrayColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                             int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                             pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+    readRange(input, encoding, offset, size, pixelStride, vectorIndex, vector, chunkIndex, filterMask);
+}
+
+void ArrayColumnReader::readRange(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                                  int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                                  pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+    std::shared_ptr<ListColumnVector> columnVector =
+            std::static_pointer_cast<ListColumnVector>(vector);
+    if(offset == 0) {
+        elementIndex = 0;
+        elementPosition = 0;
+        isNullOffset = chunkIndex.isnulloffset();
+    }
+    for(int i = 0; i < size;) {
+        int partSize = std::min(size - i, pixelStride - elementIndex % pixelStride);
+        int pixelId = elementIndex / pixelStride;
+        bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+        setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex + i, partSize);
+        elementIndex += partSize;
+        i += partSize;
+    }
+
+    // the lengths of the null rows are also stored, they are 0
+    ListEntry * entries = columnVector->entries + vectorIndex;
+    uint64_t childStart = vectorIndex == 0 ? 0 : entries[-1].offset + entries[-1].length;
+    uint64_t numElements = 0;
+    const uint8_t * lengths = input->getPointer() + input->getReadPos();
+    for(int i = 0; i < size; i++) {
+        int length;
+        std::memcpy(&length, lengths + i * sizeof(int), sizeof(int));
+        entries[i].offset = childStart + numElements;
+        entries[i].length = length;
+        numElements += length;
+    }
+    input->setReadPos(input->getReadPos() + size * sizeof(int));
+
+    if(columnVector->child->length < childStart + numElements) {
+        if(childStart > 0) {
+            throw InvalidArgumentException("ArrayColumnReader: the elements of a row batch must be read at once");
+        }
+        // the elements of the previous row batch are consumed, replace the child vector with a larger one
+        uint64_t capacity = std::max(childStart + numElements, 2 * columnVector->child->length);
+        columnVector->child->close();
+        columnVector->child = elementType->createColumn(capacity, columnVector->encoding);
+    }
+    if(numElements > 0) {
+        elementReader->readRange(elementChunk.input, *elementChunk.encoding, elementPosition, numElements,
+                                 pixelStride, childStart, columnVector->child, *elementChunk.chunkIndex, nullptr);
+        elementPosition += numElements;
+    }
+    columnVector->childCount = childStart + numElements;
+}
+
+int ArrayColumnReader::setChildChunks(const std::vector<ChildColumnChunk> & chunks, int start) {
+    elementChunk = chunks.at(start++);
+    return elementReader->setChildChunks(chunks, start);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "reader/ByteColumnReader.h"
+#include "vector/ByteColumnVector.h"
+#include "utils/BitUtils.h"
+#include <cstring>
+
+ByteColumnReader::ByteColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+	isBoolean = type->getCategory() == TypeDescription::BOOLEAN;
+}
+
+void ByteColumnReader::close() {
+
+}
+
+void ByteColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                            int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                            pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+	std::shared_ptr<ByteColumnVector> columnVector =
+	    std::static_pointer_cast<ByteColumnVector>(vector);
+	if(offset == 0) {
+		decoder = std::make_shared<RunLenIntDecoder>(input, true);
+		elementIndex = 0;
+		isNullOffset = chunkIndex.isnulloffset();
+	}
+
+	int pixelId = elementIndex / pixelStride;
+	bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+	int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+	bool nullsPadding = chunkIndex.nullspadding();
+	// the number of values stored in the column chunk for [offset, offset + size)
+	int numValues = nullsPadding ? size : size - numNulls;
+	columnVector->bitVector = nullptr;
+
+	if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+		useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex);
+		if((int) runLengthBuffer.size() < numValues) {
+			runLengthBuffer.resize(numValues);
+		}
+		decoder->next(runLengthBuffer.data(), 0, numValues);
+		if(numNulls < size) {
+			for(int i = 0; i < numValues; i++) {
+				columnVector->vector[i + vectorIndex] = (uint8_t) runLengthBuffer[i];
+			}
+		}
+	} else if(isBoolean) {
+		if(elementIndex % pixelStride == 0) {
+			pixelStart = input->getReadPos();
+			pixelValueIndex = 0;
+		}
+		const uint8_t * bits = input->getPointer() + pixelStart;
+		useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex);
+		if(numNulls < size) {
+			BitUtils::unpackBits(bits, pixelValueIndex, columnVector->vector + vectorIndex, numValues);
+		}
+		if(numNulls == 0 && vectorIndex == 0 && pixelValueIndex % 8 == 0) {
+			columnVector->bitVector = bits + pixelValueIndex / 8;
+		}
+		pixelValueIndex += numValues;
+		// the bits of the next pixel start from a new byte
+		input->setReadPos(pixelStart + (pixelValueIndex + 7) / 8);
+	} else {
+		uint8_t * values = input->getPointer() + input->getReadPos();
+		if((nullsPadding || numNulls == 0) && (vectorIndex == 0 || columnVector->vector + vectorIndex == values)) {
+			// the previous parts of the vector are followed by these values in the chunk buffer
+			columnVector->vector = values - vectorIndex;
+			vector->pin(input);
+		} else {
+			// the values can not be referenced in the chunk buffer
+			useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex);
+			std::memcpy(columnVector->vector + vectorIndex, values, numValues);
+		}
+		input->setReadPos(input->getReadPos() + numValues);
+	}
+	if(!nullsPadding && numNulls > 0 && numNulls < size) {
+		scatterNonNulls(columnVector->vector + vectorIndex, numValues, size, vector, vectorIndex);
+	}
+	elementIndex += size;
+}
@@ -3,8 +3,81 @@
 //
 
 #include "reader/CharColumnReader.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 CharColumnReader::CharColumnReader(std::shared_ptr<TypeDescription> type)
     :StringColumnReader(type) {
-    // TODO: implement
+    maxLength = type->getMaxLength();
+}
+
+void CharColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                            int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                            pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+    if(encoding.kind() != pixels::proto::ColumnEncoding_Kind_FIXED_WIDTH) {
+        StringColumnReader::read(input, encoding, offset, size, pixelStride, vectorIndex, vector, chunkIndex, filterMask);
+        return;
+    }
+    std::shared_ptr<BinaryColumnVector> columnVector =
+            std::static_pointer_cast<BinaryColumnVector>(vector);
+    if(offset == 0) {
+        elementIndex = 0;
+        isNullOffset = chunkIndex.isnulloffset();
+    }
+    int pixelId = elementIndex / pixelStride;
+    bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+    int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+    bool nullsPadding = chunkIndex.nullspadding();
+    uint8_t * values = input->getPointer() + input->getReadPos();
+    // the values are referenced in the chunk buffer
+    vector->pin(input);
+    FixedWidthKernel kernel = fixedWidthKernels[kernelIndex(numNulls > 0, filterMask != nullptr)];
+    (this->*kernel)(columnVector, values, vectorIndex, size, nullsPadding, filterMask.get());
+    // the number of values stored in the column chunk for [offset, offset + size)
+    int numValues = nullsPadding ? size : size - numNulls;
+    input->setReadPos(input->getReadPos() + numValues * maxLength);
+    elementIndex += size;
+}
+
+const CharColumnReader::FixedWidthKernel CharColumnReader::fixedWidthKernels[4] = {
+    &CharColumnReader::readFixedWidth<false, false>, &CharColumnReader::readFixedWidth<false, true>,
+    &CharColumnReader::readFixedWidth<true, false>, &CharColumnReader::readFixedWidth<true, true>
+};
+
+template <bool HAS_NULLS, bool FILTERED>
+void CharColumnReader::readFixedWidth(const std::shared_ptr<BinaryColumnVector> & columnVector, uint8_t * values,
+                                      int vectorIndex, int size, bool nullsPadding, PixelsBitMask * filterMask) {
+    int start = 0;
+    for(int i = 0; i < size; i++) {
+        if(HAS_NULLS && !columnVector->checkValid(i + vectorIndex)) {
+            // only padded nulls are stored in the column chunk
+            start += nullsPadding ? maxLength : 0;
+            continue;
+        }
+        if(!FILTERED || filterMask->get(i + vectorIndex)) {
+            columnVector->setRef(i + vectorIndex, values, start, trimmedLength(values + start, maxLength));
+        }
+        start += maxLength;
+    }
+}
+
+int CharColumnReader::trimmedLength(const uint8_t * value, int length) {
+    int end = length;
+#ifdef __SSE2__
+    // compare 16 bytes at a time from the end, until a byte that is not a space is found
+    const __m128i spaces = _mm_set1_epi8(' ');
+    while(end >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(value + end - 16));
+        int nonSpaces = ~_mm_movemask_epi8(_mm_cmpeq_epi8(block, spaces)) & 0xFFFF;
+        if(nonSpaces != 0) {
+            return end - 16 + (32 - __builtin_clz(nonSpaces));
+        }
+        end -= 16;
+    }
+#endif
+    while(end > 0 && value[end - 1] == ' ') {
+        end--;
+    }
+    return end;
 }
@@ -3,6 +3,7 @@
 //
 
 #include "reader/ColumnReader.h"
+#include "utils/BitUtils.h"
 
 ColumnReader::ColumnReader(std::shared_ptr<TypeDescription> type) {
     this->type = type;
@@ -45,6 +46,10 @@ std::shared_ptr<ColumnReader> ColumnReader::newColumnReader(std::shared_ptr<Type
             break;
         case TypeDescription::STRUCT:
             break;
+        case TypeDescription::VECTOR:
+            break;
+        case TypeDescription::ARRAY:
+            break;
     }
 	throw InvalidArgumentException("This function is not supported yet. ");
 }
@@ -56,36 +61,39 @@ ColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncod
 }
 
 
-void ColumnReader::setValid(const std::shared_ptr<ByteBuffer>& input, int pixelStride, const std::shared_ptr<ColumnVector>& columnVector, int pixelId, bool hasNull) {
-    int elementSizeInCurrPixels = std::min(pixelStride, (int)columnVector->length);
-    columnVector->isNull = input->getPointer() + isNullOffset;
-
-    int byteSize = ceil(1.0 * elementSizeInCurrPixels / 8);
+void ColumnReader::readRange(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding &encoding, int offset,
+                             int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                             pixels::proto::ColumnChunkIndex &chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+    while(size > 0) {
+        int partSize = std::min(size, pixelStride - offset % pixelStride);
+        read(input, encoding, offset, partSize, pixelStride, vectorIndex, vector, chunkIndex, filterMask);
+        offset += partSize;
+        vectorIndex += partSize;
+        size -= partSize;
+    }
+}
 
-    if (hasNull) {
-        for(int byteOffset = 0; byteOffset < byteSize; byteOffset++) {
-            ((uint8_t *) columnVector->isValid)[byteOffset] = ~(columnVector->isNull[byteOffset]);
+int ColumnReader::setValid(const std::shared_ptr<ByteBuffer>& input, int pixelStride, const std::shared_ptr<ColumnVector>& columnVector,
+                           int pixelId, bool hasNull, int vectorIndex, int size) {
+    if (!hasNull) {
+        // most pixels have no null, neither the bitmap nor the validity mask is touched
+        if (vectorIndex == 0) {
+            columnVector->noNulls = true;
+        } else if (!columnVector->noNulls) {
+            BitUtils::fillValidityMask(columnVector->isValid, vectorIndex, size);
         }
-        isNullOffset += byteSize;
-    } else {
-        memset(((uint8_t *)columnVector->isValid), 0xFF, byteSize);
+        return 0;
     }
-//    while (currentElementIndex < initElementIndex + columnVector->length) {
-//        int elementSizeInCurrPixels = std::min(pixelStride, (int)(initElementIndex + columnVector->length) - pixelId * pixelStride);
-//        elementSizeInCurrPixels = std::min(elementSizeInCurrPixels, pixelStride - (initElementIndex % pixelStride));
-//        int byteSize = ceil(1.0 * elementSizeInCurrPixels / 8);
-//        if (chunkIndex.pixelstatistics(pixelId).statistic().hasnull()) {
-//            for(int byteOffset = 0; byteOffset < byteSize; byteOffset++) {
-//                ((uint8_t *) columnVector->isValid)[byteOffset + (currentElementIndex - initElementIndex) / 8] =
-//                        ~(columnVector->isNull[byteOffset + nullId]);
-//            }
-//            nullId += elementSizeInCurrPixels / 8;
-//        } else {
-//            memset(((uint8_t *)columnVector->isValid) + (currentElementIndex - initElementIndex) / 8, 0xFF, byteSize);
-//        }
-//        currentElementIndex += elementSizeInCurrPixels;
-//        pixelId++;
-//    }
-//
-//    columnVector->isNull = (uint8_t *)(input->getPointer() + isNullOffset + pixelId * pixelStride / 8);
+    if (columnVector->noNulls && vectorIndex > 0) {
+        // the previous parts of the vector have no null
+        BitUtils::fillValidityMask(columnVector->isValid, 0, vectorIndex);
+    }
+    columnVector->noNulls = false;
+    int elementInPixel = elementIndex % pixelStride;
+    int numNulls = BitUtils::toValidityMask(input->getPointer() + isNullOffset, elementInPixel,
+                                            columnVector->isValid, vectorIndex, size);
+    if (elementInPixel + size >= pixelStride) {
+        isNullOffset += (pixelStride + 7) / 8;
+    }
+    return numNulls;
 }
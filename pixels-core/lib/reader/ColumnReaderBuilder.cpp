@@ -7,23 +7,21 @@
 
 std::shared_ptr<ColumnReader> ColumnReaderBuilder::newColumnReader(std::shared_ptr<TypeDescription> type) {
     switch (type->getCategory()) {
-//        case TypeDescription::BOOLEAN:
-//            break;
-//        case TypeDescription::BYTE:
-//            break;
+        case TypeDescription::BOOLEAN:
+        case TypeDescription::BYTE:
+            return std::make_shared<ByteColumnReader>(type);
         case TypeDescription::SHORT:
         case TypeDescription::INT:
         case TypeDescription::LONG:
             return std::make_shared<IntegerColumnReader>(type);
-//        case TypeDescription::FLOAT:
-//            break;
-//        case TypeDescription::DOUBLE:
-//            break;
+        case TypeDescription::FLOAT:
+        case TypeDescription::DOUBLE:
+            return std::make_shared<DoubleColumnReader>(type);
 	    case TypeDescription::DECIMAL: {
 		    if (type->getPrecision() <= TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
 			    return std::make_shared<DecimalColumnReader>(type);
 		    } else {
-			    throw InvalidArgumentException("Currently we didn't implement LongDecimalColumnVector.");
+			    return std::make_shared<LongDecimalColumnReader>(type);
 		    }
 	    }
         case TypeDescription::STRING:
@@ -31,20 +29,24 @@ std::shared_ptr<ColumnReader> ColumnReaderBuilder::newColumnReader(std::shared_p
             break;
         case TypeDescription::DATE:
 		    return std::make_shared<DateColumnReader>(type);
-//        case TypeDescription::TIME:
-//            break;
+        case TypeDescription::TIME:
+            return std::make_shared<TimeColumnReader>(type);
         case TypeDescription::TIMESTAMP:
             return std::make_shared<TimestampColumnReader>(type);
-//        case TypeDescription::VARBINARY:
-//            break;
-//        case TypeDescription::BINARY:
-//            break;
+        case TypeDescription::BINARY:
+        case TypeDescription::VARBINARY:
+            // binaries share the column chunk layout of strings
+            return std::make_shared<StringColumnReader>(type);
         case TypeDescription::VARCHAR:
             return std::make_shared<VarcharColumnReader>(type);
         case TypeDescription::CHAR:
             return std::make_shared<CharColumnReader>(type);
-//        case TypeDescription::STRUCT:
-//            break;
+        case TypeDescription::VECTOR:
+            return std::make_shared<VectorColumnReader>(type);
+        case TypeDescription::STRUCT:
+            return std::make_shared<StructColumnReader>(type);
+        case TypeDescription::ARRAY:
+            return std::make_shared<ArrayColumnReader>(type);
         default:
             throw InvalidArgumentException("bad column type in ColumnReaderBuilder: " + std::to_string(type->getCategory()));
     }
@@ -26,18 +26,39 @@ void DateColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::Co
 
     int pixelId = elementIndex / pixelStride;
     bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
-    setValid(input, pixelStride, vector, pixelId, hasNull);
+    int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+    bool nullsPadding = chunkIndex.nullspadding();
+    // the number of values stored in the column chunk for [offset, offset + size)
+    int numValues = nullsPadding ? size : size - numNulls;
 
 	if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
-        for (int i = 0; i < size; i++) {
-            if (elementIndex % pixelStride == 0) {
-                int pixelId = elementIndex / pixelStride;
+        useDecodedBuffer(columnVector->dates, columnVector->decodedDates, vectorIndex);
+        if(numNulls == size) {
+            // all null: skip the padded values without decoding them into the vector
+            for(int i = 0; i < numValues; i++) {
+                decoder->next();
+            }
+        } else {
+            for(int i = 0; i < numValues; i++) {
+                columnVector->set(i + vectorIndex, (int) decoder->next());
             }
-            columnVector->set(i + vectorIndex, (int) decoder->next());
-            elementIndex++;
         }
 	} else {
-		columnVector->dates = (int *)(input->getPointer() + input->getReadPos());
-		input->setReadPos(input->getReadPos() + size * sizeof(int));
+        int * values = (int *)(input->getPointer() + input->getReadPos());
+        if((nullsPadding || numNulls == 0) && (vectorIndex == 0 || columnVector->dates + vectorIndex == values)) {
+            // the previous parts of the vector are followed by these values in the chunk buffer
+            columnVector->dates = values - vectorIndex;
+            vector->pin(input);
+        } else {
+            // the values can not be referenced in the chunk buffer
+            useDecodedBuffer(columnVector->dates, columnVector->decodedDates, vectorIndex);
+            std::memcpy(columnVector->dates + vectorIndex, values,
+                        numValues * sizeof(int));
+        }
+		input->setReadPos(input->getReadPos() + numValues * sizeof(int));
 	}
+    if(!nullsPadding && numNulls > 0 && numNulls < size) {
+        scatterNonNulls(columnVector->dates + vectorIndex, numValues, size, vector, vectorIndex);
+    }
+    elementIndex += size;
 }
@@ -28,19 +28,92 @@ void DecimalColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto:
 									   "vector of decimal(" + std::to_string(columnVector->getPrecision()) + ","
 		                               + std::to_string(columnVector->getScale()) + ")");
 	}
+    // Make sure [offset, offset + size) is in the same pixels.
+    assert(offset / pixelStride == (offset + size - 1) / pixelStride);
+
+    // if read from start, init the stream and decoder
     if(offset == 0) {
-        // TODO: here we check null
+        decoder = std::make_shared<RunLenIntDecoder>(input, true);
         ColumnReader::elementIndex = 0;
         isNullOffset = chunkIndex.isnulloffset();
+        selectKernels(encoding);
     }
-    // TODO: we didn't implement the run length encoded method
 
     int pixelId = elementIndex / pixelStride;
     bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
-    setValid(input, pixelStride, vector, pixelId, hasNull);
+    int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+    bool nullsPadding = chunkIndex.nullspadding();
+    // the number of values stored in the column chunk for [offset, offset + size)
+    int numValues = nullsPadding ? size : size - numNulls;
 
-    columnVector->vector = (long *)(input->getPointer() + input->getReadPos());
-    input->setReadPos(input->getReadPos() + size * sizeof(long));
+    if(numNulls == size) {
+        // all null: skip the padded values without decoding them into the vector
+        if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+            for(int i = 0; i < numValues; i++) {
+                decoder->next();
+            }
+        } else {
+            input->setReadPos(input->getReadPos() + numValues * sizeof(long));
+        }
+    } else {
+        Kernel kernel = kernels[kernelIndex(numNulls > 0, filterMask != nullptr)];
+        (this->*kernel)(input, columnVector, vectorIndex, size, numValues, nullsPadding, filterMask.get());
+    }
+    elementIndex += size;
+}
+
+void DecimalColumnReader::selectKernels(pixels::proto::ColumnEncoding & encoding) {
+    if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+        kernels[kernelIndex(false, false)] = &DecimalColumnReader::readRle<false, false>;
+        kernels[kernelIndex(false, true)] = &DecimalColumnReader::readRle<false, true>;
+        kernels[kernelIndex(true, false)] = &DecimalColumnReader::readRle<true, false>;
+        kernels[kernelIndex(true, true)] = &DecimalColumnReader::readRle<true, true>;
+    } else {
+        kernels[kernelIndex(false, false)] = &DecimalColumnReader::readPlain<false, false>;
+        kernels[kernelIndex(false, true)] = &DecimalColumnReader::readPlain<false, true>;
+        kernels[kernelIndex(true, false)] = &DecimalColumnReader::readPlain<true, false>;
+        kernels[kernelIndex(true, true)] = &DecimalColumnReader::readPlain<true, true>;
+    }
+}
 
+template <bool HAS_NULLS, bool FILTERED>
+void DecimalColumnReader::readPlain(const std::shared_ptr<ByteBuffer> & input,
+                                    const std::shared_ptr<DecimalColumnVector> & columnVector,
+                                    int vectorIndex, int size, int numValues, bool nullsPadding,
+                                    PixelsBitMask * filterMask) {
+    long * values = (long *)(input->getPointer() + input->getReadPos());
+    bool dense = !HAS_NULLS || nullsPadding;
+    if(dense && (vectorIndex == 0 || columnVector->vector + vectorIndex == values)) {
+        // the previous parts of the vector are followed by these values in the chunk buffer
+        columnVector->vector = values - vectorIndex;
+        columnVector->pin(input);
+    } else {
+        // the values can not be referenced in the chunk buffer
+        useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex);
+        if(dense) {
+            std::memcpy(columnVector->vector + vectorIndex, values, numValues * sizeof(long));
+        } else {
+            gatherNonNulls<long, long, FILTERED>(values, columnVector->vector + vectorIndex, size,
+                                                 columnVector, vectorIndex, filterMask);
+        }
+    }
+    input->setReadPos(input->getReadPos() + numValues * sizeof(long));
+}
 
+template <bool HAS_NULLS, bool FILTERED>
+void DecimalColumnReader::readRle(const std::shared_ptr<ByteBuffer> & input,
+                                  const std::shared_ptr<DecimalColumnVector> & columnVector,
+                                  int vectorIndex, int size, int numValues, bool nullsPadding,
+                                  PixelsBitMask * filterMask) {
+    useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex);
+    if(!HAS_NULLS || nullsPadding) {
+        decoder->next(columnVector->vector + vectorIndex, 0, numValues);
+        return;
+    }
+    if((int) decodeBuffer.size() < numValues) {
+        decodeBuffer.resize(numValues);
+    }
+    decoder->next(decodeBuffer.data(), 0, numValues);
+    gatherNonNulls<long, long, FILTERED>(decodeBuffer.data(), columnVector->vector + vectorIndex, size,
+                                         columnVector, vectorIndex, filterMask);
 }
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "reader/DoubleColumnReader.h"
+#include "vector/DoubleColumnVector.h"
+#include "encoding/ByteStreamSplit.h"
+#include <cstring>
+
+DoubleColumnReader::DoubleColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+	width = type->getCategory() == TypeDescription::DOUBLE ? sizeof(double) : sizeof(float);
+}
+
+void DoubleColumnReader::close() {
+
+}
+
+void DoubleColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                              int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                              pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+	std::shared_ptr<DoubleColumnVector> columnVector =
+	    std::static_pointer_cast<DoubleColumnVector>(vector);
+	if(offset == 0) {
+		elementIndex = 0;
+		isNullOffset = chunkIndex.isnulloffset();
+	}
+
+	int pixelId = elementIndex / pixelStride;
+	bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+	int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+	bool nullsPadding = chunkIndex.nullspadding();
+	// the number of values stored in the column chunk for [offset, offset + size)
+	int numValues = nullsPadding ? size : size - numNulls;
+	uint8_t * values = input->getPointer() + input->getReadPos();
+	uint8_t * current = width == sizeof(double) ? reinterpret_cast<uint8_t *>(columnVector->doubleVector)
+	                                            : reinterpret_cast<uint8_t *>(columnVector->floatVector);
+
+	if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_BYTE_STREAM_SPLIT) {
+		if(elementIndex % pixelStride == 0) {
+			// the streams of a pixel are as long as the number of non-null values in the pixel
+			pixelStreamLength = (int) chunkIndex.pixelstatistics(pixelId).statistic().numberofvalues();
+			pixelValueIndex = 0;
+		}
+		useDecodedBuffer(current, columnVector->decodedVector, vectorIndex, width);
+		columnVector->setValues(current);
+		if(numNulls < size) {
+			// the read position advances by width bytes per value, whereas the first stream by one byte
+			ByteStreamSplit::decode(values - pixelValueIndex * (width - 1), pixelStreamLength, numValues, width,
+			                        columnVector->decodedVector + (long) vectorIndex * width);
+		}
+		pixelValueIndex += numValues;
+	} else {
+		if((nullsPadding || numNulls == 0) && (vectorIndex == 0 || current + (long) vectorIndex * width == values)) {
+			// the previous parts of the vector are followed by these values in the chunk buffer
+			columnVector->setValues(values - (long) vectorIndex * width);
+			vector->pin(input);
+		} else {
+			// the values can not be referenced in the chunk buffer
+			useDecodedBuffer(current, columnVector->decodedVector, vectorIndex, width);
+			columnVector->setValues(current);
+			std::memcpy(columnVector->decodedVector + (long) vectorIndex * width, values, (long) numValues * width);
+		}
+	}
+	input->setReadPos(input->getReadPos() + numValues * width);
+	if(!nullsPadding && numNulls > 0 && numNulls < size) {
+		if(width == sizeof(double)) {
+			scatterNonNulls(columnVector->doubleVector + vectorIndex, numValues, size, vector, vectorIndex);
+		} else {
+			scatterNonNulls(columnVector->floatVector + vectorIndex, numValues, size, vector, vectorIndex);
+		}
+	}
+	elementIndex += size;
+}
@@ -3,6 +3,7 @@
 //
 
 #include "reader/IntegerColumnReader.h"
+#include <type_traits>
 
 IntegerColumnReader::IntegerColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
     isLong = false;
@@ -28,31 +29,106 @@ void IntegerColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto:
         ColumnReader::elementIndex = 0;
 		isLong = type->getCategory() == TypeDescription::Category::LONG;
         isNullOffset = chunkIndex.isnulloffset();
+        selectKernels(encoding);
     }
 
     int pixelId = elementIndex / pixelStride;
     // still need to add pixelsStatistics in the writer
     bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
-    setValid(input, pixelStride, vector, pixelId, hasNull);
+    int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+    bool nullsPadding = chunkIndex.nullspadding();
+    // the number of values stored in the column chunk for [offset, offset + size)
+    int numValues = nullsPadding ? size : size - numNulls;
 
-    if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
-        for(int i = 0; i < size; i++) {
-			if(isLong) {
-				columnVector->longVector[i + vectorIndex] = decoder->next();
-			} else {
-				*(reinterpret_cast<int*>(columnVector->intVector) + i + vectorIndex)  = decoder->next();
-			}
-            elementIndex++;
+    if(numNulls == size) {
+        // all null: skip the padded values without decoding them into the vector
+        if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+            for(int i = 0; i < numValues; i++) {
+                decoder->next();
+            }
+        } else {
+            input->setReadPos(input->getReadPos() + numValues * (isLong ? sizeof(long) : sizeof(int)));
         }
     } else {
-        if(isLong) {
-            // if long
-            std::memcpy((void*)columnVector->longVector + vectorIndex * sizeof(int64_t), input->getPointer() + input->getReadPos(), size * sizeof(int64_t));
-			input->setReadPos(input->getReadPos() + size * sizeof(int64_t));
+        Kernel kernel = kernels[kernelIndex(numNulls > 0, filterMask != nullptr)];
+        (this->*kernel)(input, columnVector, vectorIndex, size, numValues, nullsPadding, filterMask.get());
+    }
+    elementIndex += size;
+}
+
+void IntegerColumnReader::selectKernels(pixels::proto::ColumnEncoding & encoding) {
+    if(isLong) {
+        selectKernels<long>(encoding);
+    } else {
+        selectKernels<int>(encoding);
+    }
+}
+
+template <typename T>
+void IntegerColumnReader::selectKernels(pixels::proto::ColumnEncoding & encoding) {
+    if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+        kernels[kernelIndex(false, false)] = &IntegerColumnReader::readRle<T, false, false>;
+        kernels[kernelIndex(false, true)] = &IntegerColumnReader::readRle<T, false, true>;
+        kernels[kernelIndex(true, false)] = &IntegerColumnReader::readRle<T, true, false>;
+        kernels[kernelIndex(true, true)] = &IntegerColumnReader::readRle<T, true, true>;
+    } else {
+        kernels[kernelIndex(false, false)] = &IntegerColumnReader::readPlain<T, false, false>;
+        kernels[kernelIndex(false, true)] = &IntegerColumnReader::readPlain<T, false, true>;
+        kernels[kernelIndex(true, false)] = &IntegerColumnReader::readPlain<T, true, false>;
+        kernels[kernelIndex(true, true)] = &IntegerColumnReader::readPlain<T, true, true>;
+    }
+}
+
+template <typename T, bool HAS_NULLS, bool FILTERED>
+void IntegerColumnReader::readPlain(const std::shared_ptr<ByteBuffer> & input,
+                                    const std::shared_ptr<LongColumnVector> & columnVector,
+                                    int vectorIndex, int size, int numValues, bool nullsPadding,
+                                    PixelsBitMask * filterMask) {
+    T *& vectorValues = values(*columnVector, (T *) nullptr);
+    T * chunkValues = (T *)(input->getPointer() + input->getReadPos());
+    bool dense = !HAS_NULLS || nullsPadding;
+    if(dense && (vectorIndex == 0 || vectorValues + vectorIndex == chunkValues)) {
+        // the previous parts of the vector are followed by these values in the chunk buffer
+        vectorValues = chunkValues - vectorIndex;
+        columnVector->pin(input);
+    } else {
+        // the values can not be referenced in the chunk buffer
+        useDecodedBuffer(vectorValues, decoded(*columnVector, (T *) nullptr), vectorIndex);
+        if(dense) {
+            std::memcpy(vectorValues + vectorIndex, chunkValues, numValues * sizeof(T));
         } else {
-            // if int
-            std::memcpy((void*)columnVector->intVector + vectorIndex * sizeof(int), input->getPointer() + input->getReadPos(), size * sizeof(int));
-			input->setReadPos(input->getReadPos() + size * sizeof(int));
+            gatherNonNulls<T, T, FILTERED>(chunkValues, vectorValues + vectorIndex, size,
+                                           columnVector, vectorIndex, filterMask);
         }
     }
+    input->setReadPos(input->getReadPos() + numValues * sizeof(T));
+}
+
+template <typename T, bool HAS_NULLS, bool FILTERED>
+void IntegerColumnReader::readRle(const std::shared_ptr<ByteBuffer> & input,
+                                  const std::shared_ptr<LongColumnVector> & columnVector,
+                                  int vectorIndex, int size, int numValues, bool nullsPadding,
+                                  PixelsBitMask * filterMask) {
+    T *& vectorValues = values(*columnVector, (T *) nullptr);
+    useDecodedBuffer(vectorValues, decoded(*columnVector, (T *) nullptr), vectorIndex);
+    bool dense = !HAS_NULLS || nullsPadding;
+    if constexpr(std::is_same<T, long>::value) {
+        if(dense) {
+            decoder->next(vectorValues + vectorIndex, 0, numValues);
+            return;
+        }
+    }
+    if((int) decodeBuffer.size() < numValues) {
+        decodeBuffer.resize(numValues);
+    }
+    decoder->next(decodeBuffer.data(), 0, numValues);
+    if(dense) {
+        T * target = vectorValues + vectorIndex;
+        for(int i = 0; i < numValues; i++) {
+            target[i] = (T) decodeBuffer[i];
+        }
+    } else {
+        gatherNonNulls<T, long, FILTERED>(decodeBuffer.data(), vectorValues + vectorIndex, size,
+                                          columnVector, vectorIndex, filterMask);
+    }
 }
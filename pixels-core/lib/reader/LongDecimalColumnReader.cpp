@@ -0,0 +1,101 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "reader/LongDecimalColumnReader.h"
+#include "vector/LongDecimalColumnVector.h"
+#include <cstring>
+
+LongDecimalColumnReader::LongDecimalColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+
+}
+
+void LongDecimalColumnReader::close() {
+
+}
+
+bool LongDecimalColumnReader::isNarrowPixel(const pixels::proto::ColumnStatistic & statistic) {
+	if(!statistic.has_int128statistics() || !statistic.int128statistics().has_minimum_high()) {
+		// the pixel has no non-null values
+		return true;
+	}
+	const auto & int128Stat = statistic.int128statistics();
+	// a 128-bit integer fits in 64 bits if its upper word is the sign extension of its lower word
+	return (int64_t) int128Stat.minimum_high() == ((int64_t) int128Stat.minimum_low() >> 63) &&
+	       int128Stat.maximum_high() == (int128Stat.maximum_low() >> 63);
+}
+
+void LongDecimalColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                                   int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                                   pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+	std::shared_ptr<LongDecimalColumnVector> columnVector =
+	    std::static_pointer_cast<LongDecimalColumnVector>(vector);
+	if(type->getPrecision() != columnVector->getPrecision() || type->getScale() != columnVector->getScale()) {
+		throw InvalidArgumentException("reader of decimal(" + std::to_string(type->getPrecision())
+		                               + "," + std::to_string(type->getScale()) + ") doesn't match the column "
+		                               "vector of decimal(" + std::to_string(columnVector->getPrecision()) + ","
+		                               + std::to_string(columnVector->getScale()) + ")");
+	}
+	// Make sure [offset, offset + size) is in the same pixels.
+	assert(offset / pixelStride == (offset + size - 1) / pixelStride);
+
+	if(offset == 0) {
+		elementIndex = 0;
+		isNullOffset = chunkIndex.isnulloffset();
+	}
+
+	int pixelId = elementIndex / pixelStride;
+	const pixels::proto::ColumnStatistic & pixelStat = chunkIndex.pixelstatistics(pixelId).statistic();
+	int numNulls = setValid(input, pixelStride, vector, pixelId, pixelStat.hasnull(), vectorIndex, size);
+	bool nullsPadding = chunkIndex.nullspadding();
+	// the number of values stored in the column chunk for [offset, offset + size)
+	int numValues = nullsPadding ? size : size - numNulls;
+	uint8_t * values = input->getPointer() + input->getReadPos();
+
+	if(isNarrowPixel(pixelStat)) {
+		// widen the 64-bit values into the lower and upper words
+		useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex, 2);
+		uint64_t * dst = columnVector->vector + 2 * vectorIndex;
+		for(int i = 0; i < numValues; i++) {
+			int64_t value;
+			std::memcpy(&value, values + i * sizeof(int64_t), sizeof(int64_t));
+			dst[2 * i] = (uint64_t) value;
+			dst[2 * i + 1] = (uint64_t) (value >> 63);
+		}
+		input->setReadPos(input->getReadPos() + numValues * sizeof(int64_t));
+	} else {
+		if((nullsPadding || numNulls == 0) &&
+		   (vectorIndex == 0 || (uint8_t *) (columnVector->vector + 2 * vectorIndex) == values)) {
+			// the previous parts of the vector are followed by these values in the chunk buffer
+			columnVector->vector = (uint64_t *) values - 2 * vectorIndex;
+			vector->pin(input);
+		} else {
+			// the values can not be referenced in the chunk buffer
+			useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex, 2);
+			std::memcpy(columnVector->vector + 2 * vectorIndex, values, numValues * 2 * sizeof(uint64_t));
+		}
+		input->setReadPos(input->getReadPos() + numValues * 2 * sizeof(uint64_t));
+	}
+	if(!nullsPadding && numNulls > 0 && numNulls < size) {
+		scatterNonNulls((__int128 *) (columnVector->vector + 2 * vectorIndex), numValues, size, vector, vectorIndex);
+	}
+	elementIndex += size;
+}
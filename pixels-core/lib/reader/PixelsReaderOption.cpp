@@ -14,6 +14,7 @@ PixelsReaderOption::PixelsReaderOption() {
     batchSize = 0;
     rgStart = 0;
     rgLen = -1;  // -1 means reading to the end of the file
+    vectorPredicate = nullptr;
 }
 
 void PixelsReaderOption::setIncludeCols(const std::vector<std::string> & columnNames) {
@@ -93,6 +94,14 @@ int PixelsReaderOption::getBatchSize() const {
     return batchSize;
 }
 
+void PixelsReaderOption::setVectorPredicate(std::shared_ptr<VectorPredicate> vectorPredicate) {
+    this->vectorPredicate = vectorPredicate;
+}
+
+std::shared_ptr<VectorPredicate> PixelsReaderOption::getVectorPredicate() {
+    return vectorPredicate;
+}
+
 
 
 
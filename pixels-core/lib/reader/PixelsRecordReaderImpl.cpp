@@ -5,6 +5,9 @@
 #include "reader/PixelsRecordReaderImpl.h"
 #include "physical/io/PhysicalLocalReader.h"
 #include "profiler/CountProfiler.h"
+#include "compression/CompressionCodecFactory.h"
+#include <future>
+#include <algorithm>
 
 PixelsRecordReaderImpl::PixelsRecordReaderImpl(std::shared_ptr<PhysicalReader> reader,
                                                const pixels::proto::PostScript& pixelsPostScript,
@@ -34,6 +37,13 @@ PixelsRecordReaderImpl::PixelsRecordReaderImpl(std::shared_ptr<PhysicalReader> r
         filter = nullptr;
     }
     filterMask = nullptr;
+    if(option.getVectorPredicate() != nullptr) {
+        // copy the predicate, as the top-k state is kept per record reader
+        vectorPredicate = std::make_shared<VectorPredicate>(*option.getVectorPredicate());
+    } else {
+        vectorPredicate = nullptr;
+    }
+    vectorPredicateColumn = -1;
     everRead = false;
 	everPrepareRead = false;
     targetRGNum = 0;
@@ -68,62 +78,141 @@ std::cout << "Entering function: PixelsRecordReaderImpl::checkBeforeRead" << std
     includedColumnNum = 0;
     auto optionIncludedCols = option.getIncludedCols();
     // TODO: if size of cols is 0, create an empty row batch
-    // TODO: what if false is caused? we must debug this! Currently I didn't understand why we need includedColumns yet. So just leave it alone.
+    // includedColumns is indexed by column chunk id, the chunks of a nested column and its descendants are included
     includedColumns.clear();
     includedColumns.resize(fileColTypes.size());
-    std::vector<int> optionColsIndices;
+    std::vector<std::shared_ptr<TypeDescription>> optionColsTypes;
+    std::vector<std::string> optionColsNames;
     for(const auto& col: optionIncludedCols) {
-        for(int j = 0; j < fileColTypes.size(); j ++) {
-            if(icompare(col, fileColTypes.at(j)->name())) {
-                optionColsIndices.emplace_back(j);
-                includedColumns.at(j) = true;
-                includedColumnNum++;
-                break;
-            }
+        std::string name;
+        auto type = findColumn(col, name);
+        if(type == nullptr) {
+            continue;
         }
-
+        for(int j = type->getId() - 1; j < type->getMaximumId(); j++) {
+            includedColumns.at(j) = true;
+        }
+        optionColsTypes.emplace_back(type);
+        optionColsNames.emplace_back(name);
+        includedColumnNum++;
     }
     // TODO: check includedColumns
     // create result columns storing result column ids in user specified order
     resultColumns.clear();
     resultColumns.resize(includedColumnNum);
+    resultColumnsEnd.clear();
+    resultColumnsEnd.resize(includedColumnNum);
     for(int i = 0; i < includedColumnNum; i++) {
-        resultColumns.at(i) = optionColsIndices[i];
+        resultColumns.at(i) = optionColsTypes[i]->getId() - 1;
+        resultColumnsEnd.at(i) = optionColsTypes[i]->getMaximumId();
     }
 
-
-    auto optionColsIndicesSet = std::set<int>(
-            optionColsIndices.begin(), optionColsIndices.end());
-    int targetColumnNum = (int)optionColsIndicesSet.size();
     targetColumns.clear();
-    targetColumns.resize(targetColumnNum);
-    int targetColIdx = 0;
     for(int i = 0; i < includedColumns.size(); i++) {
         if(includedColumns[i]) {
-            targetColumns.at(targetColIdx) = i;
-            targetColIdx++;
+            targetColumns.emplace_back(i);
         }
     }
 
     // create column readers
-    auto columnSchemas = fileSchema->getChildren();
     readers.clear();
     readers.resize(resultColumns.size());
     for(int i = 0; i < resultColumns.size(); i++) {
-        int index = resultColumns[i];
-        readers.at(i) = ColumnReaderBuilder::newColumnReader(columnSchemas.at(index));
+        readers.at(i) = ColumnReaderBuilder::newColumnReader(optionColsTypes.at(i));
+    }
+
+    if(vectorPredicate != nullptr) {
+        for(int i = 0; i < resultColumns.size(); i++) {
+            if(icompare(vectorPredicate->getColumnName(), optionColsNames.at(i))) {
+                vectorPredicateColumn = i;
+                break;
+            }
+        }
+        if(vectorPredicateColumn < 0 ||
+           optionColsTypes.at(vectorPredicateColumn)->getCategory() != TypeDescription::VECTOR) {
+            throw InvalidArgumentException("the column of the vector predicate is not an included vector column: " +
+                                           vectorPredicate->getColumnName());
+        }
     }
 
     // create result vectorized row batch
-    for(int resultColumn: resultColumns) {
-        includedColumnTypes.emplace_back(fileColTypes.at(resultColumn));
+    resultSchema = TypeDescription::createStruct();
+    for(int i = 0; i < includedColumnNum; i++) {
+        resultSchema->addField(optionColsNames.at(i), optionColsTypes.at(i)->clone());
     }
-    resultSchema = TypeDescription::createSchema(includedColumnTypes);
     std::cout << "Exiting function: PixelsRecordReaderImpl::checkBeforeRead" << std::endl;
 
 
 }
 
+/**
+ * Find the type of an included column in the file schema. The column is either a top-level column,
+ * or a field of a struct column given by its dotted path, such as s.x.
+ *
+ * @param column the name or path of the column, case insensitive
+ * @param name set to the name of the column in the result schema
+ * @return the type of the column, or nullptr if it is not found
+ */
+std::shared_ptr<TypeDescription> PixelsRecordReaderImpl::findColumn(const std::string& column, std::string& name) {
+    // match the whole name first, as a top-level column name may contain dots
+    auto fieldNames = fileSchema->getFieldNames();
+    for(int j = 0; j < fieldNames.size(); j++) {
+        if(icompare(column, fieldNames.at(j))) {
+            name = fieldNames.at(j);
+            return fileSchema->getChildren().at(j);
+        }
+    }
+    std::shared_ptr<TypeDescription> type = fileSchema;
+    size_t begin = 0;
+    while(true) {
+        if(type->getCategory() != TypeDescription::STRUCT) {
+            return nullptr;
+        }
+        size_t end = column.find('.', begin);
+        std::string part = column.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        std::shared_ptr<TypeDescription> field = nullptr;
+        fieldNames = type->getFieldNames();
+        for(int j = 0; j < fieldNames.size(); j++) {
+            if(icompare(part, fieldNames.at(j))) {
+                field = type->getChildren().at(j);
+                break;
+            }
+        }
+        if(field == nullptr) {
+            return nullptr;
+        }
+        type = field;
+        if(end == std::string::npos) {
+            name = column;
+            return type;
+        }
+        begin = end + 1;
+    }
+}
+
+/**
+ * Set the column chunks of the descendants of the nested result columns to their readers,
+ * it is called when the chunks of a new row group are read.
+ */
+void PixelsRecordReaderImpl::setNestedColumnChunks() {
+    const pixels::proto::RowGroupEncoding& rgEncoding = curRGFooter->rowgroupencoding();
+    const pixels::proto::RowGroupIndex& rowGroupIndex = curRGFooter->rowgroupindexentry();
+    for(int i = 0; i < resultColumns.size(); i++) {
+        if(resultColumnsEnd.at(i) - resultColumns.at(i) <= 1) {
+            continue;
+        }
+        std::vector<ChildColumnChunk> chunks;
+        for(int colId = resultColumns.at(i) + 1; colId < resultColumnsEnd.at(i); colId++) {
+            ChildColumnChunk chunk;
+            chunk.input = chunkBuffers.at(colId);
+            chunk.encoding = std::make_shared<pixels::proto::ColumnEncoding>(rgEncoding.columnchunkencodings(colId));
+            chunk.chunkIndex = std::make_shared<pixels::proto::ColumnChunkIndex>(
+                    rowGroupIndex.columnchunkindexentries(colId));
+            chunks.emplace_back(chunk);
+        }
+        readers.at(i)->setChildChunks(chunks, 0);
+    }
+}
 
 void PixelsRecordReaderImpl::UpdateRowGroupInfo() {
     std::cout << "Entering function: PixelsRecordReaderImpl::UpdateRowGroupInfo" << std::endl;
@@ -131,9 +220,12 @@ void PixelsRecordReaderImpl::UpdateRowGroupInfo() {
 	// if not end of file, update row count
 	curRGRowCount = (int) footer.rowgroupinfos(targetRGs.at(curRGIdx)).numberofrows();
 
-    if(enabledFilterPushDown) {
-        int length = std::min(batchSize, curRGRowCount);
-        filterMask = std::make_shared<PixelsBitMask>(length);
+    if((enabledFilterPushDown || vectorPredicate != nullptr) && filterMask == nullptr) {
+        // a batch may span several row groups, so the mask covers the whole batch
+        filterMask = std::make_shared<PixelsBitMask>(getBatchCapacity());
+        if(filter != nullptr) {
+            columnMask = std::make_shared<PixelsBitMask>(getBatchCapacity());
+        }
     }
 
 	curRGFooter = rowGroupFooters.at(curRGIdx);
@@ -160,10 +252,18 @@ void PixelsRecordReaderImpl::UpdateRowGroupInfo() {
 
 
 
-// If cross multiple row group, we only process one row group
-// In the current configuration, one batch is 10000 rows. This function creates
-// VectorizedRowBatch with some cols. Each column has 10000 elements. The columns
-// read value from chunkBuffer.
+int PixelsRecordReaderImpl::getBatchCapacity() {
+    // no larger than the number of rows to read, so that small files do not allocate full batches
+    long numRows = 0;
+    for(int i = 0; i < targetRGNum && numRows < batchSize; i++) {
+        numRows += footer.rowgroupinfos(targetRGs.at(i)).numberofrows();
+    }
+    return (int) std::max(1L, std::min((long) batchSize, numRows));
+}
+
+// A batch is filled from the consecutive row groups of the file, so all the batches except the
+// last one have batchSize rows, even if the row groups are small. This function creates
+// VectorizedRowBatch with some cols. The columns read value from chunkBuffer.
 std::shared_ptr<VectorizedRowBatch> PixelsRecordReaderImpl::readBatch(bool reuse) {
     std::cout << "Entering function: PixelsRecordReaderImpl::readBatch" << std::endl;
  
@@ -171,87 +271,99 @@ std::shared_ptr<VectorizedRowBatch> PixelsRecordReaderImpl::readBatch(bool reuse
 		endOfFile = true;
 		return createEmptyEOFRowBatch(0);
 	}
-	if(!everRead) {
-		if(!read()) {
-			throw std::runtime_error("failed to read file");
-		}
-	}
-
-
-	// TODO: resultRowBatch.projectionSize
-
-
-    // update current batch size
-    int curBatchSize = std::min(curRGRowCount - curRowInRG, std::min(batchSize, curRGRowCount));
+    if(!everPrepareRead) {
+        // the target row groups are needed to decide the batch capacity
+        prepareRead();
+        if(endOfFile) {
+            // all the row groups are skipped
+            return createEmptyEOFRowBatch(0);
+        }
+    }
     if(resultRowBatch == nullptr) {
-        resultRowBatch = resultSchema->createRowBatch(curBatchSize, resultColumnsEncoded);
+        resultRowBatch = resultSchema->createRowBatch(getBatchCapacity(), resultColumnsEncoded);
     } else {
+        // release the chunk buffers pinned by the previous batch before the next chunks are read
         resultRowBatch->reset();
-        if(curBatchSize != resultRowBatch->maxSize) {
-            resultRowBatch->resize(curBatchSize);
-        }
     }
+    int capacity = resultRowBatch->maxSize;
 
     auto columnVectors = resultRowBatch->cols;
     if(filterMask != nullptr) {
         filterMask->set();
     }
 
-    std::vector<int> filterColumnIndex;
-    if(has_async_task_num_ > 0) {
-      asyncReadComplete(has_async_task_num_);
-    }
-    if(filter != nullptr) {
-        std::cout<<"filter != nullptr and readers read"<<std::endl;
-        for (auto &filterCol : filter->filters) {
-            if(filterMask->isNone()) {
-                break;
+    // fill the batch from the consecutive row groups, so that only the last batch of the file is short
+    while(resultRowBatch->rowCount < capacity && !endOfFile) {
+        if(!everRead) {
+            if(!read()) {
+                throw std::runtime_error("failed to read file");
             }
-            int i = filterCol.first;
-            int index = curChunkBufferIndex.at(i);
-            auto & encoding = curEncoding.at(i);
-            auto & chunkIndex = curChunkIndex.at(i);
-            readers.at(i)->read(chunkBuffers.at(index), *encoding, curRowInRG, curBatchSize,
-                                postScript.pixelstride(), resultRowBatch->rowCount,
-                                columnVectors.at(i), *chunkIndex, filterMask);
-            filterColumnIndex.emplace_back(index);
-            PixelsFilter::ApplyFilter(columnVectors.at(i), *filterCol.second, *filterMask,
-                                      resultSchema->getChildren().at(i));
         }
-    }
-
-    // read vectors
-    for(int i = 0; i < resultColumns.size(); i++) {
-
-        int index = curChunkBufferIndex.at(i);
-        if(std::find(filterColumnIndex.begin(), filterColumnIndex.end(), index) != filterColumnIndex.end()) {
-            continue;
+        if(has_async_task_num_ > 0) {
+            asyncReadComplete(has_async_task_num_);
+        }
+        if(pendingDecompression) {
+            decompressChunks();
         }
-        auto & encoding = curEncoding.at(i);
-        auto & chunkIndex = curChunkIndex.at(i);
-        std::cout<<"read vector and reader read"<<std::endl;
-        readers.at(i)->read(chunkBuffers.at(index), *encoding, curRowInRG, curBatchSize,
-                            postScript.pixelstride(), resultRowBatch->rowCount,
-                            columnVectors.at(i), *chunkIndex, filterMask);
+        if(curRowInRG == 0) {
+            setNestedColumnChunks();
+        }
+        // the rows of the current row group in this batch
+        int curBatchSize = std::min(curRGRowCount - curRowInRG, capacity - (int) resultRowBatch->rowCount);
 
-                            
-    }
+        int sliceStart = resultRowBatch->rowCount;
+        auto readColumn = [&](int i, const std::shared_ptr<PixelsBitMask> & mask) {
+            int index = curChunkBufferIndex.at(i);
+            readers.at(i)->readRange(chunkBuffers.at(index), *curEncoding.at(i), curRowInRG, curBatchSize,
+                                     postScript.pixelstride(), sliceStart, columnVectors.at(i),
+                                     *curChunkIndex.at(i), mask);
+        };
+        // the filtered columns are read and filtered first, so that the other columns are read
+        // with the filter mask of this slice and skip the rows filtered out
+        std::vector<bool> columnRead(resultColumns.size(), false);
+        if(filter != nullptr) {
+            for (auto &filterCol : filter->filters) {
+                int i = filterCol.first;
+                readColumn(i, nullptr);
+                columnRead.at(i) = true;
+                columnMask->set();
+                PixelsFilter::ApplyFilter(columnVectors.at(i), *filterCol.second, *columnMask,
+                                          resultSchema->getChildren().at(i), sliceStart, curBatchSize);
+                filterMask->And(*columnMask);
+            }
+        }
+        if(vectorPredicate != nullptr) {
+            if(!columnRead.at(vectorPredicateColumn)) {
+                readColumn(vectorPredicateColumn, nullptr);
+                columnRead.at(vectorPredicateColumn) = true;
+            }
+            vectorPredicate->apply(std::static_pointer_cast<VectorColumnVector>(columnVectors.at(vectorPredicateColumn)),
+                                   sliceStart, curBatchSize, *filterMask);
+        }
+        bool filtered = filter != nullptr || vectorPredicate != nullptr;
+        for(int i = 0; i < resultColumns.size(); i++) {
+            if(!columnRead.at(i)) {
+                readColumn(i, filtered ? filterMask : nullptr);
+            }
+        }
 
-    // update current row index in the row group
-    curRowInRG += curBatchSize;
-    resultRowBatch->rowCount += curBatchSize;
-    // update row group index if current row index exceeds max row count in the row group
-    if(curRowInRG >= curRGRowCount) {
-        curRGIdx++;
-        if(curRGIdx < targetRGNum) {
-            UpdateRowGroupInfo();
-        } else {
-            // if end of file, set result vectorized row batch endOfFile
-            // TODO: set checkValid to false!
-            endOfFile = true;
+        // update current row index in the row group
+        curRowInRG += curBatchSize;
+        resultRowBatch->rowCount += curBatchSize;
+        // update row group index if current row index exceeds max row count in the row group
+        if(curRowInRG >= curRGRowCount) {
+            curRGIdx++;
+            if(curRGIdx < targetRGNum) {
+                UpdateRowGroupInfo();
+            } else {
+                // if end of file, set result vectorized row batch endOfFile
+                // TODO: set checkValid to false!
+                endOfFile = true;
+            }
+            curRowInRG = 0;
         }
-        curRowInRG = 0;
     }
+
     std::cout << "Exiting function: PixelsRecordReaderImpl::readBatch" << std::endl;
 
 	return resultRowBatch;
@@ -266,10 +378,13 @@ void PixelsRecordReaderImpl::prepareRead() {
     includedRGs.resize(RGLen);
 
     uint64_t includedRowNum = 0;
-    // read row group statistics and find target row groups
+    // read row group statistics and find target row groups,
+    // the row groups of the hash partitions that no row matching the filter is in are skipped
     for(int i = 0; i < RGLen; i++) {
-        includedRGs.at(i) = true;
-        includedRowNum += footer.rowgroupinfos(RGStart + i).numberofrows();
+        includedRGs.at(i) = rowGroupInPartition(footer.rowgroupinfos(RGStart + i));
+        if(includedRGs.at(i)) {
+            includedRowNum += footer.rowgroupinfos(RGStart + i).numberofrows();
+        }
     }
     targetRGs.clear();
     targetRGs.resize(RGLen);
@@ -334,12 +449,31 @@ void PixelsRecordReaderImpl::prepareRead() {
     }
 
     bbs.clear();
+
+    // skip the row groups ruled out by the Bloom filters, before any column chunk of them is read
+    if(filter != nullptr) {
+        int keptRGNum = 0;
+        for(int i = 0; i < targetRGNum; i++) {
+            if(rowGroupMightMatch(*rowGroupFooters.at(i))) {
+                targetRGs.at(keptRGNum) = targetRGs.at(i);
+                rowGroupFooters.at(keptRGNum) = rowGroupFooters.at(i);
+                keptRGNum++;
+            }
+        }
+        targetRGNum = keptRGNum;
+        rowGroupFooters.resize(targetRGNum);
+    }
+
     resultColumnsEncoded.clear();
     resultColumnsEncoded.resize(includedColumnNum);
 
 	curEncoding.resize(resultColumns.size());
 	curChunkBufferIndex.resize(resultColumns.size());
 	curChunkIndex.resize(resultColumns.size());
+	if(targetRGNum == 0) {
+		endOfFile = true;
+		return;
+	}
 	UpdateRowGroupInfo();
     std::cout << "Exiting function: PixelsRecordReaderImpl::prepareRead" << std::endl;
 
@@ -363,6 +497,93 @@ void PixelsRecordReaderImpl::asyncReadComplete(int requestSize) {
 }
 
 
+/**
+ * Decompress the compressed chunks of the current row group into the pooled decompression
+ * buffers. This runs inline on the scan thread: DuckDB already runs one scan thread per core,
+ * so extra decode threads would only oversubscribe them. Uncompressed chunks are left untouched.
+ */
+void PixelsRecordReaderImpl::decompressChunks() {
+    const pixels::proto::RowGroupIndex& rowGroupIndex =
+            rowGroupFooters[curRGIdx]->rowgroupindexentry();
+    for(int colId: targetColumns) {
+        const pixels::proto::ColumnChunkIndex& chunkIndex =
+                rowGroupIndex.columnchunkindexentries(colId);
+        if (chunkIndex.compression() == pixels::proto::NONE) {
+            continue;
+        }
+        auto codec = CompressionCodecFactory::Instance()->getCodec(chunkIndex.compression());
+        auto compressed = chunkBuffers.at(colId);
+        uint32_t uncompressedLength = chunkIndex.uncompressedlength();
+        auto pooled = ::BufferPool::GetDecompressBuffer(colId, uncompressedLength);
+        auto decompressed = std::make_shared<ByteBuffer>(*pooled, 0, uncompressedLength);
+        codec->decompressBlocks(compressed->getPointer(), chunkIndex.chunklength(),
+                                decompressed->getPointer(), uncompressedLength);
+        chunkBuffers.at(colId) = decompressed;
+    }
+    pendingDecompression = false;
+}
+
+bool PixelsRecordReaderImpl::rowGroupMightMatch(const pixels::proto::RowGroupFooter& rowGroupFooter) {
+    const pixels::proto::RowGroupIndex& rowGroupIndex = rowGroupFooter.rowgroupindexentry();
+    for(auto &filterCol : filter->filters) {
+        int i = filterCol.first;
+        const pixels::proto::ColumnChunkIndex& chunkIndex =
+                rowGroupIndex.columnchunkindexentries(resultColumns.at(i));
+        if(!chunkIndex.has_bloomfilter()) {
+            continue;
+        }
+        if(!PixelsFilter::BloomFilterMightMatch(*filterCol.second, chunkIndex.bloomfilter(),
+                                                resultSchema->getChildren().at(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PixelsRecordReaderImpl::rowGroupInPartition(const pixels::proto::RowGroupInformation& rowGroupInfo) {
+    if(filter == nullptr || !rowGroupInfo.has_partitioninfo()) {
+        return true;
+    }
+    const pixels::proto::PartitionInformation& partitionInfo = rowGroupInfo.partitioninfo();
+    int numPartitions = partitionInfo.numpartitions();
+    if(numPartitions <= 0 || partitionInfo.columnids_size() == 0) {
+        return true;
+    }
+    // the row hashes of all the combinations of the constants that the partition keys are compared with,
+    // in the same way as the Partitioner hashes the rows
+    std::vector<uint64_t> rowHashes{Partitioner::INITIAL_HASH};
+    for(uint32_t columnId : partitionInfo.columnids()) {
+        // the column ids in the partition information are the type ids, and the root type is not stored
+        auto column = std::find(resultColumns.begin(), resultColumns.end(), columnId - 1);
+        if(column == resultColumns.end()) {
+            return true;
+        }
+        int i = column - resultColumns.begin();
+        auto filterCol = filter->filters.find(i);
+        if(filterCol == filter->filters.end()) {
+            return true;
+        }
+        std::vector<uint64_t> keyHashes;
+        if(!PixelsFilter::EqualityConstantHashes(*filterCol->second, resultSchema->getChildren().at(i), keyHashes) ||
+           rowHashes.size() * keyHashes.size() > MAX_PARTITION_KEY_COMBINATIONS) {
+            return true;
+        }
+        std::vector<uint64_t> combinedHashes;
+        for(uint64_t rowHash : rowHashes) {
+            for(uint64_t keyHash : keyHashes) {
+                combinedHashes.push_back(Partitioner::combineHash(rowHash, keyHash));
+            }
+        }
+        rowHashes.swap(combinedHashes);
+    }
+    for(uint64_t rowHash : rowHashes) {
+        if(Partitioner::getHashValue(rowHash, numPartitions) == partitionInfo.hashvalue()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::shared_ptr<PixelsBitMask> PixelsRecordReaderImpl::getFilterMask() {
     return filterMask;
 }
@@ -394,6 +615,13 @@ bool PixelsRecordReaderImpl::read() {
 				rowGroupIndex.columnchunkindexentries(colId);
         if (!chunkIndex.littleendian()) {
             throw InvalidArgumentException("Pixels C++ reader only supports little endianness. ");
+        }
+        if (chunkIndex.compression() != pixels::proto::NONE) {
+            pendingDecompression = true;
+        }
+        if (chunkIndex.chunklength() == 0) {
+            // e.g., the chunk of a struct column without nulls, its buffer is left null
+            continue;
         }
 		ChunkId chunk(curRGIdx, colId, chunkIndex.chunkoffset(), chunkIndex.chunklength());
 		diskChunks.emplace_back(chunk);
@@ -411,7 +639,11 @@ bool PixelsRecordReaderImpl::read() {
 			colIds.emplace_back(chunk.columnId);
 			bytes.emplace_back(chunk.length);
         }
-		::BufferPool::Initialize(colIds, bytes, fileSchema->getFieldNames());
+		std::vector<std::string> columnNames;
+		for(const auto& type : footer.types()) {
+			columnNames.emplace_back(type.name());
+		}
+		::BufferPool::Initialize(colIds, bytes, columnNames);
         ::DirectUringRandomAccessFile::RegisterBufferFromPool(colIds);
 		std::vector<std::shared_ptr<ByteBuffer>> originalByteBuffers;
 		for(int i = 0; i < colIds.size(); i++) {
@@ -444,7 +676,9 @@ bool PixelsRecordReaderImpl::read() {
         std::cout<<"chunkBuffers"<<std::endl;
         for(auto it:chunkBuffers)
 	    {
-		    it->printHex();
+		    if(it != nullptr) {
+			    it->printHex();
+		    }
 	    }  
     }
     std::cout << "Exiting function: PixelsRecordReaderImpl::read" << std::endl;
@@ -488,7 +722,6 @@ void PixelsRecordReaderImpl::close() {
     }
 	readers.clear();
 	rowGroupFooters.clear();
-	includedColumnTypes.clear();
 	endOfFile = true;
 }
 
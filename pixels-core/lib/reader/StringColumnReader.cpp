@@ -4,6 +4,7 @@
 
 #include "reader/StringColumnReader.h"
 #include "profiler/CountProfiler.h"
+#include <algorithm>
 
 StringColumnReader::StringColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
     bufferOffset = 0;
@@ -18,16 +19,26 @@ StringColumnReader::StringColumnReader(std::shared_ptr<TypeDescription> type) :
     dictStartsOffset = 0;
     dictStarts = nullptr;
     startsLength = 0;
+    fsstDecoder = nullptr;
+    decodeBlockUsed = 0;
 }
 
 void StringColumnReader::close() {
+    decodeBlocks.clear();
+    decodeBlockUsed = 0;
+}
 
+uint8_t * StringColumnReader::reserveDecodeBuffer(int length) {
+    if (decodeBlocks.empty() || (int) decodeBlocks.back().size() - decodeBlockUsed < length) {
+        decodeBlocks.emplace_back(std::max((int) DECODE_BLOCK_SIZE, length));
+        decodeBlockUsed = 0;
+    }
+    return decodeBlocks.back().data() + decodeBlockUsed;
 }
 
 void StringColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
                               int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
                               pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
-    // TODO: support dictionary
     std::cout << "enter function: StringColumnReader::read with vector index ==" <<vectorIndex<< std::endl;
     std::shared_ptr<BinaryColumnVector> columnVector =
             std::static_pointer_cast<BinaryColumnVector>(vector);
@@ -37,82 +48,137 @@ void StringColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::
         bufferOffset = 0;
         isNullOffset = chunkIndex.isnulloffset();
         readContent(input, input->bytesRemaining(), encoding);
+        selectKernels(encoding);
     }
     int origin = bufferOffset;
     int pixelId = elementIndex / pixelStride;
     bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
-    setValid(input, pixelStride, vector, pixelId, hasNull);
+    int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+    if (numNulls == size && !chunkIndex.nullspadding()) {
+        // all null: nothing of this pixel is stored in the content
+        elementIndex += size;
+        return;
+    }
+    if (encoding.kind() != pixels::proto::ColumnEncoding_Kind_FSST) {
+        // the strings are referenced in the chunk buffer
+        vector->pin(input);
+    }
+    Kernel kernel = kernels[kernelIndex(numNulls > 0, filterMask != nullptr)];
+    (this->*kernel)(columnVector, vectorIndex, size, chunkIndex.nullspadding(), filterMask.get());
+    elementIndex += size;
+    input->setReadPos(input->getReadPos() + (bufferOffset-origin));
+    std::cout << "exit function: StringColumnReader::read" << std::endl;
+}
 
-    // TODO: if dictionary encoded
+void StringColumnReader::selectKernels(pixels::proto::ColumnEncoding & encoding) {
     if (encoding.kind() == pixels::proto::ColumnEncoding_Kind_DICTIONARY) {
-        bool cascadeRLE = false;
-        if (encoding.has_cascadeencoding() && encoding.cascadeencoding().kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
-            cascadeRLE = true;
+        if (contentDecoder != nullptr) {
+            selectDictionaryKernels<true>();
+        } else {
+            selectDictionaryKernels<false>();
         }
+    } else if (encoding.kind() == pixels::proto::ColumnEncoding_Kind_FSST) {
+        // decoding dominates the cost of FSST, so the kernel is not specialized
+        std::fill(kernels, kernels + 4, &StringColumnReader::readFsst);
+    } else {
+        kernels[kernelIndex(false, false)] = &StringColumnReader::readPlain<false, false>;
+        kernels[kernelIndex(false, true)] = &StringColumnReader::readPlain<false, true>;
+        kernels[kernelIndex(true, false)] = &StringColumnReader::readPlain<true, false>;
+        kernels[kernelIndex(true, true)] = &StringColumnReader::readPlain<true, true>;
+    }
+}
 
-        for(int i = 0; i < size; i++) {
-            bool valid = vector->checkValid(i);
-            if(elementIndex % pixelStride == 0) {
-                int pixelId = elementIndex / pixelStride;
-                // TODO: should write the remaining code
+template <bool CASCADE_RLE>
+void StringColumnReader::selectDictionaryKernels() {
+    kernels[kernelIndex(false, false)] = &StringColumnReader::readDictionary<CASCADE_RLE, false, false>;
+    kernels[kernelIndex(false, true)] = &StringColumnReader::readDictionary<CASCADE_RLE, false, true>;
+    kernels[kernelIndex(true, false)] = &StringColumnReader::readDictionary<CASCADE_RLE, true, false>;
+    kernels[kernelIndex(true, true)] = &StringColumnReader::readDictionary<CASCADE_RLE, true, true>;
+}
+
+template <bool HAS_NULLS, bool FILTERED>
+void StringColumnReader::readPlain(const std::shared_ptr<BinaryColumnVector> & columnVector, int vectorIndex,
+                                   int size, bool nullsPadding, PixelsBitMask * filterMask) {
+    uint8_t * content = contentBuf->getPointer();
+    const uint8_t * starts = startsBuf->getPointer() + startsBuf->getReadPos();
+    int numStarts = 0;
+    for(int i = 0; i < size; i++) {
+        if(HAS_NULLS && !columnVector->checkValid(i + vectorIndex)) {
+            // is null: the starts array only has an entry for padded nulls
+            if (nullsPadding) {
+                currentStart = nextStart;
+                nextStart = readInt(starts, numStarts++);
             }
-            if(vector->checkValid(i) && (filterMask == nullptr || filterMask->get(i))) {
-                int originId = cascadeRLE ? (int) contentDecoder->next() : contentBuf->getInt();
-                int tmpLen = dictStarts[originId + 1] - dictStarts[originId];
-                // use setRef instead of setVal to reduce memory copy.
-                columnVector->setRef(i + vectorIndex, dictContentBuf->getPointer(), dictStarts[originId], tmpLen);
-            } else if (!valid && (!cascadeRLE) && chunkIndex.nullspadding()) {
-                // is null: skip this number
-                contentBuf->getInt();
-            } else {
-                // filter out: skip this number
-                if (!cascadeRLE) {
-                    contentBuf->getInt();
-                } else {
+            continue;
+        }
+        currentStart = nextStart;
+        nextStart = readInt(starts, numStarts++);
+        int len = nextStart - currentStart;
+        if(!FILTERED || filterMask->get(i + vectorIndex)) {
+            // use setRef instead of setVal to reduce memory copy
+            columnVector->setRef(i + vectorIndex, content, bufferOffset, len);
+        }
+        bufferOffset += len;
+    }
+    startsBuf->setReadPos(startsBuf->getReadPos() + numStarts * sizeof(int));
+}
+
+template <bool CASCADE_RLE, bool HAS_NULLS, bool FILTERED>
+void StringColumnReader::readDictionary(const std::shared_ptr<BinaryColumnVector> & columnVector, int vectorIndex,
+                                        int size, bool nullsPadding, PixelsBitMask * filterMask) {
+    uint8_t * dictContent = dictContentBuf->getPointer();
+    const uint8_t * ids = contentBuf->getPointer() + contentBuf->getReadPos();
+    int numIds = 0;
+    for(int i = 0; i < size; i++) {
+        if(HAS_NULLS && !columnVector->checkValid(i + vectorIndex)) {
+            // padded nulls have an id to skip, unpadded nulls have no id
+            if (nullsPadding) {
+                if (CASCADE_RLE) {
                     contentDecoder->next();
+                } else {
+                    numIds++;
                 }
             }
-            elementIndex++;
+            continue;
         }
-    } else {
-        for(int i = 0; i < size; i++) {
-            if(elementIndex % pixelStride == 0) {
-                int pixelId = elementIndex / pixelStride;
-                // TODO: should write the remaining code
-            }
-            bool valid = vector->checkValid(i);
-            if(valid && (filterMask == nullptr || filterMask->get(i))) {
-                currentStart = nextStart;
-                nextStart = startsBuf->getInt();
-                int len = nextStart - currentStart;
-                // use setRef instead of setVal to reduce memory copy
-                columnVector->setRef(
-                        i + vectorIndex, contentBuf->getPointer(), bufferOffset, len);
-                bufferOffset += len;
-            } else if (!valid) {
-                // is null: skip this number
-                currentStart = nextStart;
-                nextStart = startsBuf->getInt();
-            } else {
-                // filter out: skip this number
-                currentStart = nextStart;
-                nextStart = startsBuf->getInt();
-                int len = nextStart - currentStart;
-                bufferOffset += len;
-            }
-            elementIndex++;
+        int originId = CASCADE_RLE ? (int) contentDecoder->next() : readInt(ids, numIds++);
+        if(!FILTERED || filterMask->get(i + vectorIndex)) {
+            // use setRef instead of setVal to reduce memory copy.
+            columnVector->setRef(i + vectorIndex, dictContent, dictStarts[originId],
+                                 dictStarts[originId + 1] - dictStarts[originId]);
         }
     }
-    std::cout<<"strings of columnVector in StringColumnReader::read"<<std::endl;
-    for(int i=0;i<size;i++)
-    {
-        std::cout<<"i="<<i<<std::endl;
-        std::cout<<columnVector->vector[i].GetString()<<std::endl;
+    if (!CASCADE_RLE) {
+        contentBuf->setReadPos(contentBuf->getReadPos() + numIds * sizeof(int));
     }
+}
 
-    input->setReadPos(input->getReadPos() + (bufferOffset-origin));
-    // TODO: support dictionary
-    std::cout << "exit function: StringColumnReader::read" << std::endl;
+void StringColumnReader::readFsst(const std::shared_ptr<BinaryColumnVector> & columnVector, int vectorIndex,
+                                  int size, bool nullsPadding, PixelsBitMask * filterMask) {
+    if (vectorIndex == 0 && !decodeBlocks.empty()) {
+        // the previous row batch is consumed, recycle the largest block
+        std::vector<uint8_t> last = std::move(decodeBlocks.back());
+        decodeBlocks.clear();
+        decodeBlocks.emplace_back(std::move(last));
+        decodeBlockUsed = 0;
+    }
+    for(int i = 0; i < size; i++) {
+        bool valid = columnVector->checkValid(i + vectorIndex);
+        if(valid && (filterMask == nullptr || filterMask->get(i + vectorIndex))) {
+            // only the selected strings are decoded
+            currentStart = nextStart;
+            nextStart = startsBuf->getInt();
+            int len = nextStart - currentStart;
+            uint8_t * decoded = reserveDecodeBuffer(FsstDecoder::maxDecodedLength(len));
+            int decodedLen = fsstDecoder->decode(contentBuf->getPointer() + currentStart, len, decoded);
+            decodeBlockUsed += decodedLen;
+            columnVector->setRef(i + vectorIndex, decoded, 0, decodedLen);
+        } else if (valid || nullsPadding) {
+            // filter out: skip this string without decoding it
+            currentStart = nextStart;
+            nextStart = startsBuf->getInt();
+        }
+    }
 }
 
 void StringColumnReader::readContent(std::shared_ptr<ByteBuffer> input,
@@ -121,6 +187,10 @@ void StringColumnReader::readContent(std::shared_ptr<ByteBuffer> input,
                     
     std::cout << "enter function: StringColumnReader::readContent" << std::endl;
     if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_DICTIONARY) {
+        if(dictStarts != nullptr) {
+            delete[] dictStarts;
+            dictStarts = nullptr;
+        }
         input->markReaderIndex();
         input->skipBytes(inputLength - 2 * sizeof(int));
         dictContentOffset = input->getInt();
@@ -166,6 +236,18 @@ void StringColumnReader::readContent(std::shared_ptr<ByteBuffer> input,
             }
             contentDecoder = nullptr;
         }
+    } else if (encoding.kind() == pixels::proto::ColumnEncoding_Kind_FSST) {
+        input->markReaderIndex();
+        input->skipBytes(inputLength - 2 * sizeof(int));
+        int symbolTableOffset = input->getInt();
+        int startsOffset = input->getInt();
+        input->resetReaderIndex();
+        contentBuf = std::make_shared<ByteBuffer>(*input, 0, symbolTableOffset);
+        fsstDecoder = std::make_shared<FsstDecoder>(
+                input->getPointer() + symbolTableOffset, startsOffset - symbolTableOffset);
+        startsBuf = std::make_shared<ByteBuffer>(
+                *input, startsOffset, inputLength - 2 * sizeof(int) - startsOffset);
+        nextStart = startsBuf->getInt(); // read out the first start offset, which is 0
     } else {
         input->markReaderIndex();
         input->skipBytes(inputLength - sizeof(int));
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "reader/StructColumnReader.h"
+#include "reader/ColumnReaderBuilder.h"
+
+StructColumnReader::StructColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+    for(const auto& child : type->getChildren()) {
+        fieldReaders.emplace_back(ColumnReaderBuilder::newColumnReader(child));
+    }
+    fieldChunks.resize(fieldReaders.size());
+}
+
+void StructColumnReader::close() {
+    for(const auto& fieldReader : fieldReaders) {
+        fieldReader->close();
+    }
+}
+
+void StructColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                              int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                              pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+    readRange(input, encoding, offset, size, pixelStride, vectorIndex, vector, chunkIndex, filterMask);
+}
+
+void StructColumnReader::readRange(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                                   int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                                   pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+    std::shared_ptr<StructColumnVector> columnVector =
+            std::static_pointer_cast<StructColumnVector>(vector);
+    if(offset == 0) {
+        elementIndex = 0;
+        isNullOffset = chunkIndex.isnulloffset();
+    }
+    for(int i = 0; i < size;) {
+        int partSize = std::min(size - i, pixelStride - elementIndex % pixelStride);
+        int pixelId = elementIndex / pixelStride;
+        bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+        setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex + i, partSize);
+        elementIndex += partSize;
+        i += partSize;
+    }
+    // the fields have the same rows as the struct
+    for(int i = 0; i < fieldReaders.size(); i++) {
+        ChildColumnChunk & fieldChunk = fieldChunks.at(i);
+        fieldReaders.at(i)->readRange(fieldChunk.input, *fieldChunk.encoding, offset, size, pixelStride,
+                                      vectorIndex, columnVector->fields.at(i), *fieldChunk.chunkIndex, filterMask);
+    }
+}
+
+int StructColumnReader::setChildChunks(const std::vector<ChildColumnChunk> & chunks, int start) {
+    for(int i = 0; i < fieldReaders.size(); i++) {
+        fieldChunks.at(i) = chunks.at(start++);
+        start = fieldReaders.at(i)->setChildChunks(chunks, start);
+    }
+    return start;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "reader/TimeColumnReader.h"
+#include "vector/TimeColumnVector.h"
+
+TimeColumnReader::TimeColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+
+}
+
+void TimeColumnReader::close() {
+
+}
+
+void TimeColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                            int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                            pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+	std::shared_ptr<TimeColumnVector> columnVector =
+	    std::static_pointer_cast<TimeColumnVector>(vector);
+	if(offset == 0) {
+		decoder = std::make_shared<RunLenIntDecoder>(input, true);
+		elementIndex = 0;
+		isNullOffset = chunkIndex.isnulloffset();
+	}
+
+	int pixelId = elementIndex / pixelStride;
+	bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+	int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+	bool nullsPadding = chunkIndex.nullspadding();
+	// the number of values stored in the column chunk for [offset, offset + size)
+	int numValues = nullsPadding ? size : size - numNulls;
+
+	if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+		useDecodedBuffer(columnVector->times, columnVector->decodedTimes, vectorIndex);
+		if(numNulls == size) {
+			// all null: skip the padded values without decoding them into the vector
+			for(int i = 0; i < numValues; i++) {
+				decoder->next();
+			}
+		} else {
+			for(int i = 0; i < numValues; i++) {
+				columnVector->set(i + vectorIndex, (int) decoder->next());
+			}
+		}
+	} else {
+		int * values = (int *)(input->getPointer() + input->getReadPos());
+		if((nullsPadding || numNulls == 0) && (vectorIndex == 0 || columnVector->times + vectorIndex == values)) {
+			// the previous parts of the vector are followed by these values in the chunk buffer
+			columnVector->times = values - vectorIndex;
+			vector->pin(input);
+		} else {
+			// the values can not be referenced in the chunk buffer
+			useDecodedBuffer(columnVector->times, columnVector->decodedTimes, vectorIndex);
+			std::memcpy(columnVector->times + vectorIndex, values,
+			            numValues * sizeof(int));
+		}
+		input->setReadPos(input->getReadPos() + numValues * sizeof(int));
+	}
+	if(!nullsPadding && numNulls > 0 && numNulls < size) {
+		scatterNonNulls(columnVector->times + vectorIndex, numValues, size, vector, vectorIndex);
+	}
+	elementIndex += size;
+}
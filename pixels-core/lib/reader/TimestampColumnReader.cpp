@@ -27,18 +27,39 @@ void TimestampColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::prot
 
     int pixelId = elementIndex / pixelStride;
     bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
-    setValid(input, pixelStride, vector, pixelId, hasNull);
+    int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+    bool nullsPadding = chunkIndex.nullspadding();
+    // the number of values stored in the column chunk for [offset, offset + size)
+    int numValues = nullsPadding ? size : size - numNulls;
 
-    if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
-        for (int i = 0; i < size; i++) {
-            if (elementIndex % pixelStride == 0) {
-                int pixelId = elementIndex / pixelStride;
+	if(encoding.kind() == pixels::proto::ColumnEncoding_Kind_RUNLENGTH) {
+        useDecodedBuffer(columnVector->times, columnVector->decodedTimes, vectorIndex);
+        if(numNulls == size) {
+            // all null: skip the padded values without decoding them into the vector
+            for(int i = 0; i < numValues; i++) {
+                decoder->next();
             }
-            columnVector->set(i + vectorIndex, decoder->next());
-            elementIndex++;
+        } else {
+            for(int i = 0; i < numValues; i++) {
+                columnVector->set(i + vectorIndex, decoder->next());
+            }
+        }
+	} else {
+        long * values = (long *)(input->getPointer() + input->getReadPos());
+        if((nullsPadding || numNulls == 0) && (vectorIndex == 0 || columnVector->times + vectorIndex == values)) {
+            // the previous parts of the vector are followed by these values in the chunk buffer
+            columnVector->times = values - vectorIndex;
+            vector->pin(input);
+        } else {
+            // the values can not be referenced in the chunk buffer
+            useDecodedBuffer(columnVector->times, columnVector->decodedTimes, vectorIndex);
+            std::memcpy(columnVector->times + vectorIndex, values,
+                        numValues * sizeof(long));
         }
-    } else {
-        columnVector->times = (int64_t *)(input->getPointer() + input->getReadPos());
-        input->setReadPos(input->getReadPos() + size * sizeof(int64_t));
+		input->setReadPos(input->getReadPos() + numValues * sizeof(long));
+	}
+    if(!nullsPadding && numNulls > 0 && numNulls < size) {
+        scatterNonNulls(columnVector->times + vectorIndex, numValues, size, vector, vectorIndex);
     }
+    elementIndex += size;
 }
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "reader/VectorColumnReader.h"
+#include "vector/VectorColumnVector.h"
+#include <cstring>
+
+VectorColumnReader::VectorColumnReader(std::shared_ptr<TypeDescription> type) : ColumnReader(type) {
+	dimension = (int) type->getDimension();
+}
+
+void VectorColumnReader::close() {
+
+}
+
+void VectorColumnReader::read(std::shared_ptr<ByteBuffer> input, pixels::proto::ColumnEncoding & encoding, int offset,
+                              int size, int pixelStride, int vectorIndex, std::shared_ptr<ColumnVector> vector,
+                              pixels::proto::ColumnChunkIndex & chunkIndex, std::shared_ptr<PixelsBitMask> filterMask) {
+	std::shared_ptr<VectorColumnVector> columnVector =
+	    std::static_pointer_cast<VectorColumnVector>(vector);
+	if(offset == 0) {
+		elementIndex = 0;
+		isNullOffset = chunkIndex.isnulloffset();
+	}
+
+	int pixelId = elementIndex / pixelStride;
+	bool hasNull = chunkIndex.pixelstatistics(pixelId).statistic().hasnull();
+	int numNulls = setValid(input, pixelStride, vector, pixelId, hasNull, vectorIndex, size);
+	bool nullsPadding = chunkIndex.nullspadding();
+	// the number of vectors stored in the column chunk for [offset, offset + size)
+	int numValues = nullsPadding ? size : size - numNulls;
+	long rowBytes = (long) dimension * sizeof(float);
+	uint8_t * values = input->getPointer() + input->getReadPos();
+
+	if((nullsPadding || numNulls == 0) && vectorIndex == 0) {
+		columnVector->vector = reinterpret_cast<float *>(values);
+		vector->pin(input);
+	} else {
+		// the vectors can not be referenced in the chunk buffer
+		useDecodedBuffer(columnVector->vector, columnVector->decodedVector, vectorIndex, dimension);
+		std::memcpy(columnVector->decodedVector + (long) vectorIndex * dimension, values, numValues * rowBytes);
+	}
+	input->setReadPos(input->getReadPos() + numValues * rowBytes);
+	if(!nullsPadding && numNulls > 0 && numNulls < size) {
+		// move the vectors row by row, each row is dimension floats wide
+		float * rows = columnVector->vector + (long) vectorIndex * dimension;
+		for(int i = size - 1; i >= 0 && numValues < i + 1; i--) {
+			if(columnVector->checkValid(vectorIndex + i)) {
+				numValues--;
+				std::memmove(rows + (long) i * dimension, rows + (long) numValues * dimension, rowBytes);
+			}
+		}
+	}
+	elementIndex += size;
+}
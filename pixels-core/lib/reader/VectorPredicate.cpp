@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "reader/VectorPredicate.h"
+#include "exception/InvalidArgumentException.h"
+
+VectorPredicate::VectorPredicate(std::string columnName, std::vector<float> query, VectorDistance::Metric metric,
+                                 int topK, float maxDistance) {
+    if (query.empty()) {
+        throw InvalidArgumentException("the query vector of the vector predicate is empty");
+    }
+    if (topK <= 0 && maxDistance < 0) {
+        throw InvalidArgumentException("either topK or maxDistance should be set for the vector predicate");
+    }
+    this->columnName = std::move(columnName);
+    this->query = std::move(query);
+    this->metric = metric;
+    this->topK = topK;
+    this->maxDistance = maxDistance;
+}
+
+const std::string & VectorPredicate::getColumnName() const {
+    return columnName;
+}
+
+int VectorPredicate::getDimension() const {
+    return (int) query.size();
+}
+
+void VectorPredicate::apply(const std::shared_ptr<VectorColumnVector> & columnVector, int offset, int size,
+                            PixelsBitMask & filterMask) {
+    if (columnVector->getDimension() != getDimension()) {
+        throw InvalidArgumentException("the query vector has " + std::to_string(getDimension()) +
+                                       " dimensions, but the column " + columnName + " has " +
+                                       std::to_string(columnVector->getDimension()));
+    }
+    if ((int) distances.size() < size) {
+        distances.resize(size);
+    }
+    // the vectors are contiguous, so the distances of the whole batch are computed in one pass
+    VectorDistance::distances(metric, query.data(), columnVector->vector + (long) offset * getDimension(),
+                              size, getDimension(), distances.data());
+    for (int i = 0; i < size; i++) {
+        if (!filterMask.get(i)) {
+            continue;
+        }
+        float distance = distances[i];
+        if (!columnVector->checkValid(offset + i) || (maxDistance >= 0 && distance > maxDistance)) {
+            filterMask.set(i, 0);
+        } else if (topK > 0) {
+            if ((int) nearest.size() < topK) {
+                nearest.push(distance);
+            } else if (distance < nearest.top()) {
+                nearest.pop();
+                nearest.push(distance);
+            } else {
+                filterMask.set(i, 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "stats/DateStatsRecorder.h"
+#include <algorithm>
+
+DateStatsRecorder::DateStatsRecorder() : StatsRecorder(), minimum(0), maximum(0), hasMinimum(false) {}
+
+DateStatsRecorder::DateStatsRecorder(const pixels::proto::ColumnStatistic& statistic)
+        : StatsRecorder(statistic), minimum(0), maximum(0), hasMinimum(false) {
+    if (statistic.has_datestatistics()) {
+        const auto& dateStat = statistic.datestatistics();
+        if (dateStat.has_minimum() && dateStat.has_maximum()) {
+            minimum = dateStat.minimum();
+            maximum = dateStat.maximum();
+            hasMinimum = true;
+        }
+    }
+}
+
+void DateStatsRecorder::updateMinMax(int min, int max) {
+    if (!hasMinimum) {
+        minimum = min;
+        maximum = max;
+        hasMinimum = true;
+    } else {
+        minimum = std::min(minimum, min);
+        maximum = std::max(maximum, max);
+    }
+}
+
+void DateStatsRecorder::updateDate(int value) {
+    updateMinMax(value, value);
+    numberOfValues++;
+}
+
+void DateStatsRecorder::updateDate(const int* values, const uint8_t* isNull, int length) {
+    int min = 0, max = 0;
+    int count = minMax(values, isNull, length, min, max);
+    if (count > 0) {
+        updateMinMax(min, max);
+        numberOfValues += count;
+    }
+}
+
+void DateStatsRecorder::merge(const StatsRecorder& stats) {
+    auto dateStats = dynamic_cast<const DateStatsRecorder*>(&stats);
+    if (dateStats != nullptr && dateStats->hasMinimum) {
+        updateMinMax(dateStats->minimum, dateStats->maximum);
+    }
+    StatsRecorder::merge(stats);
+}
+
+void DateStatsRecorder::reset() {
+    StatsRecorder::reset();
+    minimum = 0;
+    maximum = 0;
+    hasMinimum = false;
+}
+
+pixels::proto::ColumnStatistic DateStatsRecorder::serialize() const {
+    pixels::proto::ColumnStatistic statistic = StatsRecorder::serialize();
+    auto dateStat = statistic.mutable_datestatistics();
+    if (hasMinimum) {
+        dateStat->set_minimum(minimum);
+        dateStat->set_maximum(maximum);
+    }
+    return statistic;
+}
+
+bool DateStatsRecorder::hasMinMax() const { return hasMinimum; }
+
+int DateStatsRecorder::getMinimum() const { return minimum; }
+
+int DateStatsRecorder::getMaximum() const { return maximum; }
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "stats/DoubleStatsRecorder.h"
+#include <algorithm>
+
+DoubleStatsRecorder::DoubleStatsRecorder() : StatsRecorder(), minimum(0), maximum(0), sum(0), hasMinimum(false) {}
+
+DoubleStatsRecorder::DoubleStatsRecorder(const pixels::proto::ColumnStatistic& statistic)
+        : StatsRecorder(statistic), minimum(0), maximum(0), sum(0), hasMinimum(false) {
+    if (statistic.has_doublestatistics()) {
+        const auto& doubleStat = statistic.doublestatistics();
+        if (doubleStat.has_minimum() && doubleStat.has_maximum()) {
+            minimum = doubleStat.minimum();
+            maximum = doubleStat.maximum();
+            hasMinimum = true;
+        }
+        sum = doubleStat.has_sum() ? doubleStat.sum() : 0;
+    }
+}
+
+void DoubleStatsRecorder::updateFloat(float value) {
+    updateDouble(value);
+}
+
+void DoubleStatsRecorder::updateDouble(double value) {
+    if (!hasMinimum) {
+        minimum = maximum = value;
+        hasMinimum = true;
+    } else if (value < minimum) {
+        minimum = value;
+    } else if (value > maximum) {
+        maximum = value;
+    }
+    sum += value;
+    numberOfValues++;
+}
+
+void DoubleStatsRecorder::merge(const StatsRecorder& stats) {
+    auto doubleStats = dynamic_cast<const DoubleStatsRecorder*>(&stats);
+    if (doubleStats != nullptr && doubleStats->hasMinimum) {
+        if (!hasMinimum) {
+            minimum = doubleStats->minimum;
+            maximum = doubleStats->maximum;
+            hasMinimum = true;
+        } else {
+            minimum = std::min(minimum, doubleStats->minimum);
+            maximum = std::max(maximum, doubleStats->maximum);
+        }
+        sum += doubleStats->sum;
+    }
+    StatsRecorder::merge(stats);
+}
+
+void DoubleStatsRecorder::reset() {
+    StatsRecorder::reset();
+    minimum = 0;
+    maximum = 0;
+    sum = 0;
+    hasMinimum = false;
+}
+
+pixels::proto::ColumnStatistic DoubleStatsRecorder::serialize() const {
+    pixels::proto::ColumnStatistic statistic = StatsRecorder::serialize();
+    auto doubleStat = statistic.mutable_doublestatistics();
+    if (hasMinimum) {
+        doubleStat->set_minimum(minimum);
+        doubleStat->set_maximum(maximum);
+    }
+    doubleStat->set_sum(sum);
+    return statistic;
+}
+
+double DoubleStatsRecorder::getMinimum() const { return minimum; }
+
+double DoubleStatsRecorder::getMaximum() const { return maximum; }
+
+double DoubleStatsRecorder::getSum() const { return sum; }
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "stats/Integer128StatsRecorder.h"
+
+static __int128 toInteger128(uint64_t high, uint64_t low) {
+    return (__int128) (((unsigned __int128) high << 64) | low);
+}
+
+Integer128StatsRecorder::Integer128StatsRecorder() : StatsRecorder(), minimum(0), maximum(0), hasMinimum(false) {}
+
+Integer128StatsRecorder::Integer128StatsRecorder(const pixels::proto::ColumnStatistic& statistic)
+        : StatsRecorder(statistic), minimum(0), maximum(0), hasMinimum(false) {
+    if (statistic.has_int128statistics()) {
+        const auto& int128Stat = statistic.int128statistics();
+        if (int128Stat.has_minimum_high() && int128Stat.has_maximum_high()) {
+            minimum = toInteger128(int128Stat.minimum_high(), int128Stat.minimum_low());
+            maximum = toInteger128(int128Stat.maximum_high(), int128Stat.maximum_low());
+            hasMinimum = true;
+        }
+    }
+}
+
+void Integer128StatsRecorder::updateInteger128(long high, long low, int repetitions) {
+    __int128 value = toInteger128(high, low);
+    if (!hasMinimum) {
+        minimum = maximum = value;
+        hasMinimum = true;
+    } else if (value < minimum) {
+        minimum = value;
+    } else if (value > maximum) {
+        maximum = value;
+    }
+    numberOfValues += repetitions;
+}
+
+void Integer128StatsRecorder::merge(const StatsRecorder& stats) {
+    auto int128Stats = dynamic_cast<const Integer128StatsRecorder*>(&stats);
+    if (int128Stats != nullptr && int128Stats->hasMinimum) {
+        if (!hasMinimum) {
+            minimum = int128Stats->minimum;
+            maximum = int128Stats->maximum;
+            hasMinimum = true;
+        } else {
+            minimum = int128Stats->minimum < minimum ? int128Stats->minimum : minimum;
+            maximum = int128Stats->maximum > maximum ? int128Stats->maximum : maximum;
+        }
+    }
+    StatsRecorder::merge(stats);
+}
+
+void Integer128StatsRecorder::reset() {
+    StatsRecorder::reset();
+    minimum = 0;
+    maximum = 0;
+    hasMinimum = false;
+}
+
+pixels::proto::ColumnStatistic Integer128StatsRecorder::serialize() const {
+    pixels::proto::ColumnStatistic statistic = StatsRecorder::serialize();
+    auto int128Stat = statistic.mutable_int128statistics();
+    if (hasMinimum) {
+        int128Stat->set_minimum_high((uint64_t) (minimum >> 64));
+        int128Stat->set_minimum_low((uint64_t) minimum);
+        int128Stat->set_maximum_high((int64_t) (maximum >> 64));
+        int128Stat->set_maximum_low((int64_t) (uint64_t) maximum);
+    }
+    return statistic;
+}
+
+bool Integer128StatsRecorder::hasMinMax() const { return hasMinimum; }
+
+__int128 Integer128StatsRecorder::getMinimum() const { return minimum; }
+
+__int128 Integer128StatsRecorder::getMaximum() const { return maximum; }
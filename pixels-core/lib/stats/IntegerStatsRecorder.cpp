@@ -0,0 +1,157 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "stats/IntegerStatsRecorder.h"
+#include <algorithm>
+
+IntegerStatsRecorder::IntegerStatsRecorder()
+        : StatsRecorder(), minimum(0), maximum(0), sum(0), hasMinimum(false), overflow(false) {}
+
+IntegerStatsRecorder::IntegerStatsRecorder(const pixels::proto::ColumnStatistic& statistic)
+        : StatsRecorder(statistic), minimum(0), maximum(0), sum(0), hasMinimum(false), overflow(false) {
+    if (statistic.has_intstatistics()) {
+        const auto& intStat = statistic.intstatistics();
+        if (intStat.has_minimum() && intStat.has_maximum()) {
+            minimum = intStat.minimum();
+            maximum = intStat.maximum();
+            hasMinimum = true;
+        }
+        if (intStat.has_sum()) {
+            sum = intStat.sum();
+        } else {
+            overflow = true;
+        }
+    }
+}
+
+void IntegerStatsRecorder::updateMinMax(long min, long max) {
+    if (!hasMinimum) {
+        minimum = min;
+        maximum = max;
+        hasMinimum = true;
+    } else {
+        minimum = std::min(minimum, min);
+        maximum = std::max(maximum, max);
+    }
+}
+
+void IntegerStatsRecorder::updateSum(long value) {
+    if (!overflow && __builtin_add_overflow(sum, value, &sum)) {
+        overflow = true;
+    }
+}
+
+void IntegerStatsRecorder::updateInteger(long value, int repetitions) {
+    updateMinMax(value, value);
+    long increment;
+    if (__builtin_mul_overflow(value, (long) repetitions, &increment)) {
+        overflow = true;
+    } else {
+        updateSum(increment);
+    }
+    numberOfValues += repetitions;
+}
+
+void IntegerStatsRecorder::updateInteger(const long* values, const uint8_t* isNull, int length) {
+    long min = 0, max = 0;
+    int count = minMax(values, isNull, length, min, max);
+    if (count == 0) {
+        return;
+    }
+    updateMinMax(min, max);
+    if (!overflow) {
+        // the sum of a batch of longs may exceed 64 bits even if the total does not
+        __int128 batchSum = 0;
+        for (int i = 0; i < length; i++) {
+            batchSum += isNull[i] ? 0 : values[i];
+        }
+        if (batchSum > std::numeric_limits<long>::max() || batchSum < std::numeric_limits<long>::min()) {
+            overflow = true;
+        } else {
+            updateSum((long) batchSum);
+        }
+    }
+    numberOfValues += count;
+}
+
+void IntegerStatsRecorder::updateInteger(const int* values, const uint8_t* isNull, int length) {
+    int min = 0, max = 0;
+    int count = minMax(values, isNull, length, min, max);
+    if (count == 0) {
+        return;
+    }
+    updateMinMax(min, max);
+    // the sum of a batch of ints never exceeds 64 bits
+    long batchSum = 0;
+    for (int i = 0; i < length; i++) {
+        batchSum += isNull[i] ? 0 : values[i];
+    }
+    updateSum(batchSum);
+    numberOfValues += count;
+}
+
+void IntegerStatsRecorder::merge(const StatsRecorder& stats) {
+    auto intStats = dynamic_cast<const IntegerStatsRecorder*>(&stats);
+    if (intStats != nullptr) {
+        if (intStats->hasMinimum) {
+            updateMinMax(intStats->minimum, intStats->maximum);
+        }
+        if (intStats->overflow) {
+            overflow = true;
+        } else {
+            updateSum(intStats->sum);
+        }
+    }
+    StatsRecorder::merge(stats);
+}
+
+void IntegerStatsRecorder::reset() {
+    StatsRecorder::reset();
+    minimum = 0;
+    maximum = 0;
+    sum = 0;
+    hasMinimum = false;
+    overflow = false;
+}
+
+pixels::proto::ColumnStatistic IntegerStatsRecorder::serialize() const {
+    pixels::proto::ColumnStatistic statistic = StatsRecorder::serialize();
+    auto intStat = statistic.mutable_intstatistics();
+    if (hasMinimum) {
+        intStat->set_minimum(minimum);
+        intStat->set_maximum(maximum);
+    }
+    if (!overflow) {
+        intStat->set_sum(sum);
+    }
+    return statistic;
+}
+
+bool IntegerStatsRecorder::hasMinMax() const { return hasMinimum; }
+
+long IntegerStatsRecorder::getMinimum() const { return minimum; }
+
+long IntegerStatsRecorder::getMaximum() const { return maximum; }
+
+bool IntegerStatsRecorder::isSumDefined() const { return !overflow; }
+
+long IntegerStatsRecorder::getSum() const { return sum; }
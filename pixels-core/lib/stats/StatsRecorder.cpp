@@ -23,6 +23,12 @@
 //
 
 #include "stats/StatsRecorder.h"
+#include "stats/DoubleStatsRecorder.h"
+#include "stats/Integer128StatsRecorder.h"
+#include "stats/IntegerStatsRecorder.h"
+#include "stats/DateStatsRecorder.h"
+#include "stats/TimestampStatsRecorder.h"
+#include "stats/StringStatsRecorder.h"
 #include <stdexcept>
 
 
@@ -89,6 +95,26 @@ void StatsRecorder::updateVector() {
     throw std::logic_error("Can't update vector");
 }
 
+void StatsRecorder::updateString(const char*, int, int) {
+    throw std::logic_error("Can't update string");
+}
+
+void StatsRecorder::updateInteger(const long*, const uint8_t*, int) {
+    throw std::logic_error("Can't update integer");
+}
+
+void StatsRecorder::updateInteger(const int*, const uint8_t*, int) {
+    throw std::logic_error("Can't update integer");
+}
+
+void StatsRecorder::updateDate(const int*, const uint8_t*, int) {
+    throw std::logic_error("Can't update date");
+}
+
+void StatsRecorder::updateTimestamp(const long*, const uint8_t*, int) {
+    throw std::logic_error("Can't update timestamp");
+}
+
 bool StatsRecorder::isStatsExists() const {
     return (numberOfValues > 0 || hasNull);
 }
@@ -124,7 +150,28 @@ std::unique_ptr<StatsRecorder> StatsRecorder::create(TypeDescription type) {
 
         case TypeDescription::BOOLEAN:
             // return std::make_unique<BooleanStatsRecorder>();
-            break;
+            return std::make_unique<StatsRecorder>();
+        case TypeDescription::SHORT:
+        case TypeDescription::INT:
+        case TypeDescription::LONG:
+            return std::make_unique<IntegerStatsRecorder>();
+        case TypeDescription::FLOAT:
+        case TypeDescription::DOUBLE:
+            return std::make_unique<DoubleStatsRecorder>();
+        case TypeDescription::DECIMAL:
+            if (type.getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
+                return std::make_unique<Integer128StatsRecorder>();
+            }
+            // short decimals are recorded by their unscaled values
+            return std::make_unique<IntegerStatsRecorder>();
+        case TypeDescription::DATE:
+            return std::make_unique<DateStatsRecorder>();
+        case TypeDescription::TIMESTAMP:
+            return std::make_unique<TimestampStatsRecorder>();
+        case TypeDescription::STRING:
+        case TypeDescription::CHAR:
+        case TypeDescription::VARCHAR:
+            return std::make_unique<StringStatsRecorder>();
 
         default:
             return std::make_unique<StatsRecorder>();
@@ -133,16 +180,39 @@ std::unique_ptr<StatsRecorder> StatsRecorder::create(TypeDescription type) {
 
 
 std::unique_ptr<StatsRecorder> StatsRecorder::create(TypeDescription type, const pixels::proto::ColumnStatistic& statistic) {
-    switch (type.getCategory()) {
-
-        default:
-            return std::make_unique<StatsRecorder>(statistic);
+    if (type.getCategory() == TypeDescription::DECIMAL) {
+        if (type.getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION) {
+            return std::make_unique<Integer128StatsRecorder>(statistic);
+        }
+        return std::make_unique<IntegerStatsRecorder>(statistic);
     }
+    return create(type.getCategory(), statistic);
 }
 
 
 std::unique_ptr<StatsRecorder> StatsRecorder::create(TypeDescription::Category category, const pixels::proto::ColumnStatistic& statistic) {
     switch (category) {
+        case TypeDescription::SHORT:
+        case TypeDescription::INT:
+        case TypeDescription::LONG:
+            return std::make_unique<IntegerStatsRecorder>(statistic);
+        case TypeDescription::FLOAT:
+        case TypeDescription::DOUBLE:
+            return std::make_unique<DoubleStatsRecorder>(statistic);
+        case TypeDescription::DECIMAL:
+            // the precision is unknown, long decimal statistics are recognized by their content
+            if (statistic.has_int128statistics()) {
+                return std::make_unique<Integer128StatsRecorder>(statistic);
+            }
+            return std::make_unique<IntegerStatsRecorder>(statistic);
+        case TypeDescription::DATE:
+            return std::make_unique<DateStatsRecorder>(statistic);
+        case TypeDescription::TIMESTAMP:
+            return std::make_unique<TimestampStatsRecorder>(statistic);
+        case TypeDescription::STRING:
+        case TypeDescription::CHAR:
+        case TypeDescription::VARCHAR:
+            return std::make_unique<StringStatsRecorder>(statistic);
 
         default:
             return std::make_unique<StatsRecorder>(statistic);
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "stats/StringStatsRecorder.h"
+#include <algorithm>
+#include <string_view>
+
+const int StringStatsRecorder::MAX_LENGTH = 64;
+
+StringStatsRecorder::StringStatsRecorder() : StatsRecorder(), sum(0), hasMinimum(false) {}
+
+StringStatsRecorder::StringStatsRecorder(const pixels::proto::ColumnStatistic& statistic)
+        : StatsRecorder(statistic), sum(0), hasMinimum(false) {
+    if (statistic.has_stringstatistics()) {
+        const auto& stringStat = statistic.stringstatistics();
+        if (stringStat.has_minimum() && stringStat.has_maximum()) {
+            minimum = stringStat.minimum();
+            maximum = stringStat.maximum();
+            hasMinimum = true;
+        }
+        sum = stringStat.has_sum() ? stringStat.sum() : 0;
+    }
+}
+
+std::string StringStatsRecorder::truncateMinimum(const char* value, int length) {
+    return std::string(value, std::min(length, MAX_LENGTH));
+}
+
+std::string StringStatsRecorder::truncateMaximum(const char* value, int length) {
+    if (length <= MAX_LENGTH) {
+        return std::string(value, length);
+    }
+    std::string maximum(value, MAX_LENGTH);
+    for (int i = MAX_LENGTH - 1; i >= 0; i--) {
+        auto byte = (uint8_t) maximum[i];
+        if (byte != 0xff) {
+            maximum[i] = (char) (byte + 1);
+            maximum.resize(i + 1);
+            return maximum;
+        }
+    }
+    return std::string(value, length);
+}
+
+void StringStatsRecorder::updateString(const std::string& value, int repetitions) {
+    updateString(value.data(), value.size(), repetitions);
+}
+
+void StringStatsRecorder::updateString(const char* value, int length, int repetitions) {
+    std::string_view view(value, length);
+    if (!hasMinimum) {
+        minimum = truncateMinimum(value, length);
+        maximum = truncateMaximum(value, length);
+        hasMinimum = true;
+    } else if (view < minimum) {
+        minimum = truncateMinimum(value, length);
+    } else if (view > maximum) {
+        maximum = truncateMaximum(value, length);
+    }
+    sum += (long) length * repetitions;
+    numberOfValues += repetitions;
+}
+
+void StringStatsRecorder::merge(const StatsRecorder& stats) {
+    auto stringStats = dynamic_cast<const StringStatsRecorder*>(&stats);
+    if (stringStats != nullptr) {
+        if (stringStats->hasMinimum) {
+            if (!hasMinimum) {
+                minimum = stringStats->minimum;
+                maximum = stringStats->maximum;
+                hasMinimum = true;
+            } else {
+                if (stringStats->minimum < minimum) {
+                    minimum = stringStats->minimum;
+                }
+                if (stringStats->maximum > maximum) {
+                    maximum = stringStats->maximum;
+                }
+            }
+        }
+        sum += stringStats->sum;
+    }
+    StatsRecorder::merge(stats);
+}
+
+void StringStatsRecorder::reset() {
+    StatsRecorder::reset();
+    minimum.clear();
+    maximum.clear();
+    sum = 0;
+    hasMinimum = false;
+}
+
+pixels::proto::ColumnStatistic StringStatsRecorder::serialize() const {
+    pixels::proto::ColumnStatistic statistic = StatsRecorder::serialize();
+    auto stringStat = statistic.mutable_stringstatistics();
+    if (hasMinimum) {
+        stringStat->set_minimum(minimum);
+        stringStat->set_maximum(maximum);
+    }
+    stringStat->set_sum(sum);
+    return statistic;
+}
+
+bool StringStatsRecorder::hasMinMax() const { return hasMinimum; }
+
+const std::string& StringStatsRecorder::getMinimum() const { return minimum; }
+
+const std::string& StringStatsRecorder::getMaximum() const { return maximum; }
+
+long StringStatsRecorder::getSum() const { return sum; }
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "stats/TimestampStatsRecorder.h"
+#include <algorithm>
+
+TimestampStatsRecorder::TimestampStatsRecorder() : StatsRecorder(), minimum(0), maximum(0), hasMinimum(false) {}
+
+TimestampStatsRecorder::TimestampStatsRecorder(const pixels::proto::ColumnStatistic& statistic)
+        : StatsRecorder(statistic), minimum(0), maximum(0), hasMinimum(false) {
+    if (statistic.has_timestampstatistics()) {
+        const auto& timestampStat = statistic.timestampstatistics();
+        if (timestampStat.has_minimum() && timestampStat.has_maximum()) {
+            minimum = timestampStat.minimum();
+            maximum = timestampStat.maximum();
+            hasMinimum = true;
+        }
+    }
+}
+
+void TimestampStatsRecorder::updateMinMax(long min, long max) {
+    if (!hasMinimum) {
+        minimum = min;
+        maximum = max;
+        hasMinimum = true;
+    } else {
+        minimum = std::min(minimum, min);
+        maximum = std::max(maximum, max);
+    }
+}
+
+void TimestampStatsRecorder::updateTimestamp(long value) {
+    updateMinMax(value, value);
+    numberOfValues++;
+}
+
+void TimestampStatsRecorder::updateTimestamp(const long* values, const uint8_t* isNull, int length) {
+    long min = 0, max = 0;
+    int count = minMax(values, isNull, length, min, max);
+    if (count > 0) {
+        updateMinMax(min, max);
+        numberOfValues += count;
+    }
+}
+
+void TimestampStatsRecorder::merge(const StatsRecorder& stats) {
+    auto timestampStats = dynamic_cast<const TimestampStatsRecorder*>(&stats);
+    if (timestampStats != nullptr && timestampStats->hasMinimum) {
+        updateMinMax(timestampStats->minimum, timestampStats->maximum);
+    }
+    StatsRecorder::merge(stats);
+}
+
+void TimestampStatsRecorder::reset() {
+    StatsRecorder::reset();
+    minimum = 0;
+    maximum = 0;
+    hasMinimum = false;
+}
+
+pixels::proto::ColumnStatistic TimestampStatsRecorder::serialize() const {
+    pixels::proto::ColumnStatistic statistic = StatsRecorder::serialize();
+    auto timestampStat = statistic.mutable_timestampstatistics();
+    if (hasMinimum) {
+        timestampStat->set_minimum(minimum);
+        timestampStat->set_maximum(maximum);
+    }
+    return statistic;
+}
+
+bool TimestampStatsRecorder::hasMinMax() const { return hasMinimum; }
+
+long TimestampStatsRecorder::getMinimum() const { return minimum; }
+
+long TimestampStatsRecorder::getMaximum() const { return maximum; }
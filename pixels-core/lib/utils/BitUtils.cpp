@@ -22,7 +22,12 @@
 // Created by whz on 11/27/24.
 //
 #include <stdexcept>
+#include <cstring>
+#include <algorithm>
 #include "utils/BitUtils.h"
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 std::vector<uint8_t> BitUtils::bitWiseCompactLE(std::vector<bool> values)
 {
@@ -318,3 +323,121 @@ std::vector<uint8_t> BitUtils::bitWiseCompactBE(bool *values, int length)
     return bitWiseOutput;
 }
 
+int BitUtils::toValidityMask(const uint8_t *isNull, uint64_t *isValid, int numValues)
+{
+    int numBytes = (numValues + 7) / 8;
+    int numWords = numBytes / 8;
+    int numNulls = 0;
+    int i = 0;
+#ifdef __AVX2__
+    const __m256i ones = _mm256_set1_epi8((char) 0xFF);
+    for (; i + 4 <= numWords; i += 4)
+    {
+        __m256i nulls = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(isNull + i * 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(isValid + i), _mm256_xor_si256(nulls, ones));
+        if (!_mm256_testz_si256(nulls, nulls))
+        {
+            numNulls += __builtin_popcountll(_mm256_extract_epi64(nulls, 0)) +
+                        __builtin_popcountll(_mm256_extract_epi64(nulls, 1)) +
+                        __builtin_popcountll(_mm256_extract_epi64(nulls, 2)) +
+                        __builtin_popcountll(_mm256_extract_epi64(nulls, 3));
+        }
+    }
+#endif
+    for (; i < numWords; i++)
+    {
+        uint64_t nulls;
+        std::memcpy(&nulls, isNull + i * 8, sizeof(nulls));
+        isValid[i] = ~nulls;
+        numNulls += __builtin_popcountll(nulls);
+    }
+    int tailBytes = numBytes - numWords * 8;
+    if (tailBytes > 0)
+    {
+        // the bits after the last value are zero in the isNull bitmap
+        uint64_t nulls = 0;
+        std::memcpy(&nulls, isNull + numWords * 8, tailBytes);
+        isValid[numWords] = ~nulls;
+        numNulls += __builtin_popcountll(nulls);
+    }
+    return numNulls;
+}
+
+int BitUtils::toValidityMask(const uint8_t *isNull, int nullBitOffset, uint64_t *isValid, int validBitOffset,
+                             int numValues)
+{
+    if (nullBitOffset % 8 == 0 && validBitOffset % 64 == 0 && numValues % 8 == 0)
+    {
+        // byte aligned source and word aligned destination: the words after the range are rewritten later
+        return toValidityMask(isNull + nullBitOffset / 8, isValid + validBitOffset / 64, numValues);
+    }
+    int numNulls = 0;
+    for (int i = 0; i < numValues;)
+    {
+        int src = nullBitOffset + i;
+        int dst = validBitOffset + i;
+        // at most 56 bits are taken from the source, so that they fit in one 8-byte load after the shift
+        int n = std::min(std::min(numValues - i, 64 - dst % 64), 56);
+        uint64_t bits = 0;
+        std::memcpy(&bits, isNull + src / 8, (src % 8 + n + 7) / 8);
+        uint64_t mask = (1ULL << n) - 1;
+        uint64_t nulls = (bits >> (src % 8)) & mask;
+        numNulls += __builtin_popcountll(nulls);
+        uint64_t &word = isValid[dst / 64];
+        word = (word & ~(mask << (dst % 64))) | ((~nulls & mask) << (dst % 64));
+        i += n;
+    }
+    return numNulls;
+}
+
+void BitUtils::fillValidityMask(uint64_t *isValid, int bitOffset, int numValues)
+{
+    for (int i = 0; i < numValues;)
+    {
+        int dst = bitOffset + i;
+        int n = std::min(numValues - i, 64 - dst % 64);
+        uint64_t mask = n == 64 ? ~0ULL : ((1ULL << n) - 1) << (dst % 64);
+        isValid[dst / 64] |= mask;
+        i += n;
+    }
+}
+
+void BitUtils::unpackBits(const uint8_t *bits, int bitOffset, uint8_t *values, int numValues)
+{
+    int i = 0;
+    // unpack the leading values one by one until the bit offset is byte aligned
+    for (; i < numValues && (bitOffset + i) % 8 != 0; i++)
+    {
+        values[i] = (bits[(bitOffset + i) / 8] >> ((bitOffset + i) % 8)) & 1;
+    }
+    const uint8_t *aligned = bits + (bitOffset + i) / 8;
+    int j = 0;
+    int numAligned = numValues - i;
+#ifdef __AVX2__
+    // spread each of the 4 bytes to 8 bytes, then test the bit of each byte
+    const __m256i shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                             2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bitMask = _mm256_set1_epi64x((long long) 0x8040201008040201ULL);
+    const __m256i ones = _mm256_set1_epi8(1);
+    for (; j + 32 <= numAligned; j += 32)
+    {
+        uint32_t word;
+        std::memcpy(&word, aligned + j / 8, sizeof(word));
+        __m256i spread = _mm256_shuffle_epi8(_mm256_set1_epi32((int) word), shuffle);
+        __m256i isSet = _mm256_cmpeq_epi8(_mm256_and_si256(spread, bitMask), bitMask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i + j), _mm256_and_si256(isSet, ones));
+    }
+#endif
+    for (; j + 8 <= numAligned; j += 8)
+    {
+        uint8_t b = aligned[j / 8];
+        for (int k = 0; k < 8; k++)
+        {
+            values[i + j + k] = (b >> k) & 1;
+        }
+    }
+    for (; j < numAligned; j++)
+    {
+        values[i + j] = (aligned[j / 8] >> (j % 8)) & 1;
+    }
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "utils/BloomFilter.h"
+#include "vector/BinaryColumnVector.h"
+#include "vector/DateColumnVector.h"
+#include "vector/DecimalColumnVector.h"
+#include "vector/LongColumnVector.h"
+#include "vector/LongDecimalColumnVector.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+const int BloomFilter::BYTES_PER_BLOCK = 32;
+
+namespace {
+    const int WORDS_PER_BLOCK = 8;
+    // the upper bound of the filter size of a column chunk
+    const uint64_t MAX_BYTES = 128UL * 1024 * 1024;
+    alignas(32) const uint32_t SALT[WORDS_PER_BLOCK] = {
+            0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+            0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    uint64_t mix(uint64_t value) {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+}
+
+BloomFilter::BloomFilter(uint64_t numDistinctValues, double fpp) {
+    // the number of bits for k = 8 hash functions: m = -k * n / ln(1 - p^(1/k))
+    double numBits = -8.0 * std::max<uint64_t>(numDistinctValues, 1) / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+    uint64_t numBytes = std::min<uint64_t>(MAX_BYTES, (uint64_t) std::ceil(numBits / 8));
+    numBlocks = std::max<uint64_t>(1, (numBytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK);
+    words.assign((size_t) numBlocks * WORDS_PER_BLOCK, 0);
+}
+
+uint32_t BloomFilter::blockIndex(uint64_t hash, uint32_t numBlocks) {
+    return (uint32_t) (((hash >> 32) * numBlocks) >> 32);
+}
+
+bool BloomFilter::blockContains(const uint32_t *block, uint32_t key) {
+#ifdef __AVX2__
+    __m256i salted = _mm256_mullo_epi32(_mm256_set1_epi32((int) key),
+                                        _mm256_load_si256(reinterpret_cast<const __m256i *>(SALT)));
+    __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(salted, 27));
+    // all the bits of the mask are set in the block
+    return _mm256_testc_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block)), mask);
+#else
+    for (int i = 0; i < WORDS_PER_BLOCK; i++) {
+        if ((block[i] & (1U << ((key * SALT[i]) >> 27))) == 0) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+void BloomFilter::blockInsert(uint32_t *block, uint32_t key) {
+#ifdef __AVX2__
+    __m256i salted = _mm256_mullo_epi32(_mm256_set1_epi32((int) key),
+                                        _mm256_load_si256(reinterpret_cast<const __m256i *>(SALT)));
+    __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(salted, 27));
+    __m256i *target = reinterpret_cast<__m256i *>(block);
+    _mm256_storeu_si256(target, _mm256_or_si256(_mm256_loadu_si256(target), mask));
+#else
+    for (int i = 0; i < WORDS_PER_BLOCK; i++) {
+        block[i] |= 1U << ((key * SALT[i]) >> 27);
+    }
+#endif
+}
+
+void BloomFilter::insert(uint64_t hash) {
+    blockInsert(words.data() + (size_t) blockIndex(hash, numBlocks) * WORDS_PER_BLOCK, (uint32_t) hash);
+}
+
+bool BloomFilter::mightContain(uint64_t hash) const {
+    return blockContains(words.data() + (size_t) blockIndex(hash, numBlocks) * WORDS_PER_BLOCK, (uint32_t) hash);
+}
+
+std::string BloomFilter::serialize() const {
+    // the reader only supports little endian, so the words are stored as they are in memory
+    return std::string(reinterpret_cast<const char *>(words.data()), words.size() * sizeof(uint32_t));
+}
+
+bool BloomFilter::mightContain(const std::string &bitset, uint64_t hash) {
+    uint32_t numBlocks = bitset.size() / BYTES_PER_BLOCK;
+    if (numBlocks == 0) {
+        // the filter is corrupted or missing, it can not rule out anything
+        return true;
+    }
+    uint32_t block[WORDS_PER_BLOCK];
+    std::memcpy(block, bitset.data() + (size_t) blockIndex(hash, numBlocks) * BYTES_PER_BLOCK, BYTES_PER_BLOCK);
+    return blockContains(block, (uint32_t) hash);
+}
+
+uint64_t BloomFilter::hash(int64_t value) {
+    return mix((uint64_t) value + 0x9e3779b97f4a7c15ULL);
+}
+
+uint64_t BloomFilter::hash(const char *data, int length) {
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ ((uint64_t) length * 0xff51afd7ed558ccdULL);
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        h = (h ^ mix(word)) * 0x9e3779b97f4a7c15ULL;
+    }
+    if (i < length) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, length - i);
+        h = (h ^ mix(word)) * 0x9e3779b97f4a7c15ULL;
+    }
+    return mix(h);
+}
+
+uint64_t BloomFilter::hash(int64_t high, uint64_t low) {
+    return mix(hash(high) ^ (low * 0x9e3779b97f4a7c15ULL));
+}
+
+bool BloomFilter::isTypeSupported(TypeDescription::Category category) {
+    switch (category) {
+        case TypeDescription::SHORT:
+        case TypeDescription::INT:
+        case TypeDescription::LONG:
+        case TypeDescription::DATE:
+        case TypeDescription::DECIMAL:
+        case TypeDescription::STRING:
+        case TypeDescription::VARCHAR:
+        case TypeDescription::BINARY:
+        case TypeDescription::VARBINARY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void BloomFilter::hashValues(const std::shared_ptr<ColumnVector> &vector, TypeDescription::Category category,
+                             int length, uint64_t *hashes) {
+    switch (category) {
+        case TypeDescription::SHORT:
+        case TypeDescription::INT:
+        case TypeDescription::LONG: {
+            auto longVector = std::static_pointer_cast<LongColumnVector>(vector);
+            if (longVector->isLongVectore()) {
+                for (int i = 0; i < length; i++) {
+                    hashes[i] = hash((int64_t) longVector->longVector[i]);
+                }
+            } else {
+                for (int i = 0; i < length; i++) {
+                    hashes[i] = hash((int64_t) longVector->intVector[i]);
+                }
+            }
+            break;
+        }
+        case TypeDescription::DATE: {
+            auto dateVector = std::static_pointer_cast<DateColumnVector>(vector);
+            for (int i = 0; i < length; i++) {
+                hashes[i] = hash((int64_t) dateVector->dates[i]);
+            }
+            break;
+        }
+        case TypeDescription::DECIMAL: {
+            if (auto longDecimalVector = std::dynamic_pointer_cast<LongDecimalColumnVector>(vector)) {
+                for (int i = 0; i < length; i++) {
+                    hashes[i] = hash((int64_t) longDecimalVector->vector[2 * i + 1], longDecimalVector->vector[2 * i]);
+                }
+            } else {
+                auto decimalVector = std::static_pointer_cast<DecimalColumnVector>(vector);
+                for (int i = 0; i < length; i++) {
+                    hashes[i] = hash((int64_t) decimalVector->vector[i]);
+                }
+            }
+            break;
+        }
+        case TypeDescription::STRING:
+        case TypeDescription::VARCHAR:
+        case TypeDescription::BINARY:
+        case TypeDescription::VARBINARY: {
+            auto binaryVector = std::static_pointer_cast<BinaryColumnVector>(vector);
+            for (int i = 0; i < length; i++) {
+                hashes[i] = vector->isNull[i] ? 0 : hash(binaryVector->vector[i].GetData(), binaryVector->lens[i]);
+            }
+            break;
+        }
+        default:
+            throw InvalidArgumentException("BloomFilter: the values of type " + std::to_string(category) +
+                                           " can not be hashed");
+    }
+}
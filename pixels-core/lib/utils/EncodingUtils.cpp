@@ -3,6 +3,7 @@
 //
 
 #include "utils/EncodingUtils.h"
+#include "exception/InvalidArgumentException.h"
 
 int EncodingUtils::BUFFER_SIZE = 64;
 
@@ -185,7 +186,12 @@ void EncodingUtils::readLongBE(const std::shared_ptr<ByteBuffer> &input, long *b
     // bulk read to buffer
     int bytesRead = input->read(readBuffer, 0, toRead);
     while (bytesRead != toRead) {
-        bytesRead += input->read(readBuffer, bytesRead, toRead - bytesRead);
+        int n = input->read(readBuffer, bytesRead, toRead - bytesRead);
+        if (n == 0) {
+            throw InvalidArgumentException("EncodingUtils::readLongBE: "
+                                           "unexpected end of the input stream.");
+        }
+        bytesRead += n;
     }
     switch (numBytes) {
         case 1:
@@ -280,7 +286,12 @@ void EncodingUtils::readRemainingLongs(const std::shared_ptr<ByteBuffer> &input,
     // bulk read to buffer
     int bytesRead = input->read(readBuffer, 0, toRead);
     while (bytesRead != toRead) {
-        bytesRead += input->read(readBuffer, bytesRead, toRead - bytesRead);
+        int n = input->read(readBuffer, bytesRead, toRead - bytesRead);
+        if (n == 0) {
+            throw InvalidArgumentException("EncodingUtils::readRemainingLongs: "
+                                           "unexpected end of the input stream.");
+        }
+        bytesRead += n;
     }
 
     int idx = 0;
@@ -641,6 +652,15 @@ void EncodingUtils::writeIntLE(std::shared_ptr<ByteBuffer> output, int value)
     output->putBytes(writeBuffer, 4);
 }
 
+void EncodingUtils::writeIntLE(std::shared_ptr<SegmentedOutputStream> output, int value)
+{
+    writeBuffer[0] = (byte) ((value) & 0xff);
+    writeBuffer[1] = (byte) ((value >> 8) & 0xff);
+    writeBuffer[2] = (byte) ((value >> 16) & 0xff);
+    writeBuffer[3] = (byte) ((value >> 24) & 0xff);
+    output->putBytes(writeBuffer, 4);
+}
+
 void EncodingUtils::writeLongLE(std::shared_ptr<ByteBuffer> output, long value)
 {
     writeBuffer[0] = (byte) ((value) & 0xff);
@@ -663,6 +683,15 @@ void EncodingUtils::writeIntBE(std::shared_ptr<ByteBuffer> output, int value)
     output->putBytes(writeBuffer, 4);
 }
 
+void EncodingUtils::writeIntBE(std::shared_ptr<SegmentedOutputStream> output, int value)
+{
+    writeBuffer[3] = (byte) ((value) & 0xff);
+    writeBuffer[2] = (byte) ((value >> 8) & 0xff);
+    writeBuffer[1] = (byte) ((value >> 16) & 0xff);
+    writeBuffer[0] = (byte) ((value >> 24) & 0xff);
+    output->putBytes(writeBuffer, 4);
+}
+
 void EncodingUtils::writeLongBE(std::shared_ptr<ByteBuffer> output, long value)
 {
     writeBuffer[7] = (byte) ((value) & 0xff);
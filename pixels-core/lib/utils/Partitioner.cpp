@@ -0,0 +1,125 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "utils/Partitioner.h"
+#include "utils/BloomFilter.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
+
+const uint64_t Partitioner::INITIAL_HASH = 0x9e3779b97f4a7c15ULL;
+
+namespace {
+    // the hash of a null key, nulls of all the types are in the same partition
+    const uint64_t NULL_HASH = 0;
+}
+
+Partitioner::Partitioner(int numPartitions, int batchSize, const std::shared_ptr<TypeDescription> &schema,
+                         const std::vector<int> &keyColumnIds)
+        : numPartitions(numPartitions), batchSize(batchSize), schema(schema), keyColumnIds(keyColumnIds) {
+    if (numPartitions <= 0 || batchSize <= 0) {
+        throw InvalidArgumentException("Partitioner: the number of partitions and the batch size must be positive");
+    }
+    if (keyColumnIds.empty()) {
+        throw InvalidArgumentException("Partitioner: no key column is specified");
+    }
+    auto children = schema->getChildren();
+    for (int columnId : keyColumnIds) {
+        if (columnId < 0 || columnId >= children.size()) {
+            throw InvalidArgumentException("Partitioner: key column " + std::to_string(columnId) + " does not exist");
+        }
+        auto category = children.at(columnId)->getCategory();
+        if (!BloomFilter::isTypeSupported(category)) {
+            throw InvalidArgumentException("Partitioner: the type of key column " + std::to_string(columnId) +
+                                           " is not supported");
+        }
+        keyCategories.push_back(category);
+    }
+    for (int i = 0; i < numPartitions; i++) {
+        rowBatches.push_back(schema->createRowBatch(batchSize));
+    }
+}
+
+uint64_t Partitioner::combineHash(uint64_t rowHash, uint64_t keyHash) {
+    return rowHash * 31 + keyHash;
+}
+
+int Partitioner::getHashValue(uint64_t rowHash, int numPartitions) {
+    return (int) (rowHash % numPartitions);
+}
+
+std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> Partitioner::partition(
+        const std::shared_ptr<VectorizedRowBatch> &rowBatch) {
+    int numRows = rowBatch->count();
+    std::vector<uint64_t> rowHashes(numRows, INITIAL_HASH);
+    std::vector<uint64_t> keyHashes(numRows);
+    for (int i = 0; i < keyColumnIds.size(); i++) {
+        auto &keyVector = rowBatch->cols[keyColumnIds[i]];
+        BloomFilter::hashValues(keyVector, keyCategories[i], numRows, keyHashes.data());
+        for (int row = 0; row < numRows; row++) {
+            rowHashes[row] = combineHash(rowHashes[row], keyVector->isNull[row] ? NULL_HASH : keyHashes[row]);
+        }
+    }
+    std::vector<std::vector<uint64_t>> partitionRows(numPartitions);
+    for (int row = 0; row < numRows; row++) {
+        partitionRows[getHashValue(rowHashes[row], numPartitions)].push_back(ColumnVector::makeRowId(0, row));
+    }
+
+    std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> fullBatches;
+    std::vector<ColumnVector *> sources(1);
+    for (int hashValue = 0; hashValue < numPartitions; hashValue++) {
+        const auto &rowIds = partitionRows[hashValue];
+        int copied = 0;
+        while (copied < rowIds.size()) {
+            auto &target = rowBatches[hashValue];
+            int toCopy = std::min((int) rowIds.size() - copied, batchSize - target->rowCount);
+            for (int column = 0; column < target->cols.size(); column++) {
+                sources[0] = rowBatch->cols[column].get();
+                target->cols[column]->gather(sources, rowIds.data() + copied, toCopy, target->rowCount);
+            }
+            target->rowCount += toCopy;
+            copied += toCopy;
+            if (target->rowCount == batchSize) {
+                fullBatches.emplace_back(hashValue, target);
+                target = schema->createRowBatch(batchSize);
+            }
+        }
+    }
+    return fullBatches;
+}
+
+std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> Partitioner::getRowBatches() {
+    std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> batches;
+    for (int hashValue = 0; hashValue < numPartitions; hashValue++) {
+        if (rowBatches[hashValue]->rowCount > 0) {
+            batches.emplace_back(hashValue, rowBatches[hashValue]);
+            rowBatches[hashValue] = schema->createRowBatch(batchSize);
+        }
+    }
+    return batches;
+}
+
+int Partitioner::getNumPartitions() const {
+    return numPartitions;
+}
+
+const std::vector<int> &Partitioner::getKeyColumnIds() const {
+    return keyColumnIds;
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "utils/VectorDistance.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
+#include <cmath>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#ifdef __AVX2__
+static inline float horizontalSum(__m256 v)
+{
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+VectorDistance::Metric VectorDistance::parseMetric(const std::string &name)
+{
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    if (lower == "l2" || lower == "euclidean")
+    {
+        return L2;
+    }
+    else if (lower == "cosine")
+    {
+        return COSINE;
+    }
+    else if (lower == "ip" || lower == "inner_product")
+    {
+        return INNER_PRODUCT;
+    }
+    throw InvalidArgumentException("unknown vector distance metric: " + name);
+}
+
+float VectorDistance::dot(const float *a, const float *b, int dimension)
+{
+    int i = 0;
+    float sum = 0;
+#if defined(__AVX512F__)
+    __m512 acc512 = _mm512_setzero_ps();
+    for (; i + 16 <= dimension; i += 16)
+    {
+        acc512 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc512);
+    }
+    sum += _mm512_reduce_add_ps(acc512);
+#endif
+#ifdef __AVX2__
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= dimension; i += 8)
+    {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    sum += horizontalSum(acc);
+#endif
+    for (; i < dimension; i++)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+float VectorDistance::squaredL2(const float *a, const float *b, int dimension)
+{
+    int i = 0;
+    float sum = 0;
+#if defined(__AVX512F__)
+    __m512 acc512 = _mm512_setzero_ps();
+    for (; i + 16 <= dimension; i += 16)
+    {
+        __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+        acc512 = _mm512_fmadd_ps(diff, diff, acc512);
+    }
+    sum += _mm512_reduce_add_ps(acc512);
+#endif
+#ifdef __AVX2__
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= dimension; i += 8)
+    {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(diff, diff));
+    }
+    sum += horizontalSum(acc);
+#endif
+    for (; i < dimension; i++)
+    {
+        float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+float VectorDistance::dotAndNorm(const float *a, const float *b, int dimension, float &norm)
+{
+    int i = 0;
+    float sum = 0;
+    norm = 0;
+#if defined(__AVX512F__)
+    __m512 acc512 = _mm512_setzero_ps();
+    __m512 norm512 = _mm512_setzero_ps();
+    for (; i + 16 <= dimension; i += 16)
+    {
+        __m512 vb = _mm512_loadu_ps(b + i);
+        acc512 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), vb, acc512);
+        norm512 = _mm512_fmadd_ps(vb, vb, norm512);
+    }
+    sum += _mm512_reduce_add_ps(acc512);
+    norm += _mm512_reduce_add_ps(norm512);
+#endif
+#ifdef __AVX2__
+    __m256 acc = _mm256_setzero_ps();
+    __m256 accNorm = _mm256_setzero_ps();
+    for (; i + 8 <= dimension; i += 8)
+    {
+        __m256 vb = _mm256_loadu_ps(b + i);
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), vb));
+        accNorm = _mm256_add_ps(accNorm, _mm256_mul_ps(vb, vb));
+    }
+    sum += horizontalSum(acc);
+    norm += horizontalSum(accNorm);
+#endif
+    for (; i < dimension; i++)
+    {
+        sum += a[i] * b[i];
+        norm += b[i] * b[i];
+    }
+    return sum;
+}
+
+float VectorDistance::distance(Metric metric, const float *a, const float *b, int dimension)
+{
+    float result;
+    distances(metric, a, b, 1, dimension, &result);
+    return result;
+}
+
+void VectorDistance::distances(Metric metric, const float *query, const float *vectors, int numVectors,
+                               int dimension, float *result)
+{
+    switch (metric)
+    {
+        case L2:
+            for (int i = 0; i < numVectors; i++)
+            {
+                result[i] = std::sqrt(squaredL2(query, vectors + (long) i * dimension, dimension));
+            }
+            break;
+        case COSINE:
+        {
+            float queryNorm = std::sqrt(dot(query, query, dimension));
+            for (int i = 0; i < numVectors; i++)
+            {
+                float norm;
+                float product = dotAndNorm(query, vectors + (long) i * dimension, dimension, norm);
+                float denominator = queryNorm * std::sqrt(norm);
+                // the distance to a zero vector is undefined, regard it as the farthest
+                result[i] = denominator == 0 ? 2.0f : 1.0f - product / denominator;
+            }
+            break;
+        }
+        case INNER_PRODUCT:
+            for (int i = 0; i < numVectors; i++)
+            {
+                result[i] = -dot(query, vectors + (long) i * dimension, dimension);
+            }
+            break;
+        default:
+            throw InvalidArgumentException("unknown vector distance metric");
+    }
+}
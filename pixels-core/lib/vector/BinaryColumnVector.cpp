@@ -1,6 +1,7 @@
 #include "vector/BinaryColumnVector.h"
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 
 const float BinaryColumnVector::EXTRA_SPACE_FACTOR = 1.2f;
 
@@ -17,7 +18,7 @@ BinaryColumnVector::BinaryColumnVector(uint64_t len, bool encoding)
       smallBufferNextFree(0)
 {
     std::cout << "Entering BinaryColumnVector constructor" << std::endl;
-    posix_memalign(reinterpret_cast<void**>(&vector), 32, len * sizeof(duckdb::string_t *));
+    posix_memalign(reinterpret_cast<void**>(&vector), 32, len * sizeof(duckdb::string_t));
     posix_memalign(reinterpret_cast<void**>(&start), 32, len * sizeof(int));
     posix_memalign(reinterpret_cast<void**>(&lens), 32, len * sizeof(int));
     memoryUsage += sizeof(int) * (len * 4);
@@ -57,7 +58,8 @@ void BinaryColumnVector::setRef(int elementNum, uint8_t * const &sourceBuf, int
     this->vector[elementNum] = duckdb::string_t((char *)(sourceBuf + startPos), length);
     this->start[elementNum] = 0;
     this->lens[elementNum] = length;
-    this->isNull[elementNum] = (sourceBuf == nullptr);
+    // setRef is used by readers, where isNull points to the isNull bitmap in the chunk buffer
+    // (see ColumnReader::setValid) and must not be written, validity is kept in isValid.
     std::cout << "setRef completed for elementNum: " << elementNum << ", length: " << length << std::endl;
     // 单独使用sourceBuf, startPos, length打印字符内容
     std::cout << "Source string: " << std::string((vector[elementNum].GetData()), length) << std::endl;
@@ -119,7 +121,7 @@ void BinaryColumnVector::ensureSize(uint64_t size, bool preserveData) {
         int* oldLens = lens;
 
         // 为vector分配新的内存
-        posix_memalign(reinterpret_cast<void**>(&vector), 32, size * sizeof(duckdb::string_t*));
+        posix_memalign(reinterpret_cast<void**>(&vector), 32, size * sizeof(duckdb::string_t));
         posix_memalign(reinterpret_cast<void**>(&start), 32, size * sizeof(int));
         posix_memalign(reinterpret_cast<void**>(&lens), 32, size * sizeof(int));
 
@@ -142,4 +144,46 @@ void BinaryColumnVector::ensureSize(uint64_t size, bool preserveData) {
         // 更新列向量的大小
         resize(size);
     }
-}
\ No newline at end of file
+}
+
+void BinaryColumnVector::reset() {
+    ColumnVector::reset();
+    gatheredBuffers.clear();
+    gatheredBufferFree = 0;
+    gatheredBufferSize = 0;
+    memoryUsage -= gatheredMemory;
+    gatheredMemory = 0;
+}
+
+uint8_t * BinaryColumnVector::allocateGathered(int length) {
+    if (gatheredBuffers.empty() || length > gatheredBufferFree) {
+        int size = std::max(DEFAULT_BUFFER_SIZE * 4, length);
+        gatheredBuffers.emplace_back(new uint8_t[size]);
+        gatheredBufferFree = size;
+        gatheredBufferSize = size;
+        gatheredMemory += size;
+        memoryUsage += size;
+    }
+    uint8_t * value = gatheredBuffers.back().get() + (gatheredBufferSize - gatheredBufferFree);
+    gatheredBufferFree -= length;
+    return value;
+}
+
+void BinaryColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<BinaryColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        int length = source->isNull[row] ? 0 : source->lens[row];
+        if (length == 0) {
+            // the nulls and the empty strings may have no data to copy from
+            vector[targetOffset + i] = duckdb::string_t("", 0);
+        } else {
+            uint8_t * value = allocateGathered(length);
+            std::memcpy(value, source->vector[row].GetData(), length);
+            vector[targetOffset + i] = duckdb::string_t(reinterpret_cast<const char*>(value), length);
+        }
+        start[targetOffset + i] = 0;
+        lens[targetOffset + i] = length;
+    }
+}
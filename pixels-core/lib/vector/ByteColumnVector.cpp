@@ -3,16 +3,100 @@
 //
 
 #include "vector/ByteColumnVector.h"
+#include <algorithm>
 
 ByteColumnVector::ByteColumnVector(int len, bool encoding): ColumnVector(len, encoding) {
-    vector = new uint8_t[len];
+    posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, len * sizeof(uint8_t));
+    vector = decodedVector;
+    bitVector = nullptr;
     memoryUsage += (long) sizeof(uint8_t) * len;
 }
 
 void ByteColumnVector::close() {
 	if(!closed) {
 		ColumnVector::close();
-		delete[] vector;
+		if(decodedVector != nullptr) {
+			free(decodedVector);
+		}
+		decodedVector = nullptr;
 		vector = nullptr;
+		bitVector = nullptr;
 	}
-}
\ No newline at end of file
+}
+
+void ByteColumnVector::reset() {
+	ColumnVector::reset();
+	vector = decodedVector;
+}
+
+ByteColumnVector::~ByteColumnVector() {
+	if(!closed) {
+		ByteColumnVector::close();
+	}
+}
+
+void * ByteColumnVector::current() {
+    if(vector == nullptr) {
+        return nullptr;
+    } else {
+        return vector + readIndex;
+    }
+}
+
+void ByteColumnVector::print(int rowCount) {
+    for(int i = 0; i < rowCount; i++) {
+        std::cout << (int) vector[i] << std::endl;
+    }
+}
+
+void ByteColumnVector::add(std::string &value) {
+    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+    if (value == "true") {
+        add(1);
+    } else if (value == "false") {
+        add(0);
+    } else {
+        add(std::stoi(value));
+    }
+}
+
+void ByteColumnVector::add(bool value) {
+    add(value ? 1 : 0);
+}
+
+void ByteColumnVector::add(int64_t value) {
+    add((int) value);
+}
+
+void ByteColumnVector::add(int value) {
+    if (writeIndex >= length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    int index = writeIndex++;
+    vector[index] = (uint8_t) value;
+    isNull[index] = false;
+}
+
+void ByteColumnVector::ensureSize(uint64_t size, bool preserveData) {
+    ColumnVector::ensureSize(size, preserveData);
+    if (length < size) {
+        uint8_t *oldVector = decodedVector;
+        posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, size * sizeof(uint8_t));
+        if (preserveData) {
+            std::copy(vector, vector + length, decodedVector);
+        }
+        free(oldVector);
+        vector = decodedVector;
+        memoryUsage += (long) sizeof(uint8_t) * (size - length);
+        resize(size);
+    }
+}
+
+void ByteColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<ByteColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        vector[targetOffset + i] = source->vector[row];
+    }
+}
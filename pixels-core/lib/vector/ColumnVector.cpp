@@ -4,6 +4,7 @@
 
 #include "vector/ColumnVector.h"
 #include <cmath>
+#include <algorithm>
 ColumnVector::ColumnVector(uint64_t len, bool encoding) {
     writeIndex = 0;
     readIndex = 0;
@@ -20,6 +21,7 @@ void ColumnVector::close() {
 	if(!closed) {
         writeIndex = 0;
         closed = true;
+        pinnedBuffers.clear();
         // TODO: reset other variables
         if (isValid != nullptr) {
             free(isValid);
@@ -31,9 +33,35 @@ void ColumnVector::close() {
 void ColumnVector::reset() {
     writeIndex = 0;
     readIndex = 0;
+    pinnedBuffers.clear();
     // TODO: reset other variables
 }
 
+void ColumnVector::pin(const std::shared_ptr<ByteBuffer> &buffer) {
+    // the pixels of a column chunk are read from the same buffer in sequence
+    if(pinnedBuffers.empty() || pinnedBuffers.back() != buffer) {
+        pinnedBuffers.push_back(buffer);
+    }
+}
+
+void ColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    throw InvalidArgumentException("This columnVector doesn't implement this function.");
+}
+
+void ColumnVector::gatherNulls(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    if (targetOffset + numRows > length) {
+        throw InvalidArgumentException("the gathered rows exceed the capacity of the column vector");
+    }
+    for (int i = 0; i < numRows; i++) {
+        uint8_t null = sources[rowIds[i] >> 32]->isNull[(uint32_t) rowIds[i]];
+        isNull[targetOffset + i] = null;
+        if (null) {
+            noNulls = false;
+        }
+    }
+    writeIndex = std::max(writeIndex, (uint64_t) (targetOffset + numRows));
+}
+
 void ColumnVector::print(int rowCount) {
     throw InvalidArgumentException("This columnVector doesn't implement this function.");
 }
@@ -59,6 +87,9 @@ void ColumnVector::resize(int size) {
 }
 
 bool ColumnVector::checkValid(int index) {
+    if (noNulls) {
+        return true;
+    }
     int byteIndex = index / 8;
     int bitIndex = index % 8;
     auto * isValidByte = (uint8_t *)isValid;
@@ -66,6 +97,9 @@ bool ColumnVector::checkValid(int index) {
 }
 
 uint64_t * ColumnVector::currentValid() {
+    if (noNulls) {
+        return nullptr;
+    }
     return isValid + readIndex / 64;
 }
 
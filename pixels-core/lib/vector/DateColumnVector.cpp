@@ -13,19 +13,26 @@ DateColumnVector::DateColumnVector(uint64_t len, bool encoding): ColumnVector(le
         posix_memalign(reinterpret_cast<void **>(&this->dates), 32,
                        len * sizeof(int32_t));
 	}
+	decodedDates = dates;
 	memoryUsage += (long) sizeof(int) * len;
 }
 
 void DateColumnVector::close() {
 	if(!closed) {
-		if(encoding && dates != nullptr) {
-			free(dates);
+		if(decodedDates != nullptr) {
+			free(decodedDates);
 		}
+		decodedDates = nullptr;
 		dates = nullptr;
 		ColumnVector::close();
 	}
 }
 
+void DateColumnVector::reset() {
+	ColumnVector::reset();
+	dates = decodedDates;
+}
+
 void DateColumnVector::print(int rowCount) {
 	for(int i = 0; i < rowCount; i++) {
 		std::cout<<dates[i]<<std::endl;
@@ -67,13 +74,14 @@ void DateColumnVector::ensureSize(uint64_t size, bool preserveData)
     ColumnVector::ensureSize(size, preserveData);
 	if (length < size)
 	{
-		int *oldVector = dates;
-		posix_memalign(reinterpret_cast<void **>(&dates), 32,
+		int *oldVector = decodedDates;
+		posix_memalign(reinterpret_cast<void **>(&decodedDates), 32,
 						size * sizeof(int32_t));
 		if (preserveData) {
-			std::copy(oldVector, oldVector + length, dates);
+			std::copy(dates, dates + length, decodedDates);
 		}
-		delete[] oldVector;
+		free(oldVector);
+		dates = decodedDates;
 		memoryUsage += (int) sizeof(int) * (size - length);
 		resize(size);
 	}
@@ -121,4 +129,13 @@ void DateColumnVector::add(std::string &value)
 	// std::cout << "test2" << std::endl;
 	isNull[index] = false;
 	// std::cout << "test3" << std::endl;
-}
\ No newline at end of file
+}
+
+void DateColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<DateColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        dates[targetOffset + i] = source->dates[row];
+    }
+}
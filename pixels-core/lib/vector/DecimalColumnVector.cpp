@@ -18,8 +18,8 @@
  * Author: hank
  */
 
-DecimalColumnVector::DecimalColumnVector(int precision, int scale, bool encoding): ColumnVector(VectorizedRowBatch::DEFAULT_SIZE, encoding) {
-    DecimalColumnVector(VectorizedRowBatch::DEFAULT_SIZE, precision, scale, encoding);
+DecimalColumnVector::DecimalColumnVector(int precision, int scale, bool encoding):
+    DecimalColumnVector(VectorizedRowBatch::DEFAULT_SIZE, precision, scale, encoding) {
 }
 
 DecimalColumnVector::DecimalColumnVector(uint64_t len, int precision, int scale, bool encoding): ColumnVector(len, encoding) {
@@ -29,16 +29,26 @@ DecimalColumnVector::DecimalColumnVector(uint64_t len, int precision, int scale,
     this->scale = scale;
     posix_memalign(reinterpret_cast<void **>(&this->vector), 32,
                     len * sizeof(int64_t));
+    this->decodedVector = this->vector;
     memoryUsage += (uint64_t) sizeof(uint64_t) * len;
 }
 
 void DecimalColumnVector::close() {
     if(!closed) {
         ColumnVector::close();
+        if(decodedVector != nullptr) {
+            free(decodedVector);
+        }
+        decodedVector = nullptr;
 		vector = nullptr;
     }
 }
 
+void DecimalColumnVector::reset() {
+    ColumnVector::reset();
+    vector = decodedVector;
+}
+
 void DecimalColumnVector::print(int rowCount) {
 //    throw InvalidArgumentException("not support print Decimalcolumnvector.");
     for(int i = 0; i < rowCount; i++) {
@@ -75,12 +85,14 @@ void DecimalColumnVector::ensureSize(uint64_t size, bool preserveData)
 	if (length < size)
 	{
 		long *oldVector = vector;
+		long *oldDecodedVector = decodedVector;
 		posix_memalign(reinterpret_cast<void **>(&vector), 32,
 						size * sizeof(int64_t));
 		if (preserveData) {
 			std::copy(oldVector, oldVector + length, vector);
 		}
-		delete[] oldVector;
+		decodedVector = vector;
+		free(oldDecodedVector);
 		memoryUsage += (int) sizeof(int) * (size - length);
 		resize(size);
 	}
@@ -106,4 +118,13 @@ void DecimalColumnVector::add(std::string &value)
     isNull[index] = false;
 
     // std::cout << v << std::endl;
-}
\ No newline at end of file
+}
+
+void DecimalColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<DecimalColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        vector[targetOffset + i] = source->vector[row];
+    }
+}
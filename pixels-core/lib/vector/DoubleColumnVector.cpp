@@ -0,0 +1,141 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "vector/DoubleColumnVector.h"
+#include <algorithm>
+
+DoubleColumnVector::DoubleColumnVector(uint64_t len, bool encoding, bool isDouble): ColumnVector(len, encoding) {
+    this->isDouble = isDouble;
+    int width = isDouble ? sizeof(double) : sizeof(float);
+    posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, len * width);
+    doubleVector = nullptr;
+    floatVector = nullptr;
+    setValues(decodedVector);
+    memoryUsage += (long) width * len;
+}
+
+void DoubleColumnVector::close() {
+    if(!closed) {
+        ColumnVector::close();
+        if(decodedVector != nullptr) {
+            free(decodedVector);
+        }
+        decodedVector = nullptr;
+        doubleVector = nullptr;
+        floatVector = nullptr;
+    }
+}
+
+void DoubleColumnVector::reset() {
+    ColumnVector::reset();
+    setValues(decodedVector);
+}
+
+void DoubleColumnVector::print(int rowCount) {
+    for(int i = 0; i < rowCount; i++) {
+        std::cout << (isDouble ? doubleVector[i] : floatVector[i]) << std::endl;
+    }
+}
+
+DoubleColumnVector::~DoubleColumnVector() {
+    if(!closed) {
+        DoubleColumnVector::close();
+    }
+}
+
+void * DoubleColumnVector::current() {
+    if(isDouble) {
+        return doubleVector == nullptr ? nullptr : doubleVector + readIndex;
+    } else {
+        return floatVector == nullptr ? nullptr : floatVector + readIndex;
+    }
+}
+
+void DoubleColumnVector::add(std::string &value) {
+    add(std::stod(value));
+}
+
+void DoubleColumnVector::add(int64_t value) {
+    add((double) value);
+}
+
+void DoubleColumnVector::add(int value) {
+    add((double) value);
+}
+
+void DoubleColumnVector::add(double value) {
+    if (writeIndex >= length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    int index = writeIndex++;
+    if(isDouble) {
+        doubleVector[index] = value;
+    } else {
+        floatVector[index] = (float) value;
+    }
+    isNull[index] = false;
+}
+
+void DoubleColumnVector::ensureSize(uint64_t size, bool preserveData) {
+    ColumnVector::ensureSize(size, preserveData);
+    if (length < size) {
+        int width = isDouble ? sizeof(double) : sizeof(float);
+        uint8_t *oldVector = decodedVector;
+        posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, size * width);
+        if (preserveData) {
+            auto values = reinterpret_cast<uint8_t *>(isDouble ? (void *) doubleVector : (void *) floatVector);
+            std::copy(values, values + length * width, decodedVector);
+        }
+        free(oldVector);
+        setValues(decodedVector);
+        memoryUsage += (long) width * (size - length);
+        resize(size);
+    }
+}
+
+bool DoubleColumnVector::isDoubleVector() {
+    return isDouble;
+}
+
+void DoubleColumnVector::setValues(uint8_t * values) {
+    if(isDouble) {
+        doubleVector = reinterpret_cast<double *>(values);
+    } else {
+        floatVector = reinterpret_cast<float *>(values);
+    }
+}
+
+void DoubleColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    if (isDouble) {
+        for (int i = 0; i < numRows; i++) {
+            auto source = static_cast<DoubleColumnVector *>(sources[rowIds[i] >> 32]);
+            uint32_t row = (uint32_t) rowIds[i];
+            doubleVector[targetOffset + i] = source->doubleVector[row];
+        }
+    } else {
+        for (int i = 0; i < numRows; i++) {
+            auto source = static_cast<DoubleColumnVector *>(sources[rowIds[i] >> 32]);
+            uint32_t row = (uint32_t) rowIds[i];
+            floatVector[targetOffset + i] = source->floatVector[row];
+        }
+    }
+}
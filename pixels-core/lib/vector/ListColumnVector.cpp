@@ -0,0 +1,87 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "vector/ListColumnVector.h"
+
+ListColumnVector::ListColumnVector(uint64_t len, std::shared_ptr<ColumnVector> child, bool encoding)
+    : ColumnVector(len, encoding), child(std::move(child)) {
+    posix_memalign(reinterpret_cast<void **>(&entries), 32, len * sizeof(ListEntry));
+    childCount = 0;
+    memoryUsage += (long) sizeof(ListEntry) * len + this->child->memoryUsage;
+}
+
+ListColumnVector::~ListColumnVector() {
+    if(!closed) {
+        ListColumnVector::close();
+    }
+}
+
+void * ListColumnVector::current() {
+    if(entries == nullptr) {
+        return nullptr;
+    } else {
+        return entries + readIndex;
+    }
+}
+
+void ListColumnVector::print(int rowCount) {
+    for(int i = 0; i < rowCount; i++) {
+        if(!checkValid(i)) {
+            std::cout << "NULL" << std::endl;
+        } else {
+            std::cout << "[" << entries[i].offset << ", +" << entries[i].length << "]" << std::endl;
+        }
+    }
+}
+
+void ListColumnVector::close() {
+    if(!closed) {
+        ColumnVector::close();
+        if(entries != nullptr) {
+            free(entries);
+        }
+        entries = nullptr;
+        child->close();
+    }
+}
+
+void ListColumnVector::reset() {
+    ColumnVector::reset();
+    childCount = 0;
+    child->reset();
+}
+
+void ListColumnVector::addRow(int length) {
+    if(writeIndex >= this->length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    entries[writeIndex].offset = childCount;
+    entries[writeIndex].length = length;
+    childCount += length;
+    isNull[writeIndex++] = false;
+}
+
+void ListColumnVector::addNull() {
+    if(writeIndex < length) {
+        entries[writeIndex].offset = childCount;
+        entries[writeIndex].length = 0;
+    }
+    ColumnVector::addNull();
+}
@@ -16,6 +16,8 @@ LongColumnVector::LongColumnVector(uint64_t len, bool encoding, bool isLong): Co
                        len * sizeof(int32_t));
     }
 
+    decodedLongVector = longVector;
+    decodedIntVector = intVector;
     this->isLong = isLong;
     memoryUsage += (long) sizeof(long) * len;
 }
@@ -23,17 +25,25 @@ LongColumnVector::LongColumnVector(uint64_t len, bool encoding, bool isLong): Co
 void LongColumnVector::close() {
 	if(!closed) {
 		ColumnVector::close();
-		if(encoding && longVector != nullptr) {
-			free(longVector);
+		if(decodedLongVector != nullptr) {
+			free(decodedLongVector);
 		}
-		if(encoding && intVector != nullptr) {
-			free(intVector);
+		if(decodedIntVector != nullptr) {
+			free(decodedIntVector);
 		}
+		decodedLongVector = nullptr;
+		decodedIntVector = nullptr;
 		longVector = nullptr;
 		intVector = nullptr;
 	}
 }
 
+void LongColumnVector::reset() {
+	ColumnVector::reset();
+	longVector = decodedLongVector;
+	intVector = decodedIntVector;
+}
+
 void LongColumnVector::print(int rowCount) {
 	throw InvalidArgumentException("not support print longcolumnvector.");
 //    for(int i = 0; i < rowCount; i++) {
@@ -87,7 +97,7 @@ void LongColumnVector::add(int64_t value) {
     if(isLong) {
         longVector[index] = value;
     } else {
-        intVector[index] = value;
+        intVector[index] = (int) value;
     }
     isNull[index] = false;
 }
@@ -100,7 +110,7 @@ void LongColumnVector::add(int value) {
     if(isLong) {
         longVector[index] = value;
     } else {
-        intVector[index] = value;
+        intVector[index] = (int) value;
     }
     isNull[index] = false;
 }
@@ -109,23 +119,25 @@ void LongColumnVector::ensureSize(uint64_t size, bool preserveData) {
     ColumnVector::ensureSize(size, preserveData);
     if (length < size) {
         if (isLong) {
-            long *oldVector = longVector;
-            posix_memalign(reinterpret_cast<void **>(&longVector), 32,
+            long *oldVector = decodedLongVector;
+            posix_memalign(reinterpret_cast<void **>(&decodedLongVector), 32,
                            size * sizeof(int64_t));
             if (preserveData) {
-                std::copy(oldVector, oldVector + length, longVector);
+                std::copy(longVector, longVector + length, decodedLongVector);
             }
-            delete[] oldVector;
+            free(oldVector);
+            longVector = decodedLongVector;
             memoryUsage += (long) sizeof(long) * (size - length);
             resize(size);
         } else {
-            long *oldVector = intVector;
-            posix_memalign(reinterpret_cast<void **>(&intVector), 32,
+            int *oldVector = decodedIntVector;
+            posix_memalign(reinterpret_cast<void **>(&decodedIntVector), 32,
                            size * sizeof(int32_t));
             if (preserveData) {
-                std::copy(oldVector, oldVector + length, intVector);
+                std::copy(intVector, intVector + length, decodedIntVector);
             }
-            delete[] oldVector;
+            free(oldVector);
+            intVector = decodedIntVector;
             memoryUsage += (long) sizeof(int) * (size - length);
             resize(size);
         }
@@ -135,3 +147,20 @@ void LongColumnVector::ensureSize(uint64_t size, bool preserveData) {
 bool LongColumnVector::isLongVectore() {
     return isLong;
 }
+
+void LongColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    if (isLong) {
+        for (int i = 0; i < numRows; i++) {
+            auto source = static_cast<LongColumnVector *>(sources[rowIds[i] >> 32]);
+            uint32_t row = (uint32_t) rowIds[i];
+            longVector[targetOffset + i] = source->longVector[row];
+        }
+    } else {
+        for (int i = 0; i < numRows; i++) {
+            auto source = static_cast<LongColumnVector *>(sources[rowIds[i] >> 32]);
+            uint32_t row = (uint32_t) rowIds[i];
+            intVector[targetOffset + i] = source->intVector[row];
+        }
+    }
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "vector/LongDecimalColumnVector.h"
+#include <algorithm>
+
+LongDecimalColumnVector::LongDecimalColumnVector(uint64_t len, int precision, int scale, bool encoding): ColumnVector(len, encoding) {
+    this->precision = precision;
+    this->scale = scale;
+    posix_memalign(reinterpret_cast<void **>(&this->decodedVector), 32, len * 2 * sizeof(uint64_t));
+    this->vector = this->decodedVector;
+    memoryUsage += (uint64_t) 2 * sizeof(uint64_t) * len;
+}
+
+void LongDecimalColumnVector::close() {
+    if(!closed) {
+        ColumnVector::close();
+        if(decodedVector != nullptr) {
+            free(decodedVector);
+        }
+        decodedVector = nullptr;
+        vector = nullptr;
+    }
+}
+
+void LongDecimalColumnVector::reset() {
+    ColumnVector::reset();
+    vector = decodedVector;
+}
+
+LongDecimalColumnVector::~LongDecimalColumnVector() {
+    if(!closed) {
+        LongDecimalColumnVector::close();
+    }
+}
+
+void LongDecimalColumnVector::print(int rowCount) {
+    for(int i = 0; i < rowCount; i++) {
+        std::cout << toString(get(i), scale) << std::endl;
+    }
+}
+
+void * LongDecimalColumnVector::current() {
+    if(vector == nullptr) {
+        return nullptr;
+    } else {
+        return vector + 2 * readIndex;
+    }
+}
+
+int LongDecimalColumnVector::getPrecision() {
+    return precision;
+}
+
+int LongDecimalColumnVector::getScale() {
+    return scale;
+}
+
+void LongDecimalColumnVector::ensureSize(uint64_t size, bool preserveData) {
+    ColumnVector::ensureSize(size, preserveData);
+    if (length < size) {
+        uint64_t *oldDecodedVector = decodedVector;
+        posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, size * 2 * sizeof(uint64_t));
+        if (preserveData) {
+            std::copy(vector, vector + 2 * length, decodedVector);
+        }
+        vector = decodedVector;
+        free(oldDecodedVector);
+        memoryUsage += (uint64_t) 2 * sizeof(uint64_t) * (size - length);
+        resize(size);
+    }
+}
+
+void LongDecimalColumnVector::add(std::string &value) {
+    if (writeIndex >= length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    int index = writeIndex++;
+    set(index, parse(value, scale));
+    isNull[index] = false;
+}
+
+void LongDecimalColumnVector::add(int64_t value) {
+    if (writeIndex >= length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    int index = writeIndex++;
+    set(index, (__int128) value);
+    isNull[index] = false;
+}
+
+void LongDecimalColumnVector::add(int value) {
+    add((int64_t) value);
+}
+
+void LongDecimalColumnVector::set(int index, __int128 value) {
+    vector[2 * index] = (uint64_t) value;
+    vector[2 * index + 1] = (uint64_t) (value >> 64);
+}
+
+__int128 LongDecimalColumnVector::get(int index) {
+    return (__int128) (((unsigned __int128) vector[2 * index + 1] << 64) | vector[2 * index]);
+}
+
+__int128 LongDecimalColumnVector::parse(const std::string &value, int scale) {
+    size_t pos = 0;
+    bool negative = false;
+    if (pos < value.size() && (value[pos] == '-' || value[pos] == '+')) {
+        negative = value[pos] == '-';
+        pos++;
+    }
+    __int128 result = 0;
+    int fractionDigits = -1;
+    bool hasDigit = false;
+    for (; pos < value.size(); pos++) {
+        char c = value[pos];
+        if (c == '.' && fractionDigits < 0) {
+            fractionDigits = 0;
+        } else if (c >= '0' && c <= '9') {
+            hasDigit = true;
+            // the digits beyond the scale are truncated
+            if (fractionDigits < scale) {
+                result = result * 10 + (c - '0');
+                if (fractionDigits >= 0) {
+                    fractionDigits++;
+                }
+            }
+        } else {
+            throw InvalidArgumentException("invalid decimal value: " + value);
+        }
+    }
+    if (!hasDigit) {
+        throw InvalidArgumentException("invalid decimal value: " + value);
+    }
+    for (int i = std::max(fractionDigits, 0); i < scale; i++) {
+        result *= 10;
+    }
+    return negative ? -result : result;
+}
+
+std::string LongDecimalColumnVector::toString(__int128 unscaledValue, int scale) {
+    bool negative = unscaledValue < 0;
+    unsigned __int128 v = negative ? -(unsigned __int128) unscaledValue : (unsigned __int128) unscaledValue;
+    std::string digits;
+    do {
+        digits.push_back((char) ('0' + (int) (v % 10)));
+        v /= 10;
+    } while (v != 0);
+    while ((int) digits.size() <= scale) {
+        digits.push_back('0');
+    }
+    std::reverse(digits.begin(), digits.end());
+    if (scale > 0) {
+        digits.insert(digits.size() - scale, ".");
+    }
+    return negative ? "-" + digits : digits;
+}
+
+void LongDecimalColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<LongDecimalColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        set(targetOffset + i, source->get(row));
+    }
+}
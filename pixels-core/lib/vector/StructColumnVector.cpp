@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "vector/StructColumnVector.h"
+
+StructColumnVector::StructColumnVector(uint64_t len, std::vector<std::shared_ptr<ColumnVector>> fields, bool encoding)
+    : ColumnVector(len, encoding), fields(std::move(fields)) {
+    for(const auto& field : this->fields) {
+        memoryUsage += field->memoryUsage;
+    }
+}
+
+StructColumnVector::~StructColumnVector() {
+    if(!closed) {
+        StructColumnVector::close();
+    }
+}
+
+void * StructColumnVector::current() {
+    return nullptr;
+}
+
+void StructColumnVector::print(int rowCount) {
+    for(int i = 0; i < rowCount; i++) {
+        std::cout << (checkValid(i) ? "{...}" : "NULL") << std::endl;
+    }
+}
+
+void StructColumnVector::close() {
+    if(!closed) {
+        ColumnVector::close();
+        for(const auto& field : fields) {
+            field->close();
+        }
+    }
+}
+
+void StructColumnVector::reset() {
+    ColumnVector::reset();
+    for(const auto& field : fields) {
+        field->reset();
+    }
+}
+
+void StructColumnVector::addRow() {
+    if(writeIndex >= length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    isNull[writeIndex++] = false;
+}
+
+void StructColumnVector::addNull() {
+    ColumnVector::addNull();
+    for(const auto& field : fields) {
+        field->addNull();
+    }
+}
+
+void StructColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    // the fields of a null struct are null, so they are gathered in the same way
+    std::vector<ColumnVector *> fieldSources(sources.size());
+    for(int i = 0; i < fields.size(); i++) {
+        for(int j = 0; j < sources.size(); j++) {
+            fieldSources[j] = static_cast<StructColumnVector *>(sources[j])->fields[i].get();
+        }
+        fields[i]->gather(fieldSources, rowIds, numRows, targetOffset);
+    }
+}
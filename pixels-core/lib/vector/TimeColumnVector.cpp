@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "vector/TimeColumnVector.h"
+
+TimeColumnVector::TimeColumnVector(uint64_t len, int precision, bool encoding): ColumnVector(len, encoding) {
+	this->precision = precision;
+	posix_memalign(reinterpret_cast<void **>(&times), 32,
+	               len * sizeof(int32_t));
+	decodedTimes = times;
+	memoryUsage += (long) sizeof(int) * len;
+}
+
+void TimeColumnVector::close() {
+	if(!closed) {
+		if(decodedTimes != nullptr) {
+			free(decodedTimes);
+		}
+		decodedTimes = nullptr;
+		times = nullptr;
+		ColumnVector::close();
+	}
+}
+
+void TimeColumnVector::reset() {
+	ColumnVector::reset();
+	times = decodedTimes;
+}
+
+void TimeColumnVector::print(int rowCount) {
+	for(int i = 0; i < rowCount; i++) {
+		std::cout<<times[i]<<std::endl;
+	}
+}
+
+TimeColumnVector::~TimeColumnVector() {
+	if(!closed) {
+		TimeColumnVector::close();
+	}
+}
+
+/**
+ * Set a row from a value, which is the milliseconds from 00:00:00.
+ *
+ * @param elementNum
+ * @param millis
+ */
+void TimeColumnVector::set(int elementNum, int millis) {
+	if(elementNum >= writeIndex) {
+		writeIndex = elementNum + 1;
+	}
+	times[elementNum] = millis;
+}
+
+void * TimeColumnVector::current() {
+	if(times == nullptr) {
+		return nullptr;
+	} else {
+		return times + readIndex;
+	}
+}
+
+void TimeColumnVector::ensureSize(uint64_t size, bool preserveData)
+{
+	ColumnVector::ensureSize(size, preserveData);
+	if (length < size)
+	{
+		int *oldVector = decodedTimes;
+		posix_memalign(reinterpret_cast<void **>(&decodedTimes), 32,
+		               size * sizeof(int32_t));
+		if (preserveData) {
+			std::copy(times, times + length, decodedTimes);
+		}
+		free(oldVector);
+		times = decodedTimes;
+		memoryUsage += (int) sizeof(int) * (size - length);
+		resize(size);
+	}
+}
+
+void TimeColumnVector::add(std::string &value)
+{
+	if (value.size() < 8 || value[2] != ':' || value[5] != ':')
+	{
+		throw InvalidArgumentException("invalid time value: " + value);
+	}
+	int hour   = (value[0] - '0') * 10 + (value[1] - '0');
+	int minute = (value[3] - '0') * 10 + (value[4] - '0');
+	int second = (value[6] - '0') * 10 + (value[7] - '0');
+	int millis = 0;
+	// the fraction digits beyond milliseconds are truncated
+	int scale = 100;
+	for (size_t i = 9; value.size() > 8 && value[8] == '.' && i < value.size() && scale > 0; i++, scale /= 10)
+	{
+		millis += (value[i] - '0') * scale;
+	}
+	add(((hour * 60 + minute) * 60 + second) * 1000 + millis);
+}
+
+void TimeColumnVector::add(int value)
+{
+	if (writeIndex >= length)
+	{
+		ensureSize(writeIndex * 2, true);
+	}
+	int index = writeIndex ++;
+	times[index] = value;
+	isNull[index] = false;
+}
+
+void TimeColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<TimeColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        times[targetOffset + i] = source->times[row];
+    }
+}
@@ -4,8 +4,8 @@
 
 #include "vector/TimestampColumnVector.h"
 
-TimestampColumnVector::TimestampColumnVector(int precision, bool encoding): ColumnVector(VectorizedRowBatch::DEFAULT_SIZE, encoding) {
-    TimestampColumnVector(VectorizedRowBatch::DEFAULT_SIZE, precision, encoding);
+TimestampColumnVector::TimestampColumnVector(int precision, bool encoding):
+    TimestampColumnVector(VectorizedRowBatch::DEFAULT_SIZE, precision, encoding) {
 }
 
 TimestampColumnVector::TimestampColumnVector(uint64_t len, int precision, bool encoding): ColumnVector(len, encoding) {
@@ -19,6 +19,7 @@ TimestampColumnVector::TimestampColumnVector(uint64_t len, int precision, bool e
     this->times = nullptr;
     posix_memalign(reinterpret_cast<void **>(&this->times), 64,
                     len * sizeof(long));
+    this->decodedTimes = this->times;
     memoryUsage += (long) sizeof(long) * len;
 }
 
@@ -26,13 +27,19 @@ TimestampColumnVector::TimestampColumnVector(uint64_t len, int precision, bool e
 void TimestampColumnVector::close() {
     if(!closed) {
         ColumnVector::close();
-        if(encoding && this->times != nullptr) {
-            free(this->times);
+        if(this->decodedTimes != nullptr) {
+            free(this->decodedTimes);
         }
+        this->decodedTimes = nullptr;
         this->times = nullptr;
     }
 }
 
+void TimestampColumnVector::reset() {
+    ColumnVector::reset();
+    times = decodedTimes;
+}
+
 void TimestampColumnVector::print(int rowCount) {
     throw InvalidArgumentException("not support print longcolumnvector.");
 //    for(int i = 0; i < rowCount; i++) {
@@ -75,13 +82,14 @@ void TimestampColumnVector::ensureSize(uint64_t size, bool preserveData)
     ColumnVector::ensureSize(size, preserveData);
 	if (length < size)
 	{
-		long *oldVector = times;
-		posix_memalign(reinterpret_cast<void **>(&times), 64,
+		long *oldVector = decodedTimes;
+		posix_memalign(reinterpret_cast<void **>(&decodedTimes), 64,
 						size * sizeof(int64_t));
 		if (preserveData) {
-			std::copy(oldVector, oldVector + length, times);
+			std::copy(times, times + length, decodedTimes);
 		}
-		delete[] oldVector;
+		free(oldVector);
+		times = decodedTimes;
 		memoryUsage += (int) sizeof(long) * (size - length);
 		resize(size);
 	}
@@ -140,3 +148,12 @@ void TimestampColumnVector::add(std::string &value)
     // std::cout << "## " << v << std::endl;
 }
 
+
+void TimestampColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<TimestampColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        times[targetOffset + i] = source->times[row];
+    }
+}
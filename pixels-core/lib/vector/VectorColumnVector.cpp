@@ -0,0 +1,131 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "vector/VectorColumnVector.h"
+#include <algorithm>
+#include <cstring>
+
+VectorColumnVector::VectorColumnVector(uint64_t len, int dimension, bool encoding): ColumnVector(len, encoding) {
+    this->dimension = dimension;
+    posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, len * dimension * sizeof(float));
+    vector = decodedVector;
+    memoryUsage += (long) sizeof(float) * dimension * len;
+}
+
+void VectorColumnVector::close() {
+    if(!closed) {
+        ColumnVector::close();
+        if(decodedVector != nullptr) {
+            free(decodedVector);
+        }
+        decodedVector = nullptr;
+        vector = nullptr;
+    }
+}
+
+void VectorColumnVector::reset() {
+    ColumnVector::reset();
+    vector = decodedVector;
+}
+
+void VectorColumnVector::print(int rowCount) {
+    for(int i = 0; i < rowCount; i++) {
+        std::cout << "[";
+        for(int j = 0; j < dimension; j++) {
+            std::cout << (j == 0 ? "" : ", ") << vector[(long) i * dimension + j];
+        }
+        std::cout << "]" << std::endl;
+    }
+}
+
+VectorColumnVector::~VectorColumnVector() {
+    if(!closed) {
+        VectorColumnVector::close();
+    }
+}
+
+void * VectorColumnVector::current() {
+    if(vector == nullptr) {
+        return nullptr;
+    } else {
+        return vector + (long) readIndex * dimension;
+    }
+}
+
+int VectorColumnVector::getDimension() {
+    return dimension;
+}
+
+void VectorColumnVector::add(std::string &value) {
+    std::vector<float> values;
+    values.reserve(dimension);
+    size_t pos = value.find('[');
+    size_t end = value.rfind(']');
+    if (pos == std::string::npos || end == std::string::npos || end < pos) {
+        throw InvalidArgumentException("invalid vector value: " + value);
+    }
+    pos++;
+    while (pos < end) {
+        size_t next = value.find(',', pos);
+        if (next == std::string::npos || next > end) {
+            next = end;
+        }
+        values.emplace_back(std::stof(value.substr(pos, next - pos)));
+        pos = next + 1;
+    }
+    if ((int) values.size() != dimension) {
+        throw InvalidArgumentException("the vector " + value + " does not have " + std::to_string(dimension) + " dimensions");
+    }
+    add(values.data());
+}
+
+void VectorColumnVector::add(const float * value) {
+    if (writeIndex >= length) {
+        ensureSize(writeIndex * 2, true);
+    }
+    int index = writeIndex++;
+    std::memcpy(vector + (long) index * dimension, value, dimension * sizeof(float));
+    isNull[index] = false;
+}
+
+void VectorColumnVector::ensureSize(uint64_t size, bool preserveData) {
+    ColumnVector::ensureSize(size, preserveData);
+    if (length < size) {
+        float *oldDecodedVector = decodedVector;
+        posix_memalign(reinterpret_cast<void **>(&decodedVector), 32, size * dimension * sizeof(float));
+        if (preserveData) {
+            std::copy(vector, vector + length * dimension, decodedVector);
+        }
+        vector = decodedVector;
+        free(oldDecodedVector);
+        memoryUsage += (long) sizeof(float) * dimension * (size - length);
+        resize(size);
+    }
+}
+
+void VectorColumnVector::gather(const std::vector<ColumnVector *> &sources, const uint64_t *rowIds, int numRows, int targetOffset) {
+    gatherNulls(sources, rowIds, numRows, targetOffset);
+    for (int i = 0; i < numRows; i++) {
+        auto source = static_cast<VectorColumnVector *>(sources[rowIds[i] >> 32]);
+        uint32_t row = (uint32_t) rowIds[i];
+        std::memcpy(vector + (long) (targetOffset + i) * dimension, source->vector + (long) row * dimension, dimension * sizeof(float));
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "writer/ArrayColumnWriter.h"
+#include "writer/ColumnWriterBuilder.h"
+
+ArrayColumnWriter::ArrayColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption), elementWriter(ColumnWriterBuilder::newColumnWriter(type->getChildren().at(0), writerOption))
+{
+    // the lengths of the null rows are always written
+    getColumnChunkIndexPtr()->set_nullspadding(true);
+}
+
+int ArrayColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::dynamic_pointer_cast<ListColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    if (size > 0 && columnVector->entries[0].offset != 0)
+    {
+        throw std::invalid_argument("The elements of the list vector must start from the beginning of the child vector");
+    }
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartArray(columnVector, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartArray(columnVector, curPartLength, curPartOffset);
+
+    int dataLength = outputStream->getWritePos();
+    int numElements = size > 0 ? (int) (columnVector->entries[size - 1].offset + columnVector->entries[size - 1].length) : 0;
+    if (numElements > 0)
+    {
+        dataLength += elementWriter->write(columnVector->child, numElements);
+    }
+    return dataLength;
+}
+
+void ArrayColumnWriter::writeCurPartArray(std::shared_ptr<ListColumnVector> columnVector, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        int length = 0;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+        }
+        else
+        {
+            length = (int) columnVector->entries[i + curPartOffset].length;
+            pixelStatRecorder->increment();
+        }
+        if (byteOrder == ByteOrder::PIXELS_LITTLE_ENDIAN)
+        {
+            encodingUtils.writeIntLE(outputStream, length);
+        }
+        else
+        {
+            encodingUtils.writeIntBE(outputStream, length);
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool ArrayColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    return true;
+}
+
+std::vector<std::shared_ptr<ColumnWriter>> ArrayColumnWriter::getChildWriters()
+{
+    return {elementWriter};
+}
+
+void ArrayColumnWriter::reset()
+{
+    elementWriter->reset();
+    ColumnWriter::reset();
+    getColumnChunkIndexPtr()->set_nullspadding(true);
+}
+
+void ArrayColumnWriter::close()
+{
+    elementWriter->close();
+    ColumnWriter::close();
+}
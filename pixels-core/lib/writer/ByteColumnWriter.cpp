@@ -16,4 +16,156 @@
  * You should have received a copy of the Affero GNU General Public
  * License along with Pixels.  If not, see
  * <https://www.gnu.org/licenses/>.
- */
\ No newline at end of file
+ */
+
+#include "writer/ByteColumnWriter.h"
+#include "utils/BitUtils.h"
+#include "encoding/EncodingSelector.h"
+
+ByteColumnWriter::ByteColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption), curPixelVector(pixelStride)
+{
+    isBoolean = type->getCategory() == TypeDescription::Category::BOOLEAN;
+    // on EL2, run-length encoding is a candidate and the encoding selector decides whether to use it
+    runlengthEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    encodingDecided = !runlengthEncoding;
+    if (runlengthEncoding)
+    {
+        encoder = std::make_unique<RunLenIntEncoder>();
+    }
+}
+
+int ByteColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::dynamic_pointer_cast<ByteColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    uint8_t* values = columnVector->vector;
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    // do the calculation to partition the vector into current pixel and next one
+    // doing this pre-calculation to eliminate branch prediction inside the for loop
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartByte(columnVector, values, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartByte(columnVector, values, curPartLength, curPartOffset);
+
+    return outputStream->getWritePos();
+}
+
+void ByteColumnWriter::reset()
+{
+    ColumnWriter::reset();
+    // the encoding of the next column chunk is chosen again
+    runlengthEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    encodingDecided = !runlengthEncoding;
+}
+
+void ByteColumnWriter::close()
+{
+    if (runlengthEncoding && encoder)
+    {
+        encoder->clear();
+    }
+    ColumnWriter::close();
+}
+
+void ByteColumnWriter::writeCurPartByte(std::shared_ptr<ByteColumnVector> columnVector, uint8_t* values, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+            if (nullsPadding)
+            {
+                // padding 0 for nulls
+                curPixelVector[curPixelVectorIndex++] = 0L;
+            }
+        }
+        else
+        {
+            // BYTE is signed, booleans are normalized to 0 or 1
+            curPixelVector[curPixelVectorIndex++] = isBoolean ? (values[i + curPartOffset] != 0) :
+                                                    (long) (int8_t) values[i + curPartOffset];
+            pixelStatRecorder->increment();
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool ByteColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    if (writerOption->getEncodingLevel().ge(EncodingLevel::Level::EL2))
+    {
+        return false;
+    }
+    return writerOption->isNullsPadding();
+}
+
+void ByteColumnWriter::newPixel()
+{
+    // write out current pixel vector
+    if (runlengthEncoding)
+    {
+        std::vector<byte> buffer(RunLenIntEncoder::getMaxEncodedSize(curPixelVectorIndex));
+        int resLen;
+        encoder->encode(curPixelVector.data(), buffer.data(), curPixelVectorIndex, resLen);
+        if (!encodingDecided)
+        {
+            runlengthEncoding = (isBoolean ?
+                    EncodingSelector::selectBooleanEncoding((curPixelVectorIndex + 7) / 8, resLen) :
+                    EncodingSelector::selectIntegerEncoding(curPixelVectorIndex, curPixelVectorIndex, resLen)) ==
+                                pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH;
+            encodingDecided = true;
+        }
+        if (runlengthEncoding)
+        {
+            outputStream->putBytes(buffer.data(), resLen);
+        }
+    }
+    if (!runlengthEncoding)
+    {
+        std::vector<uint8_t> values(curPixelVector.begin(), curPixelVector.begin() + curPixelVectorIndex);
+        if (isBoolean)
+        {
+            // the bits of each pixel start from a new byte, so that the reader can unpack them in bytes
+            auto bits = BitUtils::bitWiseCompact(values, curPixelVectorIndex, byteOrder);
+            outputStream->putBytes(bits.data(), bits.size());
+        }
+        else
+        {
+            outputStream->putBytes(values.data(), values.size());
+        }
+    }
+
+    ColumnWriter::newPixel();
+}
+
+pixels::proto::ColumnEncoding ByteColumnWriter::getColumnChunkEncoding()
+{
+    pixels::proto::ColumnEncoding columnEncoding;
+    if (runlengthEncoding)
+    {
+        columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH);
+    }
+    else
+    {
+        columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE);
+    }
+    return columnEncoding;
+}
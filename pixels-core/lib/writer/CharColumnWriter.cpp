@@ -1,19 +1,123 @@
-/*
- * Copyright 2024 PixelsDB.
- *
- * This file is part of Pixels.
- *
- * Pixels is free software: you can redistribute it and/or modify
- * it under the terms of the Affero GNU General Public License as
- * published by the Free Software Foundation, either version 3 of
- * the License, or (at your option) any later version.
- *
- * Pixels is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * Affero GNU General Public License for more details.
- *
- * You should have received a copy of the Affero GNU General Public
- * License along with Pixels.  If not, see
- * <https://www.gnu.org/licenses/>.
- */
\ No newline at end of file
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "writer/CharColumnWriter.h"
+#include "exception/InvalidArgumentException.h"
+#include <cstring>
+
+CharColumnWriter::CharColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption), maxLength(type->getMaxLength()), curPixelContent((long) pixelStride * type->getMaxLength())
+{
+}
+
+int CharColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::dynamic_pointer_cast<BinaryColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    duckdb::string_t* values = columnVector->vector;
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    // do the calculation to partition the vector into current pixel and next one
+    // doing this pre-calculation to eliminate branch prediction inside the for loop
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartChar(columnVector, values, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartChar(columnVector, values, curPartLength, curPartOffset);
+
+    return outputStream->getWritePos();
+}
+
+void CharColumnWriter::writeCurPartChar(std::shared_ptr<BinaryColumnVector> columnVector, duckdb::string_t* values, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        uint8_t* dest = curPixelContent.data() + (long) curPixelVectorIndex * maxLength;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+            if (nullsPadding)
+            {
+                // padding spaces for nulls
+                std::memset(dest, ' ', maxLength);
+                curPixelVectorIndex++;
+            }
+        }
+        else
+        {
+            const duckdb::string_t& value = values[i + curPartOffset];
+            const char* data = value.GetData();
+            int length = (int) value.GetSize();
+            // trailing spaces are not significant in char(n), any other byte beyond n would be lost
+            while (length > maxLength && data[length - 1] == ' ')
+            {
+                length--;
+            }
+            if (length > maxLength)
+            {
+                throw InvalidArgumentException("CharColumnWriter: a value of " + std::to_string(value.GetSize()) +
+                                               " bytes does not fit in char(" + std::to_string(maxLength) + ")");
+            }
+            std::memcpy(dest, data, length);
+            std::memset(dest + length, ' ', maxLength - length);
+            curPixelVectorIndex++;
+            pixelStatRecorder->updateString(data, length, 1);
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool CharColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    if (writerOption->getEncodingLevel().ge(EncodingLevel::Level::EL2))
+    {
+        return false;
+    }
+    return writerOption->isNullsPadding();
+}
+
+void CharColumnWriter::newPixel()
+{
+    // write out current pixel values
+    outputStream->putBytes(curPixelContent.data(), (long) curPixelVectorIndex * maxLength);
+
+    ColumnWriter::newPixel();
+}
+
+pixels::proto::ColumnEncoding CharColumnWriter::getColumnChunkEncoding()
+{
+    pixels::proto::ColumnEncoding columnEncoding;
+    columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_FIXED_WIDTH);
+    return columnEncoding;
+}
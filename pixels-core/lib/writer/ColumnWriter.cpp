@@ -24,26 +24,41 @@
 #include <utils/ConfigFactory.h>
 #include "utils/BitUtils.h"
 #include "writer/ColumnWriter.h"
+#include "utils/BloomFilter.h"
+#include <algorithm>
 
 const int ColumnWriter::ISNULL_ALIGNMENT = std::stoi(ConfigFactory::Instance().getProperty("isnull.bitmap.alignment"));
 const std::vector<uint8_t> ColumnWriter::ISNULL_PADDING_BUFFER(ColumnWriter::ISNULL_ALIGNMENT, 0);
 
+namespace {
+    // the hashes are deduplicated from this many on, so that small column chunks are not sorted repeatedly
+    const size_t MIN_BLOOM_FILTER_DEDUP_HASHES = 4096;
+    // the upper bound of the distinct hashes kept for a column chunk, 8MB
+    const size_t MAX_BLOOM_FILTER_HASHES = 1 << 20;
+}
+
 
 
-std::vector<uint8_t> ColumnWriter::getColumnChunkContent() const {
-    auto begin = outputStream->getPointer() + outputStream->getReadPos();
-    auto end = outputStream->getPointer() + outputStream->getWritePos();
-    return std::vector<uint8_t>(begin, end);
+void ColumnWriter::getColumnChunkContent(std::vector<struct iovec> &buffers) const {
+    outputStream->getBuffers(buffers);
 }
 
 int ColumnWriter::getColumnChunkSize() const {
-    return static_cast<int>(outputStream->getWritePos() - outputStream->getReadPos());
+    return static_cast<int>(outputStream->getWritePos());
 }
 
 pixels::proto::ColumnChunkIndex ColumnWriter::getColumnChunkIndex() {
     return *columnChunkIndex;
 //    return columnChunkIndex.get();
 }
+pixels::proto::ColumnStatistic ColumnWriter::getColumnChunkStat() const {
+    return columnChunkStatRecorder->serialize();
+}
+
+const StatsRecorder& ColumnWriter::getColumnChunkStatRecorder() const {
+    return *columnChunkStatRecorder;
+}
+
 std::shared_ptr<pixels::proto::ColumnChunkIndex> ColumnWriter::getColumnChunkIndexPtr() {
     return columnChunkIndex;
 }
@@ -66,42 +81,134 @@ void ColumnWriter::flush() {
         isNullOffset += alignBytes;
     }
     columnChunkIndex->set_isnulloffset(isNullOffset);
-    outputStream->putBytes(isNullStream->getPointer() + isNullStream->getReadPos(), isNullStream->getWritePos() - isNullStream->getReadPos());
+    std::vector<struct iovec> isNullBuffers;
+    isNullStream->getBuffers(isNullBuffers);
+    for (const auto &buffer : isNullBuffers) {
+        outputStream->putBytes(static_cast<const uint8_t *>(buffer.iov_base), buffer.iov_len);
+    }
+    if (bloomFilterEnabled) {
+        if (bloomFilter == nullptr) {
+            std::sort(bloomFilterHashes.begin(), bloomFilterHashes.end());
+            bloomFilterHashes.erase(std::unique(bloomFilterHashes.begin(), bloomFilterHashes.end()), bloomFilterHashes.end());
+            bloomFilter = std::make_unique<BloomFilter>(bloomFilterHashes.size(), bloomFilterFpp);
+            for (uint64_t hash : bloomFilterHashes) {
+                bloomFilter->insert(hash);
+            }
+        }
+        columnChunkIndex->set_bloomfilter(bloomFilter->serialize());
+        std::vector<uint64_t>().swap(bloomFilterHashes);
+        bloomFilterDistinctHashes = 0;
+        bloomFilter.reset();
+    }
+}
+
+void ColumnWriter::compactBloomFilterHashes() {
+    if (bloomFilter != nullptr || bloomFilterHashes.size() < MIN_BLOOM_FILTER_DEDUP_HASHES ||
+        bloomFilterHashes.size() < 2 * bloomFilterDistinctHashes) {
+        return;
+    }
+    // only the new hashes are sorted, and merged with the distinct ones
+    auto distinctEnd = bloomFilterHashes.begin() + bloomFilterDistinctHashes;
+    std::sort(distinctEnd, bloomFilterHashes.end());
+    std::inplace_merge(bloomFilterHashes.begin(), distinctEnd, bloomFilterHashes.end());
+    bloomFilterHashes.erase(std::unique(bloomFilterHashes.begin(), bloomFilterHashes.end()), bloomFilterHashes.end());
+    bloomFilterDistinctHashes = bloomFilterHashes.size();
+    if (bloomFilterDistinctHashes > MAX_BLOOM_FILTER_HASHES) {
+        // the column chunk is expected to have as many distinct values again, the false positive
+        // probability rises above bloomFilterFpp if it has more
+        bloomFilter = std::make_unique<BloomFilter>(2 * bloomFilterDistinctHashes, bloomFilterFpp);
+        for (uint64_t hash : bloomFilterHashes) {
+            bloomFilter->insert(hash);
+        }
+        std::vector<uint64_t>().swap(bloomFilterHashes);
+        bloomFilterDistinctHashes = 0;
+    }
+}
+
+std::int64_t ColumnWriter::getBloomFilterMemoryUsage() {
+    std::int64_t memoryUsage = bloomFilterHashes.capacity() * sizeof(uint64_t);
+    if (bloomFilter != nullptr) {
+        memoryUsage += bloomFilter->getMemoryUsage();
+    }
+    for (const auto &childWriter : getChildWriters()) {
+        memoryUsage += childWriter->getBloomFilterMemoryUsage();
+    }
+    return memoryUsage;
+}
+
+void ColumnWriter::updateBloomFilter(const std::shared_ptr<ColumnVector> &vector, int length) {
+    if (!bloomFilterEnabled) {
+        return;
+    }
+    size_t start = bloomFilterHashes.size();
+    bloomFilterHashes.resize(start + length);
+    BloomFilter::hashValues(vector, category, length, bloomFilterHashes.data() + start);
+    // only the non-null values are added, straight into the Bloom filter if the hashes are no longer kept
+    size_t end = start;
+    for (int i = 0; i < length; i++) {
+        if (!vector->isNull[i]) {
+            if (bloomFilter != nullptr) {
+                bloomFilter->insert(bloomFilterHashes[start + i]);
+            } else {
+                bloomFilterHashes[end++] = bloomFilterHashes[start + i];
+            }
+        }
+    }
+    bloomFilterHashes.resize(end);
+    compactBloomFilterHashes();
+}
+
+std::int64_t ColumnWriter::getBufferCapacity() {
+    std::int64_t capacity = outputStream->getCapacity() + isNullStream->getCapacity();
+    for (const auto &childWriter : getChildWriters()) {
+        capacity += childWriter->getBufferCapacity();
+    }
+    return capacity;
 }
 
 void ColumnWriter::newPixel() {
     if (hasNull) {
         auto compacted = BitUtils::bitWiseCompact(isNull, curPixelIsNullIndex, byteOrder);
         isNullStream->putBytes(const_cast<uint8_t*>(compacted.data()), compacted.size());
-        pixelStatRecorder.setHasNull();
+        pixelStatRecorder->setHasNull();
     }
     curPixelPosition = static_cast<int>(outputStream->getWritePos());
     curPixelEleIndex = 0;
     curPixelVectorIndex = 0;
     curPixelIsNullIndex = 0;
 
-    columnChunkStatRecorder.merge(pixelStatRecorder);
+    columnChunkStatRecorder->merge(*pixelStatRecorder);
 
     pixels::proto::PixelStatistic pixelStat;
-    *pixelStat.mutable_statistic() = pixelStatRecorder.serialize();
+    *pixelStat.mutable_statistic() = pixelStatRecorder->serialize();
     columnChunkIndex->add_pixelpositions(lastPixelPosition);
     auto new_pixelstatistic = columnChunkIndex->add_pixelstatistics();
     *new_pixelstatistic = pixelStat;
 
     lastPixelPosition = curPixelPosition;
-    pixelStatRecorder.reset();
+    pixelStatRecorder->reset();
     hasNull = false;
 }
 
 void ColumnWriter::reset() {
     lastPixelPosition = 0;
     curPixelPosition = 0;
+    curPixelEleIndex = 0;
+    curPixelVectorIndex = 0;
+    curPixelIsNullIndex = 0;
+    hasNull = false;
+    // the content of the index may have been moved into the row group footer
     columnChunkIndex->Clear();
-    columnChunkStat->Clear();
-    pixelStatRecorder.reset();
-    columnChunkStatRecorder.reset();
+    columnChunkIndex->set_littleendian(byteOrder == ByteOrder::PIXELS_LITTLE_ENDIAN);
+    columnChunkIndex->set_nullspadding(nullsPadding);
+    columnChunkIndex->set_isnullalignment(ISNULL_ALIGNMENT);
+    pixelStatRecorder->reset();
+    columnChunkStatRecorder->reset();
     outputStream->resetPosition();
     isNullStream->resetPosition();
+    bloomFilterHashes.clear();
+    bloomFilterDistinctHashes = 0;
+    bloomFilter.reset();
 }
 
 void ColumnWriter::close() {
@@ -113,19 +220,26 @@ void ColumnWriter::close() {
 
 ColumnWriter::ColumnWriter(std::shared_ptr<TypeDescription> type,
                                    std::shared_ptr<PixelsWriterOption> writerOption)
-        : pixelStride(writerOption->getPixelsStride()),
+        : category(type->getCategory()),
+          pixelStride(writerOption->getPixelsStride()),
           encodingLevel(writerOption->getEncodingLevel()),
           byteOrder(writerOption->getByteOrder()),
           nullsPadding(false),// default is false
           isNull(pixelStride, false)
 
 {
-    outputStream=std::make_shared<ByteBuffer>();
-    isNullStream=std::make_shared<ByteBuffer>();
+    outputStream=std::make_shared<SegmentedOutputStream>();
+    isNullStream=std::make_shared<SegmentedOutputStream>();
+    pixelStatRecorder = StatsRecorder::create(*type);
+    columnChunkStatRecorder = StatsRecorder::create(*type);
     columnChunkIndex=std::make_shared<pixels::proto::ColumnChunkIndex>();
     columnChunkIndex->set_littleendian(byteOrder == ByteOrder::PIXELS_LITTLE_ENDIAN);
     columnChunkIndex->set_nullspadding(nullsPadding);
     columnChunkIndex->set_isnullalignment(ISNULL_ALIGNMENT);
+    if (BloomFilter::isTypeSupported(category)) {
+        bloomFilterEnabled = writerOption->isBloomFilter();
+        bloomFilterFpp = writerOption->getBloomFilterFpp();
+    }
 }
 
 
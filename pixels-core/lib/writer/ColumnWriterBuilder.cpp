@@ -25,9 +25,18 @@
 #include "writer/ColumnWriterBuilder.h"
 #include "writer/IntegerColumnWriter.h"
 #include "writer/DateColumnWriter.h"
+#include "writer/TimeColumnWriter.h"
 #include "writer/DecimalColumnWriter.h"
+#include "writer/LongDecimalColumnWriter.h"
 #include "writer/TimestampColumnWriter.h"
 #include "writer/StringColumnWriter.h"
+#include "writer/CharColumnWriter.h"
+#include "writer/FloatColumnWriter.h"
+#include "writer/DoubleColumnWriter.h"
+#include "writer/ByteColumnWriter.h"
+#include "writer/VectorColumnWriter.h"
+#include "writer/StructColumnWriter.h"
+#include "writer/ArrayColumnWriter.h"
 std::shared_ptr<ColumnWriter> ColumnWriterBuilder::newColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) {
     switch(type->getCategory()) {
         case TypeDescription::SHORT:
@@ -38,27 +47,36 @@ std::shared_ptr<ColumnWriter> ColumnWriterBuilder::newColumnWriter(std::shared_p
         case TypeDescription::DATE:
             return std::make_shared<DateColumnWriter>(type, writerOption);
         case TypeDescription::DECIMAL:
+            if (type->getPrecision() > TypeDescription::SHORT_DECIMAL_MAX_PRECISION)
+            {
+                return std::make_shared<LongDecimalColumnWriter>(type, writerOption);
+            }
             return std::make_shared<DecimalColumnWriter>(type, writerOption);
         case TypeDescription::TIMESTAMP:
             return std::make_shared<TimestampColumnWriter>(type, writerOption);
         case TypeDescription::STRING:
             return std::make_shared<StringColumnWriter>(type, writerOption);
+        case TypeDescription::CHAR:
+            return std::make_shared<CharColumnWriter>(type, writerOption);
         case TypeDescription::BOOLEAN:
-            break;
         case TypeDescription::BYTE:
-            break;
+            return std::make_shared<ByteColumnWriter>(type, writerOption);
         case TypeDescription::FLOAT:
-            break;
+            return std::make_shared<FloatColumnWriter>(type, writerOption);
         case TypeDescription::DOUBLE:
-            break;
+            return std::make_shared<DoubleColumnWriter>(type, writerOption);
         case TypeDescription::TIME:
-            break;
+            return std::make_shared<TimeColumnWriter>(type, writerOption);
         case TypeDescription::VARBINARY:
-            break;
         case TypeDescription::BINARY:
-            break;
+            // binaries share the column chunk layout of strings
+            return std::make_shared<StringColumnWriter>(type, writerOption);
+        case TypeDescription::VECTOR:
+            return std::make_shared<VectorColumnWriter>(type, writerOption);
         case TypeDescription::STRUCT:
-            break;
+            return std::make_shared<StructColumnWriter>(type, writerOption);
+        case TypeDescription::ARRAY:
+            return std::make_shared<ArrayColumnWriter>(type, writerOption);
         default:
             throw InvalidArgumentException("bad column type in ColumnWriterBuilder: " + std::to_string(type->getCategory()));
     }
@@ -40,6 +40,7 @@ int DateColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
     {
         throw std::invalid_argument("Invalid vector type");
     }
+    updateBloomFilter(vector, size);
     int* values = columnVector->dates;
 
     int curPartLength;         // size of the partition which belongs to current pixel
@@ -92,6 +93,7 @@ void DateColumnWriter::writeCurPartTime(std::shared_ptr<ColumnVector> columnVect
             curPixelVector[curPixelVectorIndex++] = values[i + curPartOffset];
         }
     }
+    pixelStatRecorder->updateDate(values + curPartOffset, columnVector->isNull + curPartOffset, curPartLength);
     std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
     curPixelIsNullIndex += curPartLength;
 }
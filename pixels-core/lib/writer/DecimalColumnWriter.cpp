@@ -20,11 +20,14 @@
 
 #include "writer/DecimalColumnWriter.h"
 #include "utils/BitUtils.h"
+#include "encoding/EncodingSelector.h"
 
 DecimalColumnWriter::DecimalColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
 ColumnWriter(type, writerOption), curPixelVector(pixelStride)
 {
+    // on EL2, run-length encoding is a candidate and the encoding selector decides whether to use it
     runlengthEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    encodingDecided = !runlengthEncoding;
     if (runlengthEncoding)
     {
         encoder = std::make_unique<RunLenIntEncoder>();
@@ -39,6 +42,7 @@ int DecimalColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
     {
         throw std::invalid_argument("Invalid vector type");
     }
+    updateBloomFilter(vector, size);
     long* values = columnVector->vector;
 
     int curPartLength;         // size of the partition which belongs to current pixel
@@ -62,6 +66,14 @@ int DecimalColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
     return outputStream->getWritePos();
 }
 
+void DecimalColumnWriter::reset()
+{
+    ColumnWriter::reset();
+    // the encoding of the next column chunk is chosen again
+    runlengthEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    encodingDecided = !runlengthEncoding;
+}
+
 void DecimalColumnWriter::close()
 {
     if (runlengthEncoding && encoder)
@@ -89,6 +101,7 @@ void DecimalColumnWriter::writeCurPartDecimal(std::shared_ptr<ColumnVector> colu
             curPixelVector[curPixelVectorIndex++] = values[i + curPartOffset];
         }
     }
+    pixelStatRecorder->updateInteger(values + curPartOffset, columnVector->isNull + curPartOffset, curPartLength);
     std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
     curPixelIsNullIndex += curPartLength;
 }
@@ -105,14 +118,24 @@ bool DecimalColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption>
 void DecimalColumnWriter::newPixel()
 {
     // write out current pixel vector
-    // if (runlengthEncoding)
-    // {
-    //     std::vector<byte> buffer(curPixelVectorIndex * sizeof(int));
-    //     int resLen;
-    //     encoder->encode(curPixelVector.data(), buffer.data(), curPixelVectorIndex, resLen);
-    //     outputStream->putBytes(buffer.data(), resLen);
-    // }
-    // else
+    if (runlengthEncoding)
+    {
+        std::vector<byte> buffer(RunLenIntEncoder::getMaxEncodedSize(curPixelVectorIndex));
+        int resLen;
+        encoder->encode(curPixelVector.data(), buffer.data(), curPixelVectorIndex, resLen);
+        if (!encodingDecided)
+        {
+            long plainSize = (long) curPixelVectorIndex * sizeof(long);
+            runlengthEncoding = EncodingSelector::selectIntegerEncoding(curPixelVectorIndex, plainSize, resLen) ==
+                                pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH;
+            encodingDecided = true;
+        }
+        if (runlengthEncoding)
+        {
+            outputStream->putBytes(buffer.data(), resLen);
+        }
+    }
+    if (!runlengthEncoding)
     {
         std::shared_ptr<ByteBuffer> curVecPartitionBuffer;
         EncodingUtils encodingUtils;
@@ -139,7 +162,7 @@ void DecimalColumnWriter::newPixel()
     ColumnWriter::newPixel();
 }
 
-pixels::proto::ColumnEncoding DecimalColumnWriter::getColumnChunkEncoding() const
+pixels::proto::ColumnEncoding DecimalColumnWriter::getColumnChunkEncoding()
 {
     pixels::proto::ColumnEncoding columnEncoding;
     if (runlengthEncoding)
@@ -16,4 +16,127 @@
  * You should have received a copy of the Affero GNU General Public
  * License along with Pixels.  If not, see
  * <https://www.gnu.org/licenses/>.
- */
\ No newline at end of file
+ */
+
+#include "writer/DoubleColumnWriter.h"
+#include "encoding/ByteStreamSplit.h"
+#include "utils/EncodingUtils.h"
+#include <cstring>
+
+DoubleColumnWriter::DoubleColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption), curPixelVector(pixelStride)
+{
+    // the reader gets the length of the streams in a pixel from the number of non-null values in the pixel statistic
+    byteStreamSplit = writerOption->isByteStreamSplit() && encodingLevel.ge(EncodingLevel::Level::EL1) && !nullsPadding;
+}
+
+int DoubleColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::dynamic_pointer_cast<DoubleColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    double* values = columnVector->doubleVector;
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    // do the calculation to partition the vector into current pixel and next one
+    // doing this pre-calculation to eliminate branch prediction inside the for loop
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartDouble(columnVector, values, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartDouble(columnVector, values, curPartLength, curPartOffset);
+
+    return outputStream->getWritePos();
+}
+
+void DoubleColumnWriter::writeCurPartDouble(std::shared_ptr<DoubleColumnVector> columnVector, double* values, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+            if (nullsPadding)
+            {
+                // padding 0 for nulls
+                curPixelVector[curPixelVectorIndex++] = 0;
+            }
+        }
+        else
+        {
+            curPixelVector[curPixelVectorIndex++] = values[i + curPartOffset];
+            pixelStatRecorder->updateDouble(values[i + curPartOffset]);
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool DoubleColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    if (writerOption->getEncodingLevel().ge(EncodingLevel::Level::EL2))
+    {
+        return false;
+    }
+    return writerOption->isNullsPadding();
+}
+
+void DoubleColumnWriter::newPixel()
+{
+    // write out current pixel vector
+    if (byteStreamSplit)
+    {
+        // the streams are always split from the little endian values
+        std::vector<uint8_t> streams(curPixelVectorIndex * sizeof(double));
+        ByteStreamSplit::encode(reinterpret_cast<const uint8_t*>(curPixelVector.data()),
+                                curPixelVectorIndex, sizeof(double), streams.data());
+        outputStream->putBytes(streams.data(), streams.size());
+    }
+    else
+    {
+        auto curVecPartitionBuffer = std::make_shared<ByteBuffer>(curPixelVectorIndex * sizeof(double));
+        EncodingUtils encodingUtils;
+        for (int i = 0; i < curPixelVectorIndex; i++)
+        {
+            long bits;
+            std::memcpy(&bits, &curPixelVector[i], sizeof(double));
+            if (byteOrder == ByteOrder::PIXELS_LITTLE_ENDIAN)
+            {
+                encodingUtils.writeLongLE(curVecPartitionBuffer, bits);
+            }
+            else
+            {
+                encodingUtils.writeLongBE(curVecPartitionBuffer, bits);
+            }
+        }
+        outputStream->putBytes(curVecPartitionBuffer->getPointer(), curVecPartitionBuffer->getWritePos());
+    }
+
+    ColumnWriter::newPixel();
+}
+
+pixels::proto::ColumnEncoding DoubleColumnWriter::getColumnChunkEncoding()
+{
+    pixels::proto::ColumnEncoding columnEncoding;
+    if (byteStreamSplit)
+    {
+        columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_BYTE_STREAM_SPLIT);
+    }
+    else
+    {
+        columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE);
+    }
+    return columnEncoding;
+}
@@ -20,12 +20,15 @@
 
 #include "writer/IntegerColumnWriter.h"
 #include "utils/BitUtils.h"
+#include "encoding/EncodingSelector.h"
 
 IntegerColumnWriter::IntegerColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
 ColumnWriter(type, writerOption), curPixelVector(pixelStride)
 {
     isLong = type->getCategory() == TypeDescription::Category::LONG;
+    // on EL2, run-length encoding is a candidate and the encoding selector decides whether to use it
     runlengthEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    encodingDecided = !runlengthEncoding;
     if (runlengthEncoding)
     {
         encoder = std::make_unique<RunLenIntEncoder>();
@@ -40,13 +43,9 @@ int IntegerColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
     {
         throw std::invalid_argument("Invalid vector type");
     }
-    long* values;
-    if(columnVector->isLongVectore()){
-      values=columnVector->longVector;
-
-    }else {
-        values = columnVector->intVector;
-    }
+    updateBloomFilter(vector, size);
+    // int columns are stored in the 32-bit intVector
+    bool longValues = columnVector->isLongVectore();
 
     int curPartLength;         // size of the partition which belongs to current pixel
     int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
@@ -57,18 +56,40 @@ int IntegerColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
     while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
     {
         curPartLength = pixelStride - curPixelIsNullIndex;
-        writeCurPartLong(columnVector, values, curPartLength, curPartOffset);
+        if (longValues)
+        {
+            writeCurPart(columnVector, columnVector->longVector, curPartLength, curPartOffset);
+        }
+        else
+        {
+            writeCurPart(columnVector, columnVector->intVector, curPartLength, curPartOffset);
+        }
         newPixel();
         curPartOffset += curPartLength;
         nextPartLength = size - curPartOffset;
     }
 
     curPartLength = nextPartLength;
-    writeCurPartLong(columnVector, values, curPartLength, curPartOffset);
+    if (longValues)
+    {
+        writeCurPart(columnVector, columnVector->longVector, curPartLength, curPartOffset);
+    }
+    else
+    {
+        writeCurPart(columnVector, columnVector->intVector, curPartLength, curPartOffset);
+    }
 
     return outputStream->getWritePos();
 }
 
+void IntegerColumnWriter::reset()
+{
+    ColumnWriter::reset();
+    // the encoding of the next column chunk is chosen again
+    runlengthEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    encodingDecided = !runlengthEncoding;
+}
+
 void IntegerColumnWriter::close()
 {
     if (runlengthEncoding && encoder)
@@ -77,7 +98,8 @@ void IntegerColumnWriter::close()
     }
     ColumnWriter::close();
 }
-void IntegerColumnWriter::writeCurPartLong(std::shared_ptr<ColumnVector> columnVector, long *values, int curPartLength, int curPartOffset)
+template <typename T>
+void IntegerColumnWriter::writeCurPart(std::shared_ptr<ColumnVector> columnVector, T *values, int curPartLength, int curPartOffset)
 {
     for (int i = 0; i < curPartLength; i++)
     {
@@ -96,6 +118,7 @@ void IntegerColumnWriter::writeCurPartLong(std::shared_ptr<ColumnVector> columnV
             curPixelVector[curPixelVectorIndex++] = values[i + curPartOffset];
         }
     }
+    pixelStatRecorder->updateInteger(values + curPartOffset, columnVector->isNull + curPartOffset, curPartLength);
     std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
     curPixelIsNullIndex += curPartLength;
 }
@@ -114,12 +137,22 @@ void IntegerColumnWriter::newPixel()
     // write out current pixel vector
     if (runlengthEncoding)
     {
-        std::vector<byte> buffer(curPixelVectorIndex * sizeof(int));
+        std::vector<byte> buffer(RunLenIntEncoder::getMaxEncodedSize(curPixelVectorIndex));
         int resLen;
         encoder->encode(curPixelVector.data(), buffer.data(), curPixelVectorIndex, resLen);
-        outputStream->putBytes(buffer.data(), resLen);
+        if (!encodingDecided)
+        {
+            long plainSize = (long) curPixelVectorIndex * (isLong ? sizeof(long) : sizeof(int));
+            runlengthEncoding = EncodingSelector::selectIntegerEncoding(curPixelVectorIndex, plainSize, resLen) ==
+                                pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH;
+            encodingDecided = true;
+        }
+        if (runlengthEncoding)
+        {
+            outputStream->putBytes(buffer.data(), resLen);
+        }
     }
-    else
+    if (!runlengthEncoding)
     {
         std::shared_ptr<ByteBuffer> curVecPartitionBuffer;
         EncodingUtils encodingUtils;
@@ -177,4 +210,4 @@ pixels::proto::ColumnEncoding IntegerColumnWriter::getColumnChunkEncoding()
         columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE);
     }
     return columnEncoding;
-}
\ No newline at end of file
+}
\ No newline at end of file
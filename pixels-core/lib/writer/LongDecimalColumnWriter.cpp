@@ -16,4 +16,123 @@
  * You should have received a copy of the Affero GNU General Public
  * License along with Pixels.  If not, see
  * <https://www.gnu.org/licenses/>.
- */
\ No newline at end of file
+ */
+
+#include "writer/LongDecimalColumnWriter.h"
+#include "vector/LongDecimalColumnVector.h"
+
+LongDecimalColumnWriter::LongDecimalColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption), curPixelVector(2 * pixelStride), curPixelNarrow(true)
+{
+}
+
+int LongDecimalColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::static_pointer_cast<LongDecimalColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    updateBloomFilter(vector, size);
+    uint64_t* values = columnVector->vector;
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    // do the calculation to partition the vector into current pixel and next one
+    // doing this pre-calculation to eliminate branch prediction inside the for loop
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartLongDecimal(columnVector, values, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartLongDecimal(columnVector, values, curPartLength, curPartOffset);
+
+    return outputStream->getWritePos();
+}
+
+void LongDecimalColumnWriter::writeCurPartLongDecimal(std::shared_ptr<ColumnVector> columnVector, uint64_t* values, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+            if (nullsPadding)
+            {
+                // padding 0 for nulls
+                curPixelVector[2 * curPixelVectorIndex] = 0;
+                curPixelVector[2 * curPixelVectorIndex + 1] = 0;
+                curPixelVectorIndex++;
+            }
+        }
+        else
+        {
+            uint64_t low = values[2 * (i + curPartOffset)];
+            uint64_t high = values[2 * (i + curPartOffset) + 1];
+            curPixelVector[2 * curPixelVectorIndex] = low;
+            curPixelVector[2 * curPixelVectorIndex + 1] = high;
+            curPixelVectorIndex++;
+            curPixelNarrow = curPixelNarrow && (int64_t) high == ((int64_t) low >> 63);
+            pixelStatRecorder->updateInteger128(high, low, 1);
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool LongDecimalColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    if (writerOption->getEncodingLevel().ge(EncodingLevel::Level::EL2))
+    {
+        return false;
+    }
+    return writerOption->isNullsPadding();
+}
+
+void LongDecimalColumnWriter::newPixel()
+{
+    // write out current pixel vector, in 64 bits if the pixel statistics tell the reader it fits
+    EncodingUtils encodingUtils;
+    int width = curPixelNarrow ? sizeof(long) : 2 * sizeof(long);
+    std::shared_ptr<ByteBuffer> curVecPartitionBuffer = std::make_shared<ByteBuffer>(curPixelVectorIndex * width);
+    for (int i = 0; i < curPixelVectorIndex; i++)
+    {
+        long low = (long) curPixelVector[2 * i];
+        long high = (long) curPixelVector[2 * i + 1];
+        if (byteOrder == ByteOrder::PIXELS_LITTLE_ENDIAN)
+        {
+            encodingUtils.writeLongLE(curVecPartitionBuffer, low);
+            if (!curPixelNarrow)
+            {
+                encodingUtils.writeLongLE(curVecPartitionBuffer, high);
+            }
+        }
+        else
+        {
+            if (!curPixelNarrow)
+            {
+                encodingUtils.writeLongBE(curVecPartitionBuffer, high);
+            }
+            encodingUtils.writeLongBE(curVecPartitionBuffer, low);
+        }
+    }
+    outputStream->putBytes(curVecPartitionBuffer->getPointer(), curVecPartitionBuffer->getWritePos());
+    curPixelNarrow = true;
+
+    ColumnWriter::newPixel();
+}
+
+pixels::proto::ColumnEncoding LongDecimalColumnWriter::getColumnChunkEncoding()
+{
+    pixels::proto::ColumnEncoding columnEncoding;
+    columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE);
+    return columnEncoding;
+}
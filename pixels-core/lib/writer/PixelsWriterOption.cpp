@@ -54,6 +54,75 @@ std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setNullsPadding(bool nul
     return shared_from_this();
 }
 
+int PixelsWriterOption::getCompressionLevel(int columnId) const {
+    auto it = this->columnCompressionLevels.find(columnId);
+    return it == this->columnCompressionLevels.end() ? this->compressionLevel : it->second;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setCompressionLevel(int compressionLevel) {
+    this->compressionLevel = compressionLevel;
+    return shared_from_this();
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setCompressionLevel(int columnId, int compressionLevel) {
+    this->columnCompressionLevels[columnId] = compressionLevel;
+    return shared_from_this();
+}
+
+bool PixelsWriterOption::isByteStreamSplit() const {
+    return this->byteStreamSplit;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setByteStreamSplit(bool byteStreamSplit) {
+    this->byteStreamSplit = byteStreamSplit;
+    return shared_from_this();
+}
+
+bool PixelsWriterOption::isBloomFilter() const {
+    return this->bloomFilter;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setBloomFilter(bool bloomFilter) {
+    this->bloomFilter = bloomFilter;
+    return shared_from_this();
+}
+
+double PixelsWriterOption::getBloomFilterFpp() const {
+    return this->bloomFilterFpp;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setBloomFilterFpp(double bloomFilterFpp) {
+    this->bloomFilterFpp = bloomFilterFpp;
+    return shared_from_this();
+}
+
+const std::vector<int> &PixelsWriterOption::getSortKeyColumns() const {
+    return this->sortKeyColumns;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setSortKeyColumns(const std::vector<int> &sortKeyColumns) {
+    this->sortKeyColumns = sortKeyColumns;
+    return shared_from_this();
+}
+
+const std::vector<int> &PixelsWriterOption::getPartitionKeyColumns() const {
+    return this->partitionKeyColumns;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setPartitionKeyColumns(const std::vector<int> &partitionKeyColumns) {
+    this->partitionKeyColumns = partitionKeyColumns;
+    return shared_from_this();
+}
+
+int PixelsWriterOption::getNumPartitions() const {
+    return this->numPartitions;
+}
+
+std::shared_ptr<PixelsWriterOption> PixelsWriterOption::setNumPartitions(int numPartitions) {
+    this->numPartitions = numPartitions;
+    return shared_from_this();
+}
+
 ByteOrder PixelsWriterOption::getByteOrder() const {
     return byteOrder;
 }
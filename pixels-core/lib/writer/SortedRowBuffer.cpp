@@ -0,0 +1,360 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "writer/SortedRowBuffer.h"
+#include "vector/BinaryColumnVector.h"
+#include "vector/ByteColumnVector.h"
+#include "vector/DateColumnVector.h"
+#include "vector/DecimalColumnVector.h"
+#include "vector/DoubleColumnVector.h"
+#include "vector/LongColumnVector.h"
+#include "vector/LongDecimalColumnVector.h"
+#include "vector/TimeColumnVector.h"
+#include "vector/TimestampColumnVector.h"
+#include "exception/InvalidArgumentException.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+const int SortedRowBuffer::CHUNK_SIZE = 4096;
+
+namespace {
+    const uint64_t SIGN_BIT = 1ULL << 63;
+    // the ranges shorter than this are sorted by comparison, it is cheaper than the radix passes
+    const int MIN_RADIX_SORT_ROWS = 64;
+
+    uint64_t normalizeSigned(int64_t value) {
+        return (uint64_t) value ^ SIGN_BIT;
+    }
+
+    uint64_t normalizeDouble(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    }
+
+    ColumnVector *sourceVector(const std::vector<std::shared_ptr<VectorizedRowBatch>> &chunks, int column, uint64_t rowId) {
+        return chunks[rowId >> 32]->cols[column].get();
+    }
+}
+
+SortedRowBuffer::SortedRowBuffer(const std::shared_ptr<TypeDescription> &schema, const std::vector<int> &sortKeyColumns)
+        : schema(schema), sortKeyColumns(sortKeyColumns) {
+    auto children = schema->getChildren();
+    for (const auto &child : children) {
+        if (child->getCategory() == TypeDescription::ARRAY) {
+            throw InvalidArgumentException("SortedRowBuffer: the rows with array columns can not be sorted");
+        }
+        columnCategories.push_back(child->getCategory());
+    }
+    if (sortKeyColumns.empty()) {
+        throw InvalidArgumentException("SortedRowBuffer: no sort key column is specified");
+    }
+    for (int column : sortKeyColumns) {
+        if (column < 0 || column >= children.size()) {
+            throw InvalidArgumentException("SortedRowBuffer: sort key column " + std::to_string(column) + " does not exist");
+        }
+        auto category = columnCategories[column];
+        if (category == TypeDescription::STRUCT || category == TypeDescription::VECTOR) {
+            throw InvalidArgumentException("SortedRowBuffer: the type of sort key column " +
+                                           std::to_string(column) + " is not supported");
+        }
+    }
+}
+
+void SortedRowBuffer::add(const std::shared_ptr<VectorizedRowBatch> &rowBatch) {
+    int batchRows = rowBatch->count();
+    std::vector<ColumnVector *> sources(1);
+    std::vector<uint64_t> rowIds;
+    int copied = 0;
+    while (copied < batchRows) {
+        int chunkId = numRows / CHUNK_SIZE;
+        if (chunkId == chunks.size()) {
+            chunks.push_back(schema->createRowBatch(CHUNK_SIZE));
+        }
+        auto &chunk = chunks[chunkId];
+        int chunkOffset = numRows % CHUNK_SIZE;
+        int toCopy = std::min(batchRows - copied, CHUNK_SIZE - chunkOffset);
+        rowIds.resize(toCopy);
+        for (int i = 0; i < toCopy; i++) {
+            rowIds[i] = ColumnVector::makeRowId(0, copied + i);
+        }
+        for (int column = 0; column < chunk->cols.size(); column++) {
+            sources[0] = rowBatch->cols[column].get();
+            chunk->cols[column]->gather(sources, rowIds.data(), toCopy, chunkOffset);
+        }
+        chunk->rowCount += toCopy;
+        numRows += toCopy;
+        copied += toCopy;
+    }
+}
+
+int SortedRowBuffer::getNumRows() const {
+    return numRows;
+}
+
+uint64_t SortedRowBuffer::getMemoryUsage() const {
+    // the chunks kept from the previous row groups are not counted until they are filled again
+    int usedChunks = (numRows + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    uint64_t memoryUsage = 0;
+    for (int i = 0; i < usedChunks; i++) {
+        for (const auto &column : chunks[i]->cols) {
+            memoryUsage += column->memoryUsage;
+        }
+    }
+    return memoryUsage;
+}
+
+void SortedRowBuffer::drain(int batchSize, const std::function<void(const std::shared_ptr<VectorizedRowBatch> &)> &consumer) {
+    std::vector<uint64_t> rowIds(numRows);
+    for (int i = 0; i < numRows; i++) {
+        rowIds[i] = ColumnVector::makeRowId(i / CHUNK_SIZE, i % CHUNK_SIZE);
+    }
+    sort(rowIds.data(), rowIds.data() + numRows, 0);
+
+    if (outputBatch == nullptr || outputBatch->getMaxSize() < batchSize) {
+        outputBatch = schema->createRowBatch(batchSize);
+    }
+    std::vector<std::vector<ColumnVector *>> sources(outputBatch->cols.size());
+    for (int column = 0; column < sources.size(); column++) {
+        for (const auto &chunk : chunks) {
+            sources[column].push_back(chunk->cols[column].get());
+        }
+    }
+    for (int offset = 0; offset < numRows; offset += batchSize) {
+        int size = std::min(batchSize, numRows - offset);
+        outputBatch->reset();
+        for (int column = 0; column < sources.size(); column++) {
+            outputBatch->cols[column]->gather(sources[column], rowIds.data() + offset, size, 0);
+        }
+        outputBatch->rowCount = size;
+        consumer(outputBatch);
+    }
+    // keep the chunks for the next row group
+    for (const auto &chunk : chunks) {
+        chunk->reset();
+    }
+    numRows = 0;
+}
+
+void SortedRowBuffer::sort(uint64_t *begin, uint64_t *end, int keyIndex) {
+    if (end - begin < 2 || keyIndex >= sortKeyColumns.size()) {
+        return;
+    }
+    int column = sortKeyColumns[keyIndex];
+    if (end - begin < MIN_RADIX_SORT_ROWS) {
+        std::stable_sort(begin, end, [this, keyIndex](uint64_t left, uint64_t right) {
+            for (int i = keyIndex; i < sortKeyColumns.size(); i++) {
+                int column = sortKeyColumns[i];
+                bool leftNull = isNull(column, left), rightNull = isNull(column, right);
+                if (leftNull || rightNull) {
+                    if (leftNull != rightNull) {
+                        return leftNull;
+                    }
+                    continue;
+                }
+                int result = compareValues(column, left, right);
+                if (result != 0) {
+                    return result < 0;
+                }
+            }
+            return false;
+        });
+        return;
+    }
+    // nulls first, they are equal in this key
+    uint64_t *nonNulls = std::stable_partition(begin, end, [this, column](uint64_t rowId) {
+        return isNull(column, rowId);
+    });
+    sort(begin, nonNulls, keyIndex + 1);
+
+    int numNonNulls = end - nonNulls;
+    std::vector<uint64_t> keys(numNonNulls);
+    for (int i = 0; i < numNonNulls; i++) {
+        keys[i] = normalizeKey(column, nonNulls[i]);
+    }
+    radixSort(nonNulls, keys.data(), numNonNulls);
+
+    // order the runs of equal normalized keys by the full values and the following keys
+    bool exact = isExactKey(column);
+    for (int runStart = 0; runStart < numNonNulls; ) {
+        int runEnd = runStart + 1;
+        while (runEnd < numNonNulls && keys[runEnd] == keys[runStart]) {
+            runEnd++;
+        }
+        if (runEnd - runStart > 1) {
+            if (exact) {
+                sort(nonNulls + runStart, nonNulls + runEnd, keyIndex + 1);
+            } else {
+                uint64_t *runBegin = nonNulls + runStart, *runFinish = nonNulls + runEnd;
+                std::stable_sort(runBegin, runFinish, [this, column](uint64_t left, uint64_t right) {
+                    return compareValues(column, left, right) < 0;
+                });
+                for (uint64_t *equalStart = runBegin; equalStart < runFinish; ) {
+                    uint64_t *equalEnd = equalStart + 1;
+                    while (equalEnd < runFinish && compareValues(column, *equalStart, *equalEnd) == 0) {
+                        equalEnd++;
+                    }
+                    sort(equalStart, equalEnd, keyIndex + 1);
+                    equalStart = equalEnd;
+                }
+            }
+        }
+        runStart = runEnd;
+    }
+}
+
+void SortedRowBuffer::radixSort(uint64_t *rowIds, uint64_t *keys, int numRows) {
+    if (numRows < 2) {
+        return;
+    }
+    // the histograms of the 8 bytes are counted in one pass
+    std::vector<std::array<int, 256>> counts(8);
+    for (auto &count : counts) {
+        count.fill(0);
+    }
+    for (int i = 0; i < numRows; i++) {
+        for (int b = 0; b < 8; b++) {
+            counts[b][(keys[i] >> (b * 8)) & 0xff]++;
+        }
+    }
+    std::vector<uint64_t> tmpKeys(numRows), tmpRowIds(numRows);
+    uint64_t *srcKeys = keys, *srcRowIds = rowIds, *dstKeys = tmpKeys.data(), *dstRowIds = tmpRowIds.data();
+    for (int b = 0; b < 8; b++) {
+        auto &count = counts[b];
+        // skip the byte that is the same in all the keys
+        if (count[(srcKeys[0] >> (b * 8)) & 0xff] == numRows) {
+            continue;
+        }
+        int offsets[256];
+        int offset = 0;
+        for (int d = 0; d < 256; d++) {
+            offsets[d] = offset;
+            offset += count[d];
+        }
+        for (int i = 0; i < numRows; i++) {
+            int position = offsets[(srcKeys[i] >> (b * 8)) & 0xff]++;
+            dstKeys[position] = srcKeys[i];
+            dstRowIds[position] = srcRowIds[i];
+        }
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcRowIds, dstRowIds);
+    }
+    if (srcKeys != keys) {
+        std::copy(srcKeys, srcKeys + numRows, keys);
+        std::copy(srcRowIds, srcRowIds + numRows, rowIds);
+    }
+}
+
+bool SortedRowBuffer::isNull(int column, uint64_t rowId) const {
+    return sourceVector(chunks, column, rowId)->isNull[(uint32_t) rowId];
+}
+
+bool SortedRowBuffer::isExactKey(int column) const {
+    switch (columnCategories[column]) {
+        case TypeDescription::STRING:
+        case TypeDescription::VARCHAR:
+        case TypeDescription::CHAR:
+        case TypeDescription::BINARY:
+        case TypeDescription::VARBINARY:
+            return false;
+        case TypeDescription::DECIMAL:
+            return dynamic_cast<LongDecimalColumnVector *>(chunks[0]->cols[column].get()) == nullptr;
+        default:
+            return true;
+    }
+}
+
+uint64_t SortedRowBuffer::normalizeKey(int column, uint64_t rowId) const {
+    ColumnVector *vector = sourceVector(chunks, column, rowId);
+    uint32_t row = (uint32_t) rowId;
+    switch (columnCategories[column]) {
+        case TypeDescription::BOOLEAN:
+        case TypeDescription::BYTE:
+            return normalizeSigned((int8_t) static_cast<ByteColumnVector *>(vector)->vector[row]);
+        case TypeDescription::SHORT:
+        case TypeDescription::INT:
+        case TypeDescription::LONG: {
+            auto longVector = static_cast<LongColumnVector *>(vector);
+            return normalizeSigned(longVector->isLongVectore() ? longVector->longVector[row] : longVector->intVector[row]);
+        }
+        case TypeDescription::FLOAT:
+        case TypeDescription::DOUBLE: {
+            auto doubleVector = static_cast<DoubleColumnVector *>(vector);
+            return normalizeDouble(doubleVector->isDoubleVector() ? doubleVector->doubleVector[row] : doubleVector->floatVector[row]);
+        }
+        case TypeDescription::DECIMAL: {
+            if (auto longDecimalVector = dynamic_cast<LongDecimalColumnVector *>(vector)) {
+                // the high 64 bits, the ties are broken by compareValues
+                return normalizeSigned((int64_t) (longDecimalVector->get(row) >> 64));
+            }
+            return normalizeSigned(static_cast<DecimalColumnVector *>(vector)->vector[row]);
+        }
+        case TypeDescription::DATE:
+            return normalizeSigned(static_cast<DateColumnVector *>(vector)->dates[row]);
+        case TypeDescription::TIME:
+            return normalizeSigned(static_cast<TimeColumnVector *>(vector)->times[row]);
+        case TypeDescription::TIMESTAMP:
+            return normalizeSigned(static_cast<TimestampColumnVector *>(vector)->times[row]);
+        default: {
+            // the first 8 bytes in big endian, the ties are broken by compareValues
+            auto binaryVector = static_cast<BinaryColumnVector *>(vector);
+            const uint8_t *data = reinterpret_cast<const uint8_t *>(binaryVector->vector[row].GetData());
+            int length = std::min(binaryVector->lens[row], 8);
+            uint64_t key = 0;
+            for (int i = 0; i < 8; i++) {
+                key = (key << 8) | (i < length ? data[i] : 0);
+            }
+            return key;
+        }
+    }
+}
+
+int SortedRowBuffer::compareValues(int column, uint64_t left, uint64_t right) const {
+    ColumnVector *leftVector = sourceVector(chunks, column, left);
+    ColumnVector *rightVector = sourceVector(chunks, column, right);
+    uint32_t leftRow = (uint32_t) left, rightRow = (uint32_t) right;
+    switch (columnCategories[column]) {
+        case TypeDescription::STRING:
+        case TypeDescription::VARCHAR:
+        case TypeDescription::CHAR:
+        case TypeDescription::BINARY:
+        case TypeDescription::VARBINARY: {
+            auto leftBinary = static_cast<BinaryColumnVector *>(leftVector);
+            auto rightBinary = static_cast<BinaryColumnVector *>(rightVector);
+            int leftLength = leftBinary->lens[leftRow], rightLength = rightBinary->lens[rightRow];
+            int result = std::memcmp(leftBinary->vector[leftRow].GetData(), rightBinary->vector[rightRow].GetData(),
+                                     std::min(leftLength, rightLength));
+            return result != 0 ? result : (leftLength > rightLength) - (leftLength < rightLength);
+        }
+        case TypeDescription::DECIMAL:
+            if (dynamic_cast<LongDecimalColumnVector *>(leftVector) != nullptr) {
+                __int128 leftValue = static_cast<LongDecimalColumnVector *>(leftVector)->get(leftRow);
+                __int128 rightValue = static_cast<LongDecimalColumnVector *>(rightVector)->get(rightRow);
+                return (leftValue > rightValue) - (leftValue < rightValue);
+            }
+            // fall through
+        default: {
+            uint64_t leftKey = normalizeKey(column, left), rightKey = normalizeKey(column, right);
+            return (leftKey > rightKey) - (leftKey < rightKey);
+        }
+    }
+}
@@ -18,6 +18,9 @@
  * <https://www.gnu.org/licenses/>.
  */
 #include "writer/StringColumnWriter.h"
+#include "encoding/EncodingSelector.h"
+#include <algorithm>
+#include <unordered_map>
 
 StringColumnWriter::StringColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption)
     : ColumnWriter(type, writerOption), curPixelVector(pixelStride) {
@@ -27,19 +30,33 @@ StringColumnWriter::StringColumnWriter(std::shared_ptr<TypeDescription> type, st
     if (runlengthEncoding) {
         encoder = std::make_unique<RunLenIntEncoder>();
     }
+    dictionaryEncoding = encodingLevel.ge(EncodingLevel::Level::EL2);
+    fsstEncoding = encodingLevel.ge(EncodingLevel::Level::EL1);
     startsArray = std::make_shared<DynamicIntArray>();
     std::cout << "StringColumnWriter constructed" << std::endl;
 }
 
 void StringColumnWriter::flush() {
     std::cout << "Entering StringColumnWriter::flush" << std::endl;
+    if (curPixelEleIndex > 0) {
+        newPixel();
+    }
+    selectEncoding();
     ColumnWriter::flush();
-    flushStarts();
+    if (dictionaryEncoded) {
+        flushDictionary();
+    } else {
+        flushStarts();
+    }
     std::cout << "Exiting StringColumnWriter::flush" << std::endl;
 }
 
 void StringColumnWriter::flushStarts() {
     std::cout << "Entering StringColumnWriter::flushStarts" << std::endl;
+    int symbolTableOffset = outputStream->getWritePos();
+    if (fsstEncoded) {
+        fsstEncoder->writeSymbolTable(outputStream);
+    }
     int startsFieldOffset=outputStream->getWritePos();
     startsArray->add(startOffset);
     std::cout << "StartsFieldOffset: " << startsFieldOffset << ", startsArray size: " << startsArray->size() << std::endl;
@@ -57,7 +74,10 @@ void StringColumnWriter::flushStarts() {
     }
 
     startsArray->clear();
-    std::shared_ptr<ByteBuffer> offsetBuffer = std::make_shared<ByteBuffer>(4);
+    std::shared_ptr<ByteBuffer> offsetBuffer = std::make_shared<ByteBuffer>(8);
+    if (fsstEncoded) {
+        offsetBuffer->putInt(symbolTableOffset);
+    }
     offsetBuffer->putInt(startsFieldOffset);
     outputStream->putBytes(offsetBuffer->getPointer(), offsetBuffer->getWritePos());
     std::cout << "Exiting StringColumnWriter::flushStarts" << std::endl;
@@ -69,6 +89,7 @@ int StringColumnWriter::write(std::shared_ptr<ColumnVector> vector, int length)
     auto values = columnVector->vector;
     auto vLens = columnVector->lens;
     auto vOffsets = columnVector->start;
+    updateBloomFilter(vector, length);
 
     int curPartLength;
     int curPartOffset = 0;
@@ -88,18 +109,18 @@ int StringColumnWriter::write(std::shared_ptr<ColumnVector> vector, int length)
     std::cout << "Writing final part, curPartLength: " << curPartLength << std::endl;
     writeCurPartWithoutDict(columnVector, values, vLens, vOffsets, curPartLength, curPartOffset);
 
-    std::cout << "Exiting StringColumnWriter::write, outputStream size: " << outputStream->size() << std::endl;
     return outputStream->getWritePos();
 }
 
 void StringColumnWriter::writeCurPartWithoutDict(std::shared_ptr<BinaryColumnVector> columnVector, duckdb::string_t* values,
                                                  int* vLens, int* vOffsets, int curPartLength, int curPartOffset) {
     std::cout << "Entering StringColumnWriter::writeCurPartWithoutDict for curPartLength: " << curPartLength << std::endl;
+    // binaries have no min/max statistics, only the number of values is recorded
+    bool binary = category == TypeDescription::BINARY || category == TypeDescription::VARBINARY;
     for (int i = 0; i < curPartLength; i++) {
         curPixelEleIndex++;
         if (columnVector->isNull[curPartOffset + i]) {
             hasNull = true;
-            pixelStatRecorder.increment();
             if (nullsPadding) {
                 startsArray->add(0);
             }
@@ -108,6 +129,11 @@ void StringColumnWriter::writeCurPartWithoutDict(std::shared_ptr<BinaryColumnVec
             const char* data = values[curPartOffset + i].GetData();
             uint32_t len = vLens[curPartOffset + i];
             uint32_t offset = vOffsets[curPartOffset + i];
+            if (binary) {
+                pixelStatRecorder->increment();
+            } else {
+                pixelStatRecorder->updateString(data, len, 1);
+            }
             
             // Use ByteBuffer's putBytes method to write the string data
             std::cout << "Writing string data, length: " << len << ", offset: " << offset << std::endl;
@@ -125,15 +151,180 @@ void StringColumnWriter::writeCurPartWithoutDict(std::shared_ptr<BinaryColumnVec
     std::cout << "Exiting StringColumnWriter::writeCurPartWithoutDict" << std::endl;
 }
 
+void StringColumnWriter::flushDictionary() {
+    int dictContentOffset = outputStream->getWritePos();
+    outputStream->putBytes(dictContent.data(), dictContent.size());
+    int dictStartsOffset = outputStream->getWritePos();
+    outputStream->putBytes(encodedDictStarts.data(), encodedDictStarts.size());
+    std::shared_ptr<ByteBuffer> offsetBuffer = std::make_shared<ByteBuffer>(8);
+    offsetBuffer->putInt(dictContentOffset);
+    offsetBuffer->putInt(dictStartsOffset);
+    outputStream->putBytes(offsetBuffer->getPointer(), offsetBuffer->getWritePos());
+}
+
+void StringColumnWriter::selectEncoding() {
+    int numStrings = startsArray->size();
+    if (numStrings == 0 || (!dictionaryEncoding && !fsstEncoding)) {
+        return;
+    }
+    std::vector<int> rawStarts(numStrings + 1);
+    for (int i = 0; i < numStrings; i++) {
+        rawStarts[i] = startsArray->get(i);
+    }
+    rawStarts[numStrings] = startOffset;
+    std::vector<uint8_t> contentBuffer;
+    const uint8_t *content = outputStream->getContent(contentBuffer);
+
+    long plainSize = startOffset + (long) (numStrings + 1) * sizeof(int);
+    long dictionaryChunkSize = dictionaryEncoding ? tryDictionaryEncode(content, rawStarts) : -1;
+    long fsstChunkSize = fsstEncoding ? tryFsstEncode(content, rawStarts) : -1;
+    auto kind = EncodingSelector::selectStringEncoding(numStrings, plainSize, dictionaryChunkSize, fsstChunkSize);
+
+    auto chunkIndex = getColumnChunkIndexPtr();
+    if (kind == pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_DICTIONARY) {
+        // the ids replace the string content, the pixel positions point to the ids of each pixel
+        for (int i = 0; i < chunkIndex->pixelpositions_size(); i++) {
+            chunkIndex->set_pixelpositions(i, idPixelPositions[i]);
+        }
+        outputStream->resetPosition();
+        outputStream->putBytes(encodedIds.data(), encodedIds.size());
+        dictionaryEncoded = true;
+    } else if (kind == pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_FSST) {
+        for (int i = 0; i < chunkIndex->pixelpositions_size(); i++) {
+            chunkIndex->set_pixelpositions(i, fsstStarts[i == 0 ? 0 : pixelStringEnds[i - 1]]);
+        }
+        outputStream->resetPosition();
+        outputStream->putBytes(fsstContent.data(), fsstStarts[numStrings]);
+        startsArray->clear();
+        for (int i = 0; i < numStrings; i++) {
+            startsArray->add(fsstStarts[i]);
+        }
+        startOffset = fsstStarts[numStrings];
+        fsstEncoded = true;
+    }
+    // release the candidate that is not chosen
+    if (!dictionaryEncoded) {
+        std::vector<uint8_t>().swap(dictContent);
+        std::vector<uint8_t>().swap(encodedDictStarts);
+    }
+    std::vector<uint8_t>().swap(encodedIds);
+    std::vector<uint8_t>().swap(fsstContent);
+    if (!fsstEncoded) {
+        fsstEncoder.reset();
+    }
+}
+
+long StringColumnWriter::tryDictionaryEncode(const uint8_t *content, const std::vector<int> &rawStarts) {
+    int numStrings = rawStarts.size() - 1;
+    // the dictionary does not pay off if most of the strings are distinct
+    int maxDictionarySize = numStrings / 2;
+    std::unordered_map<std::string, int> dictionary;
+    std::vector<long> ids(numStrings);
+    std::vector<long> dictStarts;
+    dictStarts.reserve(maxDictionarySize + 1);
+    dictContent.clear();
+    for (int i = 0; i < numStrings; i++) {
+        std::string value(reinterpret_cast<const char *>(content + rawStarts[i]), rawStarts[i + 1] - rawStarts[i]);
+        auto it = dictionary.find(value);
+        if (it == dictionary.end()) {
+            if ((int) dictionary.size() >= maxDictionarySize) {
+                dictContent.clear();
+                return -1;
+            }
+            it = dictionary.emplace(std::move(value), (int) dictionary.size()).first;
+            dictStarts.push_back(dictContent.size());
+            dictContent.insert(dictContent.end(), content + rawStarts[i], content + rawStarts[i + 1]);
+        }
+        ids[i] = it->second;
+    }
+    dictStarts.push_back(dictContent.size());
+    dictionarySize = dictionary.size();
+
+    // ids and starts are non-negative, use unsigned run-length encoding as the reader does
+    RunLenIntEncoder idEncoder(false, true);
+    encodedIds.clear();
+    idPixelPositions.clear();
+    int resLen;
+    for (int i = 0; i < (int) pixelStringEnds.size(); i++) {
+        int first = i == 0 ? 0 : pixelStringEnds[i - 1];
+        int length = pixelStringEnds[i] - first;
+        idPixelPositions.push_back(encodedIds.size());
+        if (length == 0) {
+            continue;
+        }
+        std::vector<byte> buffer(RunLenIntEncoder::getMaxEncodedSize(length));
+        idEncoder.encode(ids.data(), first, length, buffer.data(), resLen);
+        encodedIds.insert(encodedIds.end(), buffer.begin(), buffer.begin() + resLen);
+    }
+    std::vector<byte> buffer(RunLenIntEncoder::getMaxEncodedSize(dictStarts.size()));
+    idEncoder.encode(dictStarts.data(), buffer.data(), dictStarts.size(), resLen);
+    encodedDictStarts.assign(buffer.begin(), buffer.begin() + resLen);
+    return encodedIds.size() + dictContent.size() + encodedDictStarts.size() + 2 * sizeof(int);
+}
+
+long StringColumnWriter::tryFsstEncode(const uint8_t *content, const std::vector<int> &rawStarts) {
+    int numStrings = rawStarts.size() - 1;
+    // small chunks do not pay off the symbol table
+    if (startOffset < 1024) {
+        return -1;
+    }
+    fsstEncoder = std::make_unique<FsstEncoder>();
+    fsstEncoder->train(content, rawStarts.data(), numStrings);
+    fsstContent.resize(FsstEncoder::maxEncodedLength(startOffset));
+    fsstStarts.resize(numStrings + 1);
+    int encodedLength = 0;
+    for (int i = 0; i < numStrings; i++) {
+        fsstStarts[i] = encodedLength;
+        encodedLength += fsstEncoder->encode(content + rawStarts[i], rawStarts[i + 1] - rawStarts[i],
+                                             fsstContent.data() + encodedLength);
+    }
+    fsstStarts[numStrings] = encodedLength;
+    return encodedLength + fsstEncoder->getSymbolTableSize() + (long) (numStrings + 1) * sizeof(int) + sizeof(int);
+}
+
+pixels::proto::ColumnEncoding StringColumnWriter::getColumnChunkEncoding() {
+    pixels::proto::ColumnEncoding encoding;
+    if (dictionaryEncoded) {
+        encoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_DICTIONARY);
+        encoding.set_dictionarysize(dictionarySize);
+        encoding.mutable_cascadeencoding()->set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_RUNLENGTH);
+    } else if (fsstEncoded) {
+        encoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_FSST);
+    } else {
+        encoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE);
+    }
+    return encoding;
+}
+
+void StringColumnWriter::newPixel() {
+    pixelStringEnds.push_back(startsArray->size());
+    ColumnWriter::newPixel();
+}
+
 void StringColumnWriter::newPixels() {
     std::cout << "Entering StringColumnWriter::newPixels" << std::endl;
-    ColumnWriter::newPixel();
+    newPixel();
     std::cout << "Exiting StringColumnWriter::newPixels" << std::endl;
 }
 
+void StringColumnWriter::reset() {
+    startsArray->clear();
+    startOffset = 0;
+    pixelStringEnds.clear();
+    idPixelPositions.clear();
+    dictionaryEncoded = false;
+    dictionarySize = 0;
+    dictContent.clear();
+    encodedDictStarts.clear();
+    fsstEncoded = false;
+    fsstEncoder.reset();
+    ColumnWriter::reset();
+}
+
 void StringColumnWriter::close() {
     std::cout << "Entering StringColumnWriter::close" << std::endl;
     startsArray->clear();
+    pixelStringEnds.clear();
     ColumnWriter::close();
     std::cout << "Exiting StringColumnWriter::close" << std::endl;
 }
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+#include "writer/StructColumnWriter.h"
+#include "writer/ColumnWriterBuilder.h"
+
+StructColumnWriter::StructColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption)
+{
+    for (const auto& child : type->getChildren())
+    {
+        fieldWriters.emplace_back(ColumnWriterBuilder::newColumnWriter(child, writerOption));
+    }
+}
+
+int StructColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::dynamic_pointer_cast<StructColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    if (columnVector->fields.size() != fieldWriters.size())
+    {
+        throw std::invalid_argument("Invalid number of struct fields");
+    }
+    if (!columnVector->noNulls)
+    {
+        // the fields of a null struct are null, so that a field can be read without its parent
+        for (const auto& field : columnVector->fields)
+        {
+            for (int i = 0; i < size; i++)
+            {
+                if (columnVector->isNull[i])
+                {
+                    field->isNull[i] = true;
+                    field->noNulls = false;
+                }
+            }
+        }
+    }
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartStruct(columnVector, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartStruct(columnVector, curPartLength, curPartOffset);
+
+    int dataLength = outputStream->getWritePos();
+    for (int i = 0; i < fieldWriters.size(); i++)
+    {
+        dataLength += fieldWriters[i]->write(columnVector->fields[i], size);
+    }
+    return dataLength;
+}
+
+void StructColumnWriter::writeCurPartStruct(std::shared_ptr<StructColumnVector> columnVector, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+        }
+        else
+        {
+            pixelStatRecorder->increment();
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool StructColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    // a struct has no values to be padded
+    return false;
+}
+
+std::vector<std::shared_ptr<ColumnWriter>> StructColumnWriter::getChildWriters()
+{
+    return fieldWriters;
+}
+
+void StructColumnWriter::reset()
+{
+    for (const auto& fieldWriter : fieldWriters)
+    {
+        fieldWriter->reset();
+    }
+    ColumnWriter::reset();
+}
+
+void StructColumnWriter::close()
+{
+    for (const auto& fieldWriter : fieldWriters)
+    {
+        fieldWriter->close();
+    }
+    ColumnWriter::close();
+}
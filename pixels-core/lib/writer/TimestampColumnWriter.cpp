@@ -90,6 +90,7 @@ void TimestampColumnWriter::writeCurPartTimestamp(std::shared_ptr<ColumnVector>
             curPixelVector[curPixelVectorIndex++] = values[i + curPartOffset];
         }
     }
+    pixelStatRecorder->updateTimestamp(values + curPartOffset, columnVector->isNull + curPartOffset, curPartLength);
     std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
     curPixelIsNullIndex += curPartLength;
 }
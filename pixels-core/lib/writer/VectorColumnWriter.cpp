@@ -0,0 +1,130 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "writer/VectorColumnWriter.h"
+#include "utils/EncodingUtils.h"
+#include <cstring>
+
+VectorColumnWriter::VectorColumnWriter(std::shared_ptr<TypeDescription> type, std::shared_ptr<PixelsWriterOption> writerOption) :
+ColumnWriter(type, writerOption), dimension((int) type->getDimension()), curPixelVector((long) pixelStride * type->getDimension())
+{
+}
+
+int VectorColumnWriter::write(std::shared_ptr<ColumnVector> vector, int size)
+{
+    auto columnVector = std::dynamic_pointer_cast<VectorColumnVector>(vector);
+    if (!columnVector)
+    {
+        throw std::invalid_argument("Invalid vector type");
+    }
+    if (columnVector->getDimension() != dimension)
+    {
+        throw std::invalid_argument("Invalid vector dimension");
+    }
+    float* values = columnVector->vector;
+
+    int curPartLength;         // size of the partition which belongs to current pixel
+    int curPartOffset = 0;     // starting offset of the partition which belongs to current pixel
+    int nextPartLength = size; // size of the partition which belongs to next pixel
+
+    // do the calculation to partition the vector into current pixel and next one
+    // doing this pre-calculation to eliminate branch prediction inside the for loop
+    while ((curPixelIsNullIndex + nextPartLength) >= pixelStride)
+    {
+        curPartLength = pixelStride - curPixelIsNullIndex;
+        writeCurPartVector(columnVector, values, curPartLength, curPartOffset);
+        newPixel();
+        curPartOffset += curPartLength;
+        nextPartLength = size - curPartOffset;
+    }
+
+    curPartLength = nextPartLength;
+    writeCurPartVector(columnVector, values, curPartLength, curPartOffset);
+
+    return outputStream->getWritePos();
+}
+
+void VectorColumnWriter::writeCurPartVector(std::shared_ptr<VectorColumnVector> columnVector, float* values, int curPartLength, int curPartOffset)
+{
+    for (int i = 0; i < curPartLength; i++)
+    {
+        curPixelEleIndex++;
+        float* dest = curPixelVector.data() + (long) curPixelVectorIndex * dimension;
+        if (columnVector->isNull[i + curPartOffset])
+        {
+            hasNull = true;
+            if (nullsPadding)
+            {
+                // padding a zero vector for nulls
+                std::fill(dest, dest + dimension, 0.0f);
+                curPixelVectorIndex++;
+            }
+        }
+        else
+        {
+            std::memcpy(dest, values + (long) (i + curPartOffset) * dimension, dimension * sizeof(float));
+            curPixelVectorIndex++;
+            pixelStatRecorder->increment();
+        }
+    }
+    std::copy(columnVector->isNull + curPartOffset, columnVector->isNull + curPartOffset + curPartLength, isNull.begin() + curPixelIsNullIndex);
+    curPixelIsNullIndex += curPartLength;
+}
+
+bool VectorColumnWriter::decideNullsPadding(std::shared_ptr<PixelsWriterOption> writerOption)
+{
+    if (writerOption->getEncodingLevel().ge(EncodingLevel::Level::EL2))
+    {
+        return false;
+    }
+    return writerOption->isNullsPadding();
+}
+
+void VectorColumnWriter::newPixel()
+{
+    // write out current pixel vector
+    long numElements = (long) curPixelVectorIndex * dimension;
+    auto curVecPartitionBuffer = std::make_shared<ByteBuffer>(numElements * sizeof(float));
+    EncodingUtils encodingUtils;
+    for (long i = 0; i < numElements; i++)
+    {
+        int bits;
+        std::memcpy(&bits, &curPixelVector[i], sizeof(float));
+        if (byteOrder == ByteOrder::PIXELS_LITTLE_ENDIAN)
+        {
+            encodingUtils.writeIntLE(curVecPartitionBuffer, bits);
+        }
+        else
+        {
+            encodingUtils.writeIntBE(curVecPartitionBuffer, bits);
+        }
+    }
+    outputStream->putBytes(curVecPartitionBuffer->getPointer(), curVecPartitionBuffer->getWritePos());
+
+    ColumnWriter::newPixel();
+}
+
+pixels::proto::ColumnEncoding VectorColumnWriter::getColumnChunkEncoding()
+{
+    pixels::proto::ColumnEncoding columnEncoding;
+    columnEncoding.set_kind(pixels::proto::ColumnEncoding::Kind::ColumnEncoding_Kind_NONE);
+    return columnEncoding;
+}
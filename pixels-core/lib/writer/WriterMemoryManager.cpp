@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024 PixelsDB.
+ *
+ * This file is part of Pixels.
+ *
+ * Pixels is free software: you can redistribute it and/or modify
+ * it under the terms of the Affero GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * Pixels is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * Affero GNU General Public License for more details.
+ *
+ * You should have received a copy of the Affero GNU General Public
+ * License along with Pixels.  If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "writer/WriterMemoryManager.h"
+#include "PixelsWriterImpl.h"
+#include "utils/ConfigFactory.h"
+
+WriterMemoryManager & WriterMemoryManager::Instance() {
+    static WriterMemoryManager instance;
+    return instance;
+}
+
+WriterMemoryManager::WriterMemoryManager() : totalBytes(0) {
+    budget = std::stoll(ConfigFactory::Instance().getProperty("writer.memory.budget"));
+}
+
+void WriterMemoryManager::addWriter(PixelsWriterImpl *writer) {
+    std::lock_guard<std::mutex> guard(lock);
+    writers.emplace(writer, WriterMemory());
+}
+
+void WriterMemoryManager::removeWriter(PixelsWriterImpl *writer) {
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = writers.find(writer);
+    if (it != writers.end()) {
+        totalBytes -= it->second.encodingBytes + it->second.flushingBytes;
+        writers.erase(it);
+    }
+}
+
+void WriterMemoryManager::setEncodingBytes(PixelsWriterImpl *writer, std::int64_t bytes) {
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = writers.find(writer);
+    if (it == writers.end()) {
+        return;
+    }
+    totalBytes += bytes - it->second.encodingBytes;
+    it->second.encodingBytes = bytes;
+    if (budget <= 0 || totalBytes <= budget) {
+        return;
+    }
+    // the row groups being flushed can not be flushed earlier, so flush the largest row group being encoded
+    PixelsWriterImpl *largest = nullptr;
+    std::int64_t largestBytes = 0;
+    for (const auto &entry : writers) {
+        if (entry.second.encodingBytes > largestBytes) {
+            largest = entry.first;
+            largestBytes = entry.second.encodingBytes;
+        }
+    }
+    if (largest != nullptr) {
+        largest->requestRowGroupFlush();
+    }
+}
+
+void WriterMemoryManager::setFlushingBytes(PixelsWriterImpl *writer, std::int64_t bytes) {
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = writers.find(writer);
+    if (it == writers.end()) {
+        return;
+    }
+    totalBytes += bytes - it->second.flushingBytes;
+    it->second.flushingBytes = bytes;
+}
+
+std::int64_t WriterMemoryManager::getBudget() const {
+    return budget;
+}
+
+std::int64_t WriterMemoryManager::getTotalBytes() {
+    std::lock_guard<std::mutex> guard(lock);
+    return totalBytes;
+}
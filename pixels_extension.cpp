@@ -5,6 +5,7 @@
 
 #include "pixels_extension.hpp"
 #include "PixelsScanFunction.hpp"
+#include "PixelsWriteFunction.hpp"
 #include "PixelsReadBindData.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
@@ -49,6 +50,11 @@ void PixelsExtension::Load(DuckDB &db) {
 	cinfo.name = "pixels_scan";
 
 	catalog.CreateTableFunction(context, &cinfo);
+
+	// COPY ... TO ... (FORMAT pixels)
+	auto copy_fun = PixelsWriteFunction::GetFunction();
+	CreateCopyFunctionInfo copy_info(copy_fun);
+	catalog.CreateCopyFunction(context, copy_info);
 	con.Commit();
 
 	auto &config = DBConfig::GetConfig(*db.instance);
@@ -0,0 +1,81 @@
+//
+// COPY ... TO ... (FORMAT pixels) round trips, the files are read back with pixels_scan.
+//
+#include "duckdb.hpp"
+#include "pixels_extension.hpp"
+#include "writer/WriterMemoryManager.h"
+#include <gtest/gtest.h>
+
+static const std::string CopyTestFilePath = "/tmp/pixels_copy_test.pxl";
+
+static std::unique_ptr<duckdb::MaterializedQueryResult> query(duckdb::Connection& con, const std::string& sql)
+{
+    auto result = con.Query(sql);
+    EXPECT_FALSE(result->HasError()) << sql << ": " << result->GetError();
+    return result;
+}
+
+static int64_t queryCount(duckdb::Connection& con, const std::string& sql)
+{
+    auto result = query(con, sql);
+    if (result->HasError())
+    {
+        return -1;
+    }
+    return result->GetValue(0, 0).GetValue<int64_t>();
+}
+
+TEST(copy, roundTrip)
+{
+    duckdb::DuckDB db(nullptr);
+    db.LoadExtension<duckdb::PixelsExtension>();
+    duckdb::Connection con(db);
+    // the times are whole milliseconds, the precision of the pixels time column;
+    // every row group has null structs, the struct nulls are a chunk of the column in each row group
+    query(con, "CREATE TABLE t AS SELECT "
+               "i % 3 = 0 AS b, "
+               "(i % 200 - 100)::TINYINT AS ti, "
+               "(i * 13)::INTEGER AS i32, "
+               "CASE WHEN i % 11 = 3 THEN NULL ELSE i * 1000003 END AS i64, "
+               "(i * 0.5)::FLOAT AS f, "
+               "i / 4 AS d, "
+               "((i % 19999 - 9999) / 10)::DECIMAL(4, 1) AS dec4, "
+               "(i * 3 / 100)::DECIMAL(9, 2) AS dec9, "
+               "CASE WHEN i % 17 = 1 THEN NULL ELSE (i * 1000000007 / 1000)::DECIMAL(18, 3) END AS dec18, "
+               "(i * 1000000007 / 10000)::DECIMAL(30, 4) AS dec30, "
+               "CASE WHEN i % 7 = 0 THEN NULL ELSE 'name-' || i || repeat('x', i % 20) END AS name, "
+               "('b' || i)::BLOB AS bl, "
+               "DATE '2000-01-01' + (i % 40000)::INTEGER AS dt, "
+               "TIME '00:00:00' + to_milliseconds((i * 997) % 86400000) AS tm, "
+               "TIMESTAMP '2024-01-01' + to_microseconds(i * 1000001) AS ts, "
+               "CASE WHEN i % 13 = 5 THEN NULL ELSE [i, i + 0.25, -i]::FLOAT[3] END AS emb, "
+               "CASE WHEN i % 5 = 0 THEN NULL ELSE range(i * 10, i * 10 + i % 4) END AS l, "
+               "CASE WHEN i % 9 = 0 THEN NULL ELSE {'x': i::INTEGER, 'y': 'y' || i} END AS s "
+               "FROM range(10000) r(i)");
+    query(con, "COPY t TO '" + CopyTestFilePath + "' (FORMAT pixels, ROW_GROUP_SIZE 4096, PIXEL_STRIDE 1000)");
+
+    std::string scan = "pixels_scan('" + CopyTestFilePath + "')";
+    EXPECT_EQ(queryCount(con, "SELECT count(*) FROM " + scan), 10000);
+    // set operations compare nulls as equal, so the file and the table hold the same rows
+    EXPECT_EQ(queryCount(con, "SELECT count(*) FROM (SELECT * FROM t EXCEPT ALL SELECT * FROM " + scan + ")"), 0);
+    EXPECT_EQ(queryCount(con, "SELECT count(*) FROM (SELECT * FROM " + scan + " EXCEPT ALL SELECT * FROM t)"), 0);
+    EXPECT_EQ(queryCount(con, "SELECT count(*) FROM " + scan + " WHERE s IS NULL"), 1112);
+    EXPECT_EQ(queryCount(con, "SELECT count(*) FROM " + scan + " WHERE name IS NULL"), 1429);
+}
+
+TEST(copy, sinkFailure)
+{
+    duckdb::DuckDB db(nullptr);
+    db.LoadExtension<duckdb::PixelsExtension>();
+    duckdb::Connection con(db);
+    std::int64_t totalBytes = WriterMemoryManager::Instance().getTotalBytes();
+    // the query fails after the first row groups are handed to the flush stage,
+    // the writer is then destroyed without being closed
+    auto result = con.Query("COPY (SELECT CASE WHEN i < 9000 THEN i ELSE error('copy failure')::BIGINT END AS i "
+                            "FROM range(10000) r(i)) TO '" + CopyTestFilePath + "' (FORMAT pixels, ROW_GROUP_SIZE 1)");
+    EXPECT_TRUE(result->HasError());
+    EXPECT_EQ(WriterMemoryManager::Instance().getTotalBytes(), totalBytes);
+
+    query(con, "COPY (SELECT i FROM range(100) r(i)) TO '" + CopyTestFilePath + "' (FORMAT pixels)");
+    EXPECT_EQ(queryCount(con, "SELECT sum(i) FROM pixels_scan('" + CopyTestFilePath + "')"), 4950);
+}
@@ -3,13 +3,60 @@
 ////
 #include "encoding/RunLenIntEncoder.h"
 #include "encoding/RunLenIntDecoder.h"
+#include "PixelsWriterImpl.h"
+#include "PixelsReaderBuilder.h"
+#include "physical/StorageFactory.h"
+#include "physical/BufferPool.h"
+#include "physical/natives/DirectUringRandomAccessFile.h"
+#include "physical/storage/PhysicalLocalWriter.h"
+#include "physical/natives/SegmentedOutputStream.h"
+#include "vector/BinaryColumnVector.h"
+#include "vector/ByteColumnVector.h"
+#include "vector/DecimalColumnVector.h"
+#include "vector/LongDecimalColumnVector.h"
+#include "vector/TimeColumnVector.h"
+#include "vector/VectorColumnVector.h"
+#include "vector/StructColumnVector.h"
+#include "vector/ListColumnVector.h"
+#include "reader/PixelsRecordReaderImpl.h"
+#include "reader/VectorPredicate.h"
+#include "PixelsFilter.h"
+#include "utils/VectorDistance.h"
+#include "vector/DoubleColumnVector.h"
+#include "vector/LongColumnVector.h"
+#include "encoding/FsstEncoder.h"
+#include "encoding/FsstDecoder.h"
+#include "encoding/EncodingSelector.h"
+#include "encoding/ByteStreamSplit.h"
+#include "compression/CompressionCodecFactory.h"
+#include "writer/CharColumnWriter.h"
+#include "writer/WriterMemoryManager.h"
+#include "writer/SortedRowBuffer.h"
+#include "writer/ColumnWriterBuilder.h"
+#include "utils/BloomFilter.h"
+#include "utils/Partitioner.h"
+#include "stats/IntegerStatsRecorder.h"
+#include "stats/StringStatsRecorder.h"
+#include "utils/ConfigFactory.h"
+#include "exception/InvalidArgumentException.h"
 
 #include <gtest/gtest.h>
 #include <iostream>
 #include <thread>
 #include <string>
 #include <random>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <set>
+#include <map>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <tuple>
 #include "PixelsBitMask.h"
+#include "utils/BitUtils.h"
+#include "utils/ThreadPool.h"
 using namespace std;
 //
 //
@@ -632,7 +679,7 @@ TEST(reader, runLengthTest) {
     }
     long* decoderValues = new long[TestRowNum];
     RunLenIntEncoder encoder(true, true);
-    byte* bytes = new byte[TestRowNum * sizeof(long) * 2];
+    uint8_t* bytes = new uint8_t[TestRowNum * sizeof(long) * 2];
     int len = 0;
     encoder.encode(values, bytes, TestRowNum, len);
     std::shared_ptr<ByteBuffer> buffer = std::make_shared<ByteBuffer>(bytes, len, true);
@@ -648,3 +695,2054 @@ TEST(reader, runLengthTest) {
     delete[] values;
     delete[] decoderValues;
 }
+
+/**
+ * Encode the values, then decode them twice: once value by value, and once
+ * with the bulk next() in chunks of random size.
+ * Returns the encoding type of the first run.
+ */
+static int runLengthRoundTrip(std::vector<long>& values, bool isSigned, std::default_random_engine& e) {
+    int n = values.size();
+    RunLenIntEncoder encoder(isSigned, true);
+    std::vector<uint8_t> bytes(RunLenIntEncoder::getMaxEncodedSize(n));
+    int len = 0;
+    encoder.encode(values.data(), bytes.data(), n, len);
+    EXPECT_LE(len, (int) bytes.size());
+
+    uint8_t* copy = new uint8_t[len];
+    memcpy(copy, bytes.data(), len);
+    RunLenIntDecoder scalarDecoder(std::make_shared<ByteBuffer>(copy, len, true), isSigned);
+    for(int i = 0; i < n; i++) {
+        EXPECT_TRUE(scalarDecoder.hasNext());
+        long v = scalarDecoder.next();
+        if(v != values[i]) {
+            ADD_FAILURE() << "scalar next() differs at " << i << ": " << v << " != " << values[i];
+            break;
+        }
+    }
+    EXPECT_FALSE(scalarDecoder.hasNext());
+
+    copy = new uint8_t[len];
+    memcpy(copy, bytes.data(), len);
+    RunLenIntDecoder bulkDecoder(std::make_shared<ByteBuffer>(copy, len, true), isSigned);
+    std::uniform_int_distribution<int> chunkDist(1, 700);
+    std::vector<long> decoded(n);
+    for(int offset = 0; offset < n; ) {
+        int chunk = std::min(n - offset, chunkDist(e));
+        bulkDecoder.next(decoded.data(), offset, chunk);
+        offset += chunk;
+    }
+    for(int i = 0; i < n; i++) {
+        if(decoded[i] != values[i]) {
+            ADD_FAILURE() << "bulk next() differs at " << i << ": " << decoded[i] << " != " << values[i];
+            break;
+        }
+    }
+    return (bytes[0] >> 6) & 0x03;
+}
+
+TEST(reader, runLengthPatchedBaseTest) {
+    std::default_random_engine e(26);
+    // each case is one run of 512 values with outliers at the given indexes.
+    // gaps over 255 need one extra patch entry and a gap of 511 needs two.
+    std::vector<std::vector<int>> outlierCases = {
+            {5, 100}, {0}, {0, 255}, {40, 296}, {0, 300}, {1, 200, 460},
+            {511}, {0, 511}, {100, 356, 511}
+    };
+    for(const auto& outliers: outlierCases) {
+        for(bool isSigned: {true, false}) {
+            std::vector<long> values(512);
+            for(int i = 0; i < 512; i++) {
+                values[i] = (i * 5) % 13;
+            }
+            for(int idx: outliers) {
+                values[idx] = 1000000000000L + idx;
+            }
+            EXPECT_EQ(RunLenIntEncoder::PATCHED_BASE, runLengthRoundTrip(values, isSigned, e));
+        }
+    }
+
+    // small values with rare large outliers, spanning several runs
+    std::uniform_int_distribution<long> smallDist(0, 15);
+    std::uniform_int_distribution<long> outlierDist(0, 1000000000000L);
+    std::uniform_int_distribution<int> oneInHundred(0, 99);
+    for(int iter = 0; iter < 50; iter++) {
+        std::vector<long> values(2237);
+        for(auto& v: values) {
+            v = oneInHundred(e) == 0 ? outlierDist(e) : smallDist(e);
+        }
+        runLengthRoundTrip(values, iter % 2 == 0, e);
+    }
+}
+
+TEST(reader, runLengthBitWidthTest) {
+    std::default_random_engine e(31);
+    for(int width = 1; width < 64; width++) {
+        std::uniform_int_distribution<long> dist(0, (long) ((1UL << width) - 1));
+        std::vector<long> values(1000);
+        for(auto& v: values) {
+            v = dist(e);
+        }
+        runLengthRoundTrip(values, false, e);
+        // negative values are zigzag encoded, so they take one more bit
+        if(width < 63) {
+            for(int i = 0; i < 1000; i += 2) {
+                values[i] = -values[i];
+            }
+            runLengthRoundTrip(values, true, e);
+        }
+    }
+    std::uniform_int_distribution<long> fullDist;
+    std::vector<long> values(1000);
+    for(auto& v: values) {
+        v = fullDist(e);
+    }
+    runLengthRoundTrip(values, true, e);
+}
+
+TEST(reader, runLengthChunkedTest) {
+    std::default_random_engine e(42);
+    std::uniform_int_distribution<int> lengthDist(1, 3000);
+    std::uniform_int_distribution<long> smallDist(0, 63);
+    for(int iter = 0; iter < 40; iter++) {
+        std::vector<long> values(lengthDist(e));
+        int n = values.size();
+        for(int i = 0; i < n; i++) {
+            switch(iter % 4) {
+                case 0: values[i] = (i / 50) % 3; break;          // repeats
+                case 1: values[i] = 1000 + i * 7; break;          // fixed delta
+                case 2: values[i] = smallDist(e) - 32; break;     // direct
+                default: values[i] = i % 100 < 10 ? 7 : smallDist(e) * i; break;
+            }
+        }
+        runLengthRoundTrip(values, true, e);
+    }
+}
+
+static const std::string TestFilePath = "/tmp/pixels_unit_test.pxl";
+
+/**
+ * Write the row batch into one row group of TestFilePath.
+ */
+static void writeTestFile(const std::shared_ptr<TypeDescription>& schema,
+                          const std::shared_ptr<VectorizedRowBatch>& rowBatch, int pixelStride) {
+    std::remove(TestFilePath.c_str());
+    auto writer = std::make_shared<PixelsWriterImpl>(schema, pixelStride, 1 << 20, TestFilePath, 1 << 20,
+                                                     true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+    writer->addRowBatch(rowBatch);
+    writer->close();
+}
+
+static std::shared_ptr<PixelsReader> openTestFile(
+        const std::shared_ptr<PixelsFooterCache>& footerCache = std::make_shared<PixelsFooterCache>()) {
+    // the buffer pool and the io_uring buffers are sized for the columns of the previous file
+    ::BufferPool::Reset();
+    ::DirectUringRandomAccessFile::Reset();
+    ::DirectUringRandomAccessFile::Initialize();
+    auto storage = StorageFactory::getInstance()->getStorage(Storage::file);
+    return std::make_shared<PixelsReaderBuilder>()
+            ->setPath(TestFilePath)
+            ->setStorage(storage)
+            ->setPixelsFooterCache(footerCache)
+            ->build();
+}
+
+static PixelsReaderOption testReaderOption(const std::shared_ptr<PixelsReader>& reader, int batchSize) {
+    PixelsReaderOption option;
+    option.setIncludeCols(reader->getFileSchema()->getFieldNames());
+    option.setRGRange(0, reader->getRowGroupNum());
+    option.setBatchSize(batchSize);
+    option.setQueryId(1);
+    option.setEnableEncodedColumnVector(true);
+    option.setEnabledFilterPushDown(false);
+    return option;
+}
+
+TEST(reader, decimalRunLengthTest) {
+    // runs of repeated values and nulls, which are not padded in the run-length encoded pixels
+    const int pixelStride = 16;
+    const int numRows = 80;
+    std::set<int> nullRows = {0, 5, 17, 40, 41, 42, 79};
+    auto schema = TypeDescription::fromString("struct<d:decimal(10,2)>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    for(int i = 0; i < numRows; i++) {
+        if(nullRows.count(i)) {
+            rowBatch->cols[0]->addNull();
+        } else {
+            std::string value = std::to_string(i / 8 - 3) + "." + std::to_string(10 + i % 3);
+            rowBatch->cols[0]->add(value);
+        }
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    auto reader = openTestFile();
+    auto recordReader = reader->read(testReaderOption(reader, pixelStride));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto decimals = std::static_pointer_cast<DecimalColumnVector>(result->cols[0]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            bool isNull = nullRows.count(row) > 0;
+            EXPECT_EQ(!isNull, decimals->checkValid(i)) << "row " << row;
+            if(!isNull) {
+                long unscaled = (row / 8 - 3) * 100;
+                unscaled += unscaled < 0 ? -(10 + row % 3) : 10 + row % 3;
+                EXPECT_EQ(unscaled, decimals->vector[i]) << "row " << row;
+            }
+        }
+    }
+    EXPECT_EQ(numRows, row);
+}
+
+/**
+ * Compress the data in blocks and check that it decompresses to the same bytes.
+ * @return the compressed length
+ */
+static size_t compressionRoundTrip(CompressionCodec& codec, const std::vector<uint8_t>& data,
+                                   int blockSize, int level) {
+    std::vector<uint8_t> compressed;
+    codec.compressBlocks(data.data(), data.size(), blockSize, level, compressed);
+    std::vector<uint8_t> decompressed(data.size());
+    codec.decompressBlocks(compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+    EXPECT_TRUE(decompressed == data);
+    return compressed.size();
+}
+
+static void compressionCodecTest(pixels::proto::CompressionKind kind, const std::vector<int>& levels) {
+    std::shared_ptr<CompressionCodec> codec;
+    try {
+        codec = CompressionCodecFactory::Instance()->getCodec(kind);
+    } catch (InvalidArgumentException& e) {
+        GTEST_SKIP() << pixels::proto::CompressionKind_Name(kind) << " is not built in";
+    }
+    std::default_random_engine e(27);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::vector<uint8_t> repetitive(100000);
+    for(size_t i = 0; i < repetitive.size(); i++) {
+        repetitive[i] = (i / 16) % 7;
+    }
+    std::vector<uint8_t> random(100000);
+    for(auto& b: random) {
+        b = byteDist(e);
+    }
+    for(int level: levels) {
+        for(int blockSize: {1000, 4096, 65536, 1 << 20}) {
+            EXPECT_LT(compressionRoundTrip(*codec, repetitive, blockSize, level), repetitive.size());
+            // incompressible blocks are stored as is, behind their headers
+            size_t numBlocks = (random.size() + blockSize - 1) / blockSize;
+            EXPECT_EQ(random.size() + numBlocks * CompressionCodec::BLOCK_HEADER_SIZE,
+                      compressionRoundTrip(*codec, random, blockSize, level));
+        }
+        EXPECT_EQ(0, compressionRoundTrip(*codec, std::vector<uint8_t>(), 4096, level));
+        compressionRoundTrip(*codec, std::vector<uint8_t>(1, 42), 4096, level);
+    }
+
+    // a corrupted block must be rejected, not decoded into garbage
+    std::vector<uint8_t> compressed;
+    codec->compressBlocks(repetitive.data(), repetitive.size(), 4096, levels[0], compressed);
+    std::vector<uint8_t> decompressed(repetitive.size());
+    EXPECT_THROW(codec->decompressBlocks(compressed.data(), compressed.size() - 1,
+                                         decompressed.data(), decompressed.size()), InvalidArgumentException);
+    compressed[CompressionCodec::BLOCK_HEADER_SIZE] ^= 0xff;
+    compressed[CompressionCodec::BLOCK_HEADER_SIZE + 1] ^= 0xff;
+    EXPECT_THROW(codec->decompressBlocks(compressed.data(), compressed.size(),
+                                         decompressed.data(), decompressed.size()), InvalidArgumentException);
+}
+
+TEST(compression, lz4RoundTrip) {
+    // levels below 3 use the fast compressor, the others LZ4 HC
+    compressionCodecTest(pixels::proto::LZ4, {1, 9});
+}
+
+TEST(compression, zstdRoundTrip) {
+    compressionCodecTest(pixels::proto::ZSTD, {1, 3, 19});
+}
+
+TEST(compression, parseCompressionKind) {
+    EXPECT_EQ(pixels::proto::NONE, CompressionCodecFactory::parseCompressionKind(""));
+    EXPECT_EQ(pixels::proto::LZ4, CompressionCodecFactory::parseCompressionKind("LZ4"));
+    EXPECT_EQ(pixels::proto::ZSTD, CompressionCodecFactory::parseCompressionKind("zstd"));
+    EXPECT_THROW(CompressionCodecFactory::parseCompressionKind("snappy"), InvalidArgumentException);
+    EXPECT_EQ(nullptr, CompressionCodecFactory::Instance()->getCodec(pixels::proto::NONE));
+}
+
+TEST(compression, compressedFileRoundTrip) {
+    const int pixelStride = 100;
+    const int numRows = 300;
+    auto schema = TypeDescription::fromString("struct<a:bigint,b:bigint>");
+    for(std::string kind: {"none", "lz4", "zstd"}) {
+        try {
+            CompressionCodecFactory::Instance()->getCodec(CompressionCodecFactory::parseCompressionKind(kind));
+        } catch (InvalidArgumentException& e) {
+            // the codec is not built in
+            continue;
+        }
+        ConfigFactory::Instance().addProperty("column.chunk.compression", kind);
+        auto rowBatch = schema->createRowBatch(numRows);
+        for(int i = 0; i < numRows; i++) {
+            rowBatch->cols[0]->add((int64_t) i / 7);
+            rowBatch->cols[1]->add((int64_t) i % 50);
+            rowBatch->rowCount++;
+        }
+        writeTestFile(schema, rowBatch, pixelStride);
+        auto reader = openTestFile();
+        auto recordReader = reader->read(testReaderOption(reader, pixelStride));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto longs = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+            auto moduli = std::static_pointer_cast<LongColumnVector>(result->cols[1]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(row / 7, longs->longVector[i]) << kind << " row " << row;
+                ASSERT_EQ(row % 50, moduli->longVector[i]) << kind << " row " << row;
+            }
+        }
+        EXPECT_EQ(numRows, row) << kind;
+    }
+    ConfigFactory::Instance().addProperty("column.chunk.compression", "none");
+}
+
+/**
+ * Train a symbol table on the first half of the strings, then encode and decode every string.
+ * @return the total encoded length of the strings
+ */
+static long fsstRoundTrip(const std::vector<std::string>& strings) {
+    std::string content;
+    std::vector<int> starts{0};
+    for(size_t i = 0; i < strings.size() / 2 + 1 && i < strings.size(); i++) {
+        content += strings[i];
+        starts.push_back(content.size());
+    }
+    FsstEncoder encoder;
+    encoder.train((const uint8_t*) content.data(), starts.data(), starts.size() - 1);
+    auto table = std::make_shared<SegmentedOutputStream>();
+    encoder.writeSymbolTable(table);
+    EXPECT_EQ(encoder.getSymbolTableSize(), (int) table->getWritePos());
+    std::vector<uint8_t> scratch;
+    FsstDecoder decoder(table->getContent(scratch), table->getWritePos());
+
+    long encodedTotal = 0;
+    for(const auto& str: strings) {
+        int length = str.size();
+        std::vector<uint8_t> encoded(FsstEncoder::maxEncodedLength(length));
+        int encodedLength = encoder.encode((const uint8_t*) str.data(), length, encoded.data());
+        EXPECT_LE(encodedLength, FsstEncoder::maxEncodedLength(length));
+        encodedTotal += encodedLength;
+        std::vector<uint8_t> decoded(FsstDecoder::maxDecodedLength(encodedLength));
+        int decodedLength = decoder.decode(encoded.data(), encodedLength, decoded.data());
+        if(decodedLength != length || std::memcmp(decoded.data(), str.data(), length) != 0) {
+            ADD_FAILURE() << "FSST round trip differs for a string of length " << length;
+            break;
+        }
+    }
+    return encodedTotal;
+}
+
+TEST(reader, fsstTest) {
+    std::default_random_engine e(28);
+    std::uniform_int_distribution<int> dist(0, 1 << 30);
+    const char* domains[] = {"google.com", "example.org", "pixelsdb.io", "wikipedia.org"};
+
+    std::vector<std::string> urls;
+    long rawLength = 0;
+    for(int i = 0; i < 3000; i++) {
+        urls.push_back(std::string("https://www.") + domains[dist(e) % 4] + "/path/" +
+                       std::to_string(dist(e) % 1000) + "?q=" + std::to_string(dist(e)));
+        rawLength += urls.back().size();
+    }
+    EXPECT_LT(fsstRoundTrip(urls), rawLength / 2);
+
+    // random bytes, including the escape code
+    std::vector<std::string> binary;
+    for(int i = 0; i < 2000; i++) {
+        std::string str(dist(e) % 40, '\0');
+        for(auto& c: str) {
+            c = (char) (dist(e) % 256);
+        }
+        binary.push_back(str);
+    }
+    fsstRoundTrip(binary);
+
+    // empty and very short strings, and strings with long runs of one byte
+    std::vector<std::string> shortStrings;
+    for(int i = 0; i < 2000; i++) {
+        shortStrings.push_back(std::string(dist(e) % 3, 'a' + dist(e) % 3));
+        shortStrings.push_back(std::string(dist(e) % 100, '\xff'));
+    }
+    fsstRoundTrip(shortStrings);
+
+    // nothing to train on
+    fsstRoundTrip({""});
+}
+
+TEST(reader, fsstFileRoundTrip) {
+    const int pixelStride = 32;
+    const int numRows = 120;
+    auto schema = TypeDescription::fromString("struct<s:string>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::vector<std::string> values;
+    for(int i = 0; i < numRows; i++) {
+        values.push_back(i % 11 == 3 ? "" : "https://www.pixelsdb.io/" + std::to_string(i % 17));
+        if(i % 9 == 4) {
+            rowBatch->cols[0]->addNull();
+        } else {
+            rowBatch->cols[0]->add(values[i]);
+        }
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    auto reader = openTestFile();
+    auto recordReader = reader->read(testReaderOption(reader, pixelStride));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto strings = std::static_pointer_cast<BinaryColumnVector>(result->cols[0]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            ASSERT_EQ(row % 9 != 4, strings->checkValid(i)) << "row " << row;
+            if(row % 9 != 4) {
+                ASSERT_EQ(values[row], strings->vector[i].GetString()) << "row " << row;
+            }
+        }
+    }
+    EXPECT_EQ(numRows, row);
+}
+
+TEST(writer, encodingSelectorTest) {
+    // 100 values in 15 bytes of runs are cheaper than 800 plain bytes, 700 bytes of noise are not
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_RUNLENGTH, EncodingSelector::selectIntegerEncoding(100, 800, 15));
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_NONE, EncodingSelector::selectIntegerEncoding(100, 800, 790));
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_NONE, EncodingSelector::selectStringEncoding(100, 1000, -1, -1));
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_DICTIONARY, EncodingSelector::selectStringEncoding(100, 1000, 100, 900));
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_FSST, EncodingSelector::selectStringEncoding(100, 1000, -1, 400));
+}
+
+TEST(writer, adaptiveEncodingRoundTrip) {
+    const int pixelStride = 40;
+    const int numRows = 120;
+    auto schema = TypeDescription::fromString("struct<runs:bigint,noise:bigint,dict:string,urls:string>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::default_random_engine e(29);
+    // full-width values do not shrink by bit packing
+    std::uniform_int_distribution<int64_t> dist;
+    const char* colors[] = {"red", "green", "blue"};
+    std::vector<int64_t> noise;
+    std::vector<std::string> urls;
+    for(int i = 0; i < numRows; i++) {
+        noise.push_back(dist(e));
+        urls.push_back("https://www.pixelsdb.io/" + std::to_string(i));
+        rowBatch->cols[0]->add((int64_t) i / 20);
+        rowBatch->cols[1]->add(noise[i]);
+        if(i % 13 == 7) {
+            rowBatch->cols[2]->addNull();
+        } else {
+            std::string color = colors[i % 3];
+            rowBatch->cols[2]->add(color);
+        }
+        rowBatch->cols[3]->add(urls[i]);
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    auto footerCache = std::make_shared<PixelsFooterCache>();
+    auto reader = openTestFile(footerCache);
+    auto recordReader = reader->read(testReaderOption(reader, pixelStride));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto runs = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        auto noises = std::static_pointer_cast<LongColumnVector>(result->cols[1]);
+        auto dicts = std::static_pointer_cast<BinaryColumnVector>(result->cols[2]);
+        auto strings = std::static_pointer_cast<BinaryColumnVector>(result->cols[3]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            ASSERT_EQ(row / 20, runs->longVector[i]) << "row " << row;
+            ASSERT_EQ(noise[row], noises->longVector[i]) << "row " << row;
+            ASSERT_EQ(row % 13 != 7, dicts->checkValid(i)) << "row " << row;
+            if(row % 13 != 7) {
+                ASSERT_EQ(colors[row % 3], dicts->vector[i].GetString()) << "row " << row;
+            }
+            ASSERT_EQ(urls[row], strings->vector[i].GetString()) << "row " << row;
+        }
+    }
+    EXPECT_EQ(numRows, row);
+
+    // row group footers are cached by the file name and the row group id
+    std::string fileName = TestFilePath.substr(TestFilePath.find_last_of('/') + 1);
+    auto encodings = footerCache->getRGFooter(fileName + "-0")->rowgroupencoding();
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_RUNLENGTH, encodings.columnchunkencodings(0).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_NONE, encodings.columnchunkencodings(1).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_DICTIONARY, encodings.columnchunkencodings(2).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_FSST, encodings.columnchunkencodings(3).kind());
+}
+
+TEST(reader, nullsAcrossPixelsTest) {
+    // row batches take a part of a pixel or span several pixels, pixels with and without nulls follow each other
+    const int pixelStride = 16;
+    const int numRows = 64;
+    std::set<int> nullRows = {3, 20, 21, 30, 63};
+    auto schema = TypeDescription::fromString("struct<a:bigint,b:string>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    for(int i = 0; i < numRows; i++) {
+        if(nullRows.count(i)) {
+            rowBatch->cols[0]->addNull();
+            rowBatch->cols[1]->addNull();
+        } else {
+            rowBatch->cols[0]->add((int64_t) i);
+            std::string value = "s" + std::to_string(i);
+            rowBatch->cols[1]->add(value);
+        }
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    for(int batchSize: {4, 7, 8, pixelStride, 20, numRows}) {
+        auto reader = openTestFile();
+        auto recordReader = reader->read(testReaderOption(reader, batchSize));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto longs = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+            auto strings = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                bool isNull = nullRows.count(row) > 0;
+                ASSERT_EQ(!isNull, longs->checkValid(i)) << "long row " << row << " batch size " << batchSize;
+                ASSERT_EQ(!isNull, strings->checkValid(i)) << "string row " << row << " batch size " << batchSize;
+                if(!isNull) {
+                    ASSERT_EQ(row, longs->longVector[i]) << "batch size " << batchSize;
+                    ASSERT_EQ("s" + std::to_string(row), strings->vector[i].GetString()) << "batch size " << batchSize;
+                }
+            }
+        }
+        EXPECT_EQ(numRows, row) << "batch size " << batchSize;
+    }
+}
+
+TEST(reader, byteStreamSplitTest) {
+    std::default_random_engine e(31);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    for(int width: {4, 8}) {
+        // around the 16 values decoded per SIMD step
+        for(int numValues: {1, 3, 15, 16, 17, 31, 32, 33, 100, 1000, 1027}) {
+            std::vector<uint8_t> values(numValues * width);
+            for(auto& b: values) {
+                b = byteDist(e);
+            }
+            std::vector<uint8_t> streams(values.size());
+            ByteStreamSplit::encode(values.data(), numValues, width, streams.data());
+            for(int i = 0; i < numValues; i++) {
+                for(int k = 0; k < width; k++) {
+                    ASSERT_EQ(values[i * width + k], streams[k * numValues + i]);
+                }
+            }
+
+            std::vector<uint8_t> decoded(values.size());
+            ByteStreamSplit::decode(streams.data(), numValues, numValues, width, decoded.data());
+            EXPECT_TRUE(decoded == values);
+
+            // decode a pixel in several batches of random size
+            std::fill(decoded.begin(), decoded.end(), 0);
+            std::uniform_int_distribution<int> batchDist(1, 40);
+            for(int start = 0; start < numValues; ) {
+                int count = std::min(numValues - start, batchDist(e));
+                ByteStreamSplit::decode(streams.data() + start, numValues, count, width,
+                                        decoded.data() + start * width);
+                start += count;
+            }
+            EXPECT_TRUE(decoded == values);
+        }
+    }
+
+    // special floating point values keep their exact bits
+    std::vector<double> doubles = {0.0, -0.0, 1.5, -2.25, std::numeric_limits<double>::infinity(),
+                                   -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(),
+                                   std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::max()};
+    std::vector<uint8_t> streams(doubles.size() * sizeof(double));
+    std::vector<double> decoded(doubles.size());
+    ByteStreamSplit::encode((const uint8_t*) doubles.data(), doubles.size(), sizeof(double), streams.data());
+    ByteStreamSplit::decode(streams.data(), doubles.size(), doubles.size(), sizeof(double), (uint8_t*) decoded.data());
+    EXPECT_EQ(0, std::memcmp(doubles.data(), decoded.data(), doubles.size() * sizeof(double)));
+}
+
+TEST(reader, floatingPointFileRoundTrip) {
+    const int pixelStride = 20;
+    const int numRows = 100;
+    auto schema = TypeDescription::fromString("struct<f:float,d:double>");
+    std::default_random_engine e(31);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::vector<double> values;
+    for(int i = 0; i < numRows; i++) {
+        values.push_back(i % 10 == 0 ? -0.0 : dist(e));
+    }
+    for(std::string kind: {"none", "lz4", "zstd"}) {
+        try {
+            CompressionCodecFactory::Instance()->getCodec(CompressionCodecFactory::parseCompressionKind(kind));
+        } catch (InvalidArgumentException& e) {
+            // the codec is not built in
+            continue;
+        }
+        ConfigFactory::Instance().addProperty("column.chunk.compression", kind);
+        auto rowBatch = schema->createRowBatch(numRows);
+        auto floats = std::static_pointer_cast<DoubleColumnVector>(rowBatch->cols[0]);
+        auto doubles = std::static_pointer_cast<DoubleColumnVector>(rowBatch->cols[1]);
+        for(int i = 0; i < numRows; i++) {
+            if(i % 7 == 2) {
+                floats->addNull();
+                doubles->addNull();
+            } else {
+                floats->add(values[i]);
+                doubles->add(values[i]);
+            }
+            rowBatch->rowCount++;
+        }
+        writeTestFile(schema, rowBatch, pixelStride);
+
+        for(int batchSize: {4, pixelStride}) {
+            auto footerCache = std::make_shared<PixelsFooterCache>();
+            auto reader = openTestFile(footerCache);
+            auto recordReader = reader->read(testReaderOption(reader, batchSize));
+            int row = 0;
+            while(!recordReader->isEndOfFile()) {
+                auto result = recordReader->readBatch(false);
+                auto floatResult = std::static_pointer_cast<DoubleColumnVector>(result->cols[0]);
+                auto doubleResult = std::static_pointer_cast<DoubleColumnVector>(result->cols[1]);
+                for(int i = 0; i < result->rowCount; i++, row++) {
+                    ASSERT_EQ(row % 7 != 2, floatResult->checkValid(i)) << kind << " row " << row;
+                    ASSERT_EQ(row % 7 != 2, doubleResult->checkValid(i)) << kind << " row " << row;
+                    if(row % 7 != 2) {
+                        float expected = values[row];
+                        ASSERT_EQ(0, std::memcmp(&expected, floatResult->floatVector + i, sizeof(float)))
+                            << kind << " row " << row;
+                        ASSERT_EQ(0, std::memcmp(&values[row], doubleResult->doubleVector + i, sizeof(double)))
+                            << kind << " row " << row;
+                    }
+                }
+            }
+            EXPECT_EQ(numRows, row) << kind;
+
+            // byte-stream-split is only used with compression
+            std::string fileName = TestFilePath.substr(TestFilePath.find_last_of('/') + 1);
+            auto encodings = footerCache->getRGFooter(fileName + "-0")->rowgroupencoding();
+            auto expectedKind = kind == "none" ? pixels::proto::ColumnEncoding_Kind_NONE
+                                               : pixels::proto::ColumnEncoding_Kind_BYTE_STREAM_SPLIT;
+            EXPECT_EQ(expectedKind, encodings.columnchunkencodings(0).kind()) << kind;
+            EXPECT_EQ(expectedKind, encodings.columnchunkencodings(1).kind()) << kind;
+        }
+    }
+    ConfigFactory::Instance().addProperty("column.chunk.compression", "none");
+}
+
+TEST(reader, unpackBitsTest) {
+    std::default_random_engine e(32);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::vector<uint8_t> bits(64);
+    for(auto& b: bits) {
+        b = byteDist(e);
+    }
+    // unaligned starts and counts around the 32 values unpacked per AVX2 step
+    for(int bitOffset: {0, 1, 7, 8, 13}) {
+        for(int numValues: {0, 1, 8, 31, 32, 33, 100, 400}) {
+            std::vector<uint8_t> values(numValues, 2);
+            BitUtils::unpackBits(bits.data(), bitOffset, values.data(), numValues);
+            for(int i = 0; i < numValues; i++) {
+                int bit = bitOffset + i;
+                ASSERT_EQ((bits[bit / 8] >> (bit % 8)) & 1, values[i])
+                    << "offset " << bitOffset << " value " << i;
+            }
+        }
+    }
+}
+
+TEST(reader, booleanByteFileRoundTrip) {
+    // run-length encoding only pays off for booleans in long runs, hence the large pixels
+    const int pixelStride = 1000;
+    const int numRows = 2000;
+    // b: bit-packed booleans, t: bytes, r: booleans in runs long enough for run-length encoding
+    auto schema = TypeDescription::fromString("struct<b:boolean,t:tinyint,r:boolean>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::default_random_engine e(32);
+    std::uniform_int_distribution<int> dist(-128, 127);
+    std::vector<int> bytes;
+    for(int i = 0; i < numRows; i++) {
+        bytes.push_back(dist(e));
+        if(i % 11 == 5) {
+            rowBatch->cols[0]->addNull();
+            rowBatch->cols[1]->addNull();
+        } else {
+            rowBatch->cols[0]->add(bytes[i] % 2 == 0);
+            rowBatch->cols[1]->add(bytes[i]);
+        }
+        rowBatch->cols[2]->add(i / 1000 == 0);
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    for(int batchSize: {20, 200, pixelStride}) {
+        auto footerCache = std::make_shared<PixelsFooterCache>();
+        auto reader = openTestFile(footerCache);
+        auto recordReader = reader->read(testReaderOption(reader, batchSize));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto booleans = std::static_pointer_cast<ByteColumnVector>(result->cols[0]);
+            auto tinyints = std::static_pointer_cast<ByteColumnVector>(result->cols[1]);
+            auto runs = std::static_pointer_cast<ByteColumnVector>(result->cols[2]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(row % 11 != 5, booleans->checkValid(i)) << "row " << row;
+                ASSERT_EQ(row % 11 != 5, tinyints->checkValid(i)) << "row " << row;
+                if(row % 11 != 5) {
+                    ASSERT_EQ(bytes[row] % 2 == 0, booleans->vector[i]) << "row " << row;
+                    ASSERT_EQ(bytes[row], (int8_t) tinyints->vector[i]) << "row " << row;
+                }
+                ASSERT_EQ(row / 1000 == 0, runs->vector[i]) << "row " << row;
+            }
+        }
+        EXPECT_EQ(numRows, row);
+
+        std::string fileName = TestFilePath.substr(TestFilePath.find_last_of('/') + 1);
+        auto encodings = footerCache->getRGFooter(fileName + "-0")->rowgroupencoding();
+        EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_NONE, encodings.columnchunkencodings(0).kind());
+        EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_RUNLENGTH, encodings.columnchunkencodings(2).kind());
+    }
+}
+
+/**
+ * Format an unscaled 128-bit decimal value with the given scale, e.g. -12345 with scale 4 is -1.2345.
+ */
+static std::string int128ToDecimalString(__int128 unscaled, int scale) {
+    bool negative = unscaled < 0;
+    unsigned __int128 magnitude = negative ? -(unsigned __int128) unscaled : (unsigned __int128) unscaled;
+    std::string digits;
+    do {
+        digits.insert(digits.begin(), (char) ('0' + (int) (magnitude % 10)));
+        magnitude /= 10;
+    } while(magnitude != 0);
+    while((int) digits.size() <= scale) {
+        digits.insert(digits.begin(), '0');
+    }
+    digits.insert(digits.end() - scale, '.');
+    return negative ? "-" + digits : digits;
+}
+
+TEST(reader, longDecimalFileRoundTrip) {
+    // pixels 0 and 2 fit in 64 bits, pixels 1 and 3 need 128 bits
+    const int pixelStride = 16;
+    const int numRows = 64;
+    auto schema = TypeDescription::fromString("struct<d:decimal(30,4)>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::vector<__int128> values;
+    for(int i = 0; i < numRows; i++) {
+        __int128 value = i * 12345 - 50000;
+        if(i / pixelStride % 2 == 1) {
+            value = value * (__int128) 100000000000000000LL * 1000 + (i % 2 == 0 ? 1 : -1);
+        }
+        values.push_back(value);
+        if(i % 10 == 9) {
+            rowBatch->cols[0]->addNull();
+        } else {
+            std::string str = int128ToDecimalString(value, 4);
+            rowBatch->cols[0]->add(str);
+        }
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    for(int batchSize: {4, pixelStride}) {
+        auto reader = openTestFile();
+        auto recordReader = reader->read(testReaderOption(reader, batchSize));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto decimals = std::static_pointer_cast<LongDecimalColumnVector>(result->cols[0]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(row % 10 != 9, decimals->checkValid(i)) << "row " << row;
+                if(row % 10 != 9) {
+                    // the lower word comes first, as in DuckDB's hugeint_t
+                    __int128 value = (__int128) ((unsigned __int128) decimals->vector[2 * i + 1] << 64 |
+                                                 decimals->vector[2 * i]);
+                    ASSERT_TRUE(values[row] == value) << "row " << row << " batch size " << batchSize;
+                }
+            }
+        }
+        EXPECT_EQ(numRows, row);
+    }
+}
+
+TEST(reader, timeBinaryFileRoundTrip) {
+    const int pixelStride = 20;
+    const int numRows = 80;
+    auto schema = TypeDescription::fromString("struct<t:time,b:binary,v:varbinary>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::vector<std::string> blobs;
+    for(int i = 0; i < numRows; i++) {
+        // binary values may contain NUL bytes
+        std::string blob("\0x\0", 3);
+        blob += std::to_string(i % 5);
+        blobs.push_back(blob);
+        if(i % 9 == 1) {
+            rowBatch->cols[0]->addNull();
+            rowBatch->cols[1]->addNull();
+        } else {
+            char time[16];
+            std::snprintf(time, sizeof(time), "%02d:%02d:%02d.%03d", i % 24, i % 60, (i * 7) % 60, i * 11 % 1000);
+            std::string timeStr = time;
+            rowBatch->cols[0]->add(timeStr);
+            rowBatch->cols[1]->add(blobs[i]);
+        }
+        rowBatch->cols[2]->add(blobs[i]);
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    for(int batchSize: {5, pixelStride}) {
+        auto reader = openTestFile();
+        auto recordReader = reader->read(testReaderOption(reader, batchSize));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto times = std::static_pointer_cast<TimeColumnVector>(result->cols[0]);
+            auto binaries = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+            auto varbinaries = std::static_pointer_cast<BinaryColumnVector>(result->cols[2]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(row % 9 != 1, times->checkValid(i)) << "row " << row;
+                ASSERT_EQ(row % 9 != 1, binaries->checkValid(i)) << "row " << row;
+                if(row % 9 != 1) {
+                    int millis = ((row % 24 * 60 + row % 60) * 60 + row * 7 % 60) * 1000 + row * 11 % 1000;
+                    ASSERT_EQ(millis, times->times[i]) << "row " << row;
+                    ASSERT_EQ(blobs[row], binaries->vector[i].GetString()) << "row " << row;
+                }
+                ASSERT_EQ(blobs[row], varbinaries->vector[i].GetString()) << "row " << row;
+            }
+        }
+        EXPECT_EQ(numRows, row);
+    }
+}
+
+TEST(reader, vectorDistanceTest) {
+    std::default_random_engine e(35);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    // dimensions around the 8 floats per AVX2 step
+    for(int dimension: {1, 7, 8, 9, 16, 17, 100}) {
+        std::vector<float> query(dimension);
+        std::vector<float> vectors(3 * dimension);
+        for(auto& v: query) {
+            v = dist(e);
+        }
+        for(auto& v: vectors) {
+            v = dist(e);
+        }
+        std::vector<float> l2(3), cosine(3), ip(3);
+        VectorDistance::distances(VectorDistance::L2, query.data(), vectors.data(), 3, dimension, l2.data());
+        VectorDistance::distances(VectorDistance::COSINE, query.data(), vectors.data(), 3, dimension, cosine.data());
+        VectorDistance::distances(VectorDistance::INNER_PRODUCT, query.data(), vectors.data(), 3, dimension, ip.data());
+        for(int i = 0; i < 3; i++) {
+            const float* v = vectors.data() + i * dimension;
+            double squared = 0, product = 0, queryNorm = 0, norm = 0;
+            for(int j = 0; j < dimension; j++) {
+                squared += (query[j] - v[j]) * (query[j] - v[j]);
+                product += query[j] * v[j];
+                queryNorm += query[j] * query[j];
+                norm += v[j] * v[j];
+            }
+            EXPECT_NEAR(std::sqrt(squared), l2[i], 1e-4) << "dimension " << dimension;
+            EXPECT_NEAR(1 - product / std::sqrt(queryNorm * norm), cosine[i], 1e-4) << "dimension " << dimension;
+            EXPECT_NEAR(-product, ip[i], 1e-4) << "dimension " << dimension;
+            EXPECT_EQ(l2[i], VectorDistance::distance(VectorDistance::L2, query.data(), v, dimension));
+        }
+    }
+    EXPECT_EQ(VectorDistance::INNER_PRODUCT, VectorDistance::parseMetric("IP"));
+}
+
+TEST(reader, vectorFileRoundTrip) {
+    const int pixelStride = 20;
+    const int numRows = 60;
+    const float maxDistance = 15;
+    auto schema = TypeDescription::fromString("struct<id:bigint,v:vector(4)>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    for(int i = 0; i < numRows; i++) {
+        rowBatch->cols[0]->add((int64_t) i);
+        if(i % 8 == 3) {
+            rowBatch->cols[1]->addNull();
+        } else {
+            std::string vector = "[" + std::to_string(i) + "," + std::to_string(i + 1) + "," +
+                                 std::to_string(-i) + ",0.5]";
+            rowBatch->cols[1]->add(vector);
+        }
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    // the distance of row i to the query is sqrt(3) * |i - 10|
+    std::vector<float> query = {10, 11, -10, 0.5};
+    for(bool pushDown: {false, true}) {
+        for(int batchSize: {5, pixelStride}) {
+            auto reader = openTestFile();
+            auto option = testReaderOption(reader, batchSize);
+            if(pushDown) {
+                option.setVectorPredicate(std::make_shared<VectorPredicate>("v", query, VectorDistance::L2,
+                                                                            0, maxDistance));
+            }
+            auto recordReader = std::static_pointer_cast<PixelsRecordReaderImpl>(reader->read(option));
+            int row = 0;
+            while(!recordReader->isEndOfFile()) {
+                auto result = recordReader->readBatch(false);
+                auto vectors = std::static_pointer_cast<VectorColumnVector>(result->cols[1]);
+                for(int i = 0; i < result->rowCount; i++, row++) {
+                    bool valid = row % 8 != 3;
+                    ASSERT_EQ(valid, vectors->checkValid(i)) << "row " << row;
+                    if(valid) {
+                        const float* v = vectors->vector + i * 4;
+                        ASSERT_EQ((float) row, v[0]) << "row " << row;
+                        ASSERT_EQ((float) row + 1, v[1]) << "row " << row;
+                        ASSERT_EQ((float) -row, v[2]) << "row " << row;
+                        ASSERT_EQ(0.5f, v[3]) << "row " << row;
+                    }
+                    if(pushDown) {
+                        bool passes = valid && std::sqrt(3.0) * std::abs(row - 10) <= maxDistance;
+                        ASSERT_EQ(passes, recordReader->getFilterMask()->get(i)) << "row " << row;
+                    }
+                }
+            }
+            EXPECT_EQ(numRows, row);
+        }
+    }
+}
+
+TEST(reader, nestedFileRoundTrip) {
+    const int pixelStride = 10;
+    const int numRows = 50;
+    auto schema = TypeDescription::fromString("struct<id:bigint,s:struct<x:bigint,y:string>,a:array<bigint>>");
+    // the list elements outnumber the rows, the child vector has the capacity of the row batch
+    auto rowBatch = schema->createRowBatch(2 * numRows);
+    auto structs = std::static_pointer_cast<StructColumnVector>(rowBatch->cols[1]);
+    auto lists = std::static_pointer_cast<ListColumnVector>(rowBatch->cols[2]);
+    for(int i = 0; i < numRows; i++) {
+        rowBatch->cols[0]->add((int64_t) i);
+        if(i % 7 == 3) {
+            structs->addNull();
+        } else {
+            structs->addRow();
+            structs->fields[0]->add((int64_t) i * 3);
+            std::string y = "y" + std::to_string(i);
+            structs->fields[1]->add(y);
+        }
+        if(i % 6 == 5) {
+            lists->addNull();
+        } else {
+            // the elements of a list do not line up with the pixels of the list column
+            lists->addRow(i % 4);
+            for(int k = 0; k < i % 4; k++) {
+                lists->child->add((int64_t) i * 10 + k);
+            }
+        }
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    for(int batchSize: {3, 7, pixelStride, numRows}) {
+        auto reader = openTestFile();
+        auto recordReader = reader->read(testReaderOption(reader, batchSize));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto ids = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+            auto structResult = std::static_pointer_cast<StructColumnVector>(result->cols[1]);
+            auto xs = std::static_pointer_cast<LongColumnVector>(structResult->fields[0]);
+            auto ys = std::static_pointer_cast<BinaryColumnVector>(structResult->fields[1]);
+            auto listResult = std::static_pointer_cast<ListColumnVector>(result->cols[2]);
+            auto elements = std::static_pointer_cast<LongColumnVector>(listResult->child);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(row, ids->longVector[i]) << "row " << row << " batch size " << batchSize;
+                ASSERT_EQ(row % 7 != 3, structResult->checkValid(i)) << "row " << row << " batch size " << batchSize;
+                if(row % 7 != 3) {
+                    ASSERT_EQ(row * 3, xs->longVector[i]) << "row " << row << " batch size " << batchSize;
+                    ASSERT_EQ("y" + std::to_string(row), ys->vector[i].GetString())
+                        << "row " << row << " batch size " << batchSize;
+                }
+                ASSERT_EQ(row % 6 != 5, listResult->checkValid(i)) << "row " << row << " batch size " << batchSize;
+                if(row % 6 != 5) {
+                    ASSERT_EQ(row % 4, listResult->entries[i].length) << "row " << row << " batch size " << batchSize;
+                    for(int k = 0; k < row % 4; k++) {
+                        ASSERT_EQ(row * 10 + k, elements->longVector[listResult->entries[i].offset + k])
+                            << "row " << row << " batch size " << batchSize;
+                    }
+                }
+            }
+        }
+        EXPECT_EQ(numRows, row) << "batch size " << batchSize;
+    }
+}
+
+TEST(reader, charColumnTest) {
+    auto schema = TypeDescription::fromString("struct<c:char(4)>");
+    // a 2-byte UTF-8 character fits, trailing spaces beyond n bytes are dropped
+    std::vector<std::string> values = {"", "ab", "abcd", "ab  ", "abcd   ", "t\xc3\xa9t"};
+    std::vector<std::string> expected = {"", "ab", "abcd", "ab", "abcd", "t\xc3\xa9t"};
+    auto rowBatch = schema->createRowBatch(values.size() + 1);
+    for(auto& value: values) {
+        rowBatch->cols[0]->add(value);
+        rowBatch->rowCount++;
+    }
+    rowBatch->cols[0]->addNull();
+    rowBatch->rowCount++;
+    writeTestFile(schema, rowBatch, 4);
+
+    auto reader = openTestFile();
+    auto recordReader = reader->read(testReaderOption(reader, 3));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto chars = std::static_pointer_cast<BinaryColumnVector>(result->cols[0]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            if(row == (int) values.size()) {
+                EXPECT_FALSE(chars->checkValid(i));
+            } else {
+                EXPECT_EQ(expected[row], chars->vector[i].GetString());
+            }
+        }
+    }
+    EXPECT_EQ((int) values.size() + 1, row);
+
+    // over-long values are rejected rather than cut, possibly in the middle of a character
+    auto writerOption = std::make_shared<PixelsWriterOption>();
+    writerOption->setPixelsStride(4)->setEncodingLevel(EncodingLevel(EncodingLevel::EL2));
+    for(std::string value: {"abcde", "\xc3\xa9\xc3\xa9\xc3\xa9", "abcd e"}) {
+        CharColumnWriter writer(schema->getChildren()[0], writerOption);
+        auto vector = schema->createRowBatch(1)->cols[0];
+        vector->add(value);
+        EXPECT_THROW(writer.write(vector, 1), InvalidArgumentException) << value;
+    }
+}
+
+TEST(reader, pinnedBufferTest) {
+    auto owner = std::make_shared<ByteBuffer>(64);
+    for(int i = 0; i < 64; i++) {
+        owner->put((uint8_t) i);
+    }
+    std::weak_ptr<ByteBuffer> ownerRef = owner;
+    // a slice keeps the memory of its owner alive
+    auto slice = std::make_shared<ByteBuffer>(*owner, 8, 16);
+    auto vector = std::make_shared<LongColumnVector>(16, false, true);
+    vector->pin(slice);
+    vector->pin(slice);
+    EXPECT_EQ(1, (int) vector->pinnedBuffers.size());
+    owner.reset();
+    slice.reset();
+    ASSERT_FALSE(ownerRef.expired());
+    EXPECT_EQ(8, ownerRef.lock()->getPointer()[8]);
+    vector->reset();
+    EXPECT_TRUE(vector->pinnedBuffers.empty());
+    EXPECT_TRUE(ownerRef.expired());
+}
+
+TEST(reader, intFileRoundTrip) {
+    const int pixelStride = 16;
+    const int numRows = 64;
+    auto schema = TypeDescription::fromString("struct<plain:int,runs:int>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::default_random_engine e(38);
+    std::uniform_int_distribution<int> dist;
+    std::vector<int> values;
+    for(int i = 0; i < numRows; i++) {
+        values.push_back(dist(e) * (i % 2 == 0 ? 1 : -1));
+        if(i % 13 == 6) {
+            rowBatch->cols[0]->addNull();
+        } else {
+            rowBatch->cols[0]->add(values[i]);
+        }
+        rowBatch->cols[1]->add(i / 10 - 3);
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    for(int batchSize: {5, pixelStride, numRows}) {
+        auto reader = openTestFile();
+        auto recordReader = reader->read(testReaderOption(reader, batchSize));
+        int row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            auto plain = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+            auto runs = std::static_pointer_cast<LongColumnVector>(result->cols[1]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(row % 13 != 6, plain->checkValid(i)) << "row " << row;
+                if(row % 13 != 6) {
+                    ASSERT_EQ(values[row], plain->intVector[i]) << "row " << row << " batch size " << batchSize;
+                }
+                ASSERT_EQ(row / 10 - 3, runs->intVector[i]) << "row " << row << " batch size " << batchSize;
+            }
+        }
+        EXPECT_EQ(numRows, row);
+    }
+}
+
+TEST(reader, readKernelsRoundTrip) {
+    // unpadded nulls, plain and run-length encoded values, read with and without a filter mask
+    const int pixelStride = 16;
+    const int numRows = 64;
+    const float maxDistance = 30;
+    auto schema = TypeDescription::fromString(
+            "struct<i:int,ir:int,l:bigint,lr:bigint,d:decimal(18,2),s:string,v:vector(2)>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::default_random_engine e(39);
+    std::uniform_int_distribution<int> intDist;
+    std::uniform_int_distribution<int64_t> longDist;
+    std::uniform_int_distribution<int64_t> decimalDist(-999999999999LL, 999999999999LL);
+    const char* colors[] = {"red", "green", "blue"};
+    std::vector<int> ints;
+    std::vector<int64_t> longs, decimals;
+    auto isNull = [](int row, int column) { return (row * 7 + column) % 5 == 0; };
+    for(int i = 0; i < numRows; i++) {
+        ints.push_back(intDist(e));
+        longs.push_back(longDist(e));
+        decimals.push_back(decimalDist(e));
+        std::vector<std::shared_ptr<ColumnVector>>& cols = rowBatch->cols;
+        isNull(i, 0) ? cols[0]->addNull() : cols[0]->add(ints[i]);
+        isNull(i, 1) ? cols[1]->addNull() : cols[1]->add(i / 10);
+        isNull(i, 2) ? cols[2]->addNull() : cols[2]->add(longs[i]);
+        isNull(i, 3) ? cols[3]->addNull() : cols[3]->add((int64_t) i / 10 - 2);
+        if(isNull(i, 4)) {
+            cols[4]->addNull();
+        } else {
+            std::string value = std::to_string(decimals[i] / 100) + "." +
+                                std::to_string(std::abs(decimals[i] % 100) + 100).substr(1);
+            if(decimals[i] < 0 && decimals[i] / 100 == 0) {
+                value = "-" + value;
+            }
+            cols[4]->add(value);
+        }
+        if(isNull(i, 5)) {
+            cols[5]->addNull();
+        } else {
+            std::string color = colors[i % 3];
+            cols[5]->add(color);
+        }
+        std::string vector = "[" + std::to_string(i) + ",0]";
+        cols[6]->add(vector);
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    auto footerCache = std::make_shared<PixelsFooterCache>();
+    for(bool filtered: {false, true}) {
+        for(int batchSize: {5, pixelStride, numRows}) {
+            auto reader = openTestFile(footerCache);
+            auto option = testReaderOption(reader, batchSize);
+            if(filtered) {
+                // the distance of row i to the query is i
+                option.setVectorPredicate(std::make_shared<VectorPredicate>(
+                        "v", std::vector<float>{0, 0}, VectorDistance::L2, 0, maxDistance));
+            }
+            auto recordReader = std::static_pointer_cast<PixelsRecordReaderImpl>(reader->read(option));
+            int row = 0;
+            while(!recordReader->isEndOfFile()) {
+                auto result = recordReader->readBatch(false);
+                auto i32 = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+                auto i32Runs = std::static_pointer_cast<LongColumnVector>(result->cols[1]);
+                auto i64 = std::static_pointer_cast<LongColumnVector>(result->cols[2]);
+                auto i64Runs = std::static_pointer_cast<LongColumnVector>(result->cols[3]);
+                auto decimal = std::static_pointer_cast<DecimalColumnVector>(result->cols[4]);
+                auto strings = std::static_pointer_cast<BinaryColumnVector>(result->cols[5]);
+                for(int i = 0; i < result->rowCount; i++, row++) {
+                    for(int c = 0; c < 6; c++) {
+                        ASSERT_EQ(!isNull(row, c), result->cols[c]->checkValid(i)) << "row " << row << " column " << c;
+                    }
+                    if(filtered) {
+                        ASSERT_EQ(row <= maxDistance, recordReader->getFilterMask()->get(i)) << "row " << row;
+                        if(row > maxDistance) {
+                            // the values of the rows filtered out are not defined
+                            continue;
+                        }
+                    }
+                    std::string context = "row " + std::to_string(row) + " batch size " + std::to_string(batchSize);
+                    if(!isNull(row, 0)) {
+                        ASSERT_EQ(ints[row], i32->intVector[i]) << context;
+                    }
+                    if(!isNull(row, 1)) {
+                        ASSERT_EQ(row / 10, i32Runs->intVector[i]) << context;
+                    }
+                    if(!isNull(row, 2)) {
+                        ASSERT_EQ(longs[row], i64->longVector[i]) << context;
+                    }
+                    if(!isNull(row, 3)) {
+                        ASSERT_EQ(row / 10 - 2, i64Runs->longVector[i]) << context;
+                    }
+                    if(!isNull(row, 4)) {
+                        ASSERT_EQ(decimals[row], decimal->vector[i]) << context;
+                    }
+                    if(!isNull(row, 5)) {
+                        ASSERT_EQ(colors[row % 3], strings->vector[i].GetString()) << context;
+                    }
+                }
+            }
+            EXPECT_EQ(numRows, row);
+        }
+    }
+
+    std::string fileName = TestFilePath.substr(TestFilePath.find_last_of('/') + 1);
+    auto encodings = footerCache->getRGFooter(fileName + "-0")->rowgroupencoding();
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_NONE, encodings.columnchunkencodings(0).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_RUNLENGTH, encodings.columnchunkencodings(1).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_NONE, encodings.columnchunkencodings(2).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_RUNLENGTH, encodings.columnchunkencodings(3).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_RUNLENGTH, encodings.columnchunkencodings(4).kind());
+    EXPECT_EQ(pixels::proto::ColumnEncoding_Kind_DICTIONARY, encodings.columnchunkencodings(5).kind());
+}
+
+TEST(reader, filterRangeTest) {
+    // ranges around the 8 rows compared per SIMD step, the rows out of the range keep their bits
+    const int length = 50;
+    auto vector = std::make_shared<LongColumnVector>(length, false, true);
+    for(int i = 0; i < length; i++) {
+        vector->longVector[i] = i;
+    }
+    auto type = TypeDescription::createLong();
+    duckdb::ConstantFilter lessThan(duckdb::ExpressionType::COMPARE_LESSTHAN, duckdb::Value::BIGINT(30));
+    duckdb::ConjunctionOrFilter equalsOr;
+    equalsOr.child_filters.emplace_back(
+            std::make_unique<duckdb::ConstantFilter>(duckdb::ExpressionType::COMPARE_EQUAL, duckdb::Value::BIGINT(5)));
+    equalsOr.child_filters.emplace_back(
+            std::make_unique<duckdb::ConstantFilter>(duckdb::ExpressionType::COMPARE_GREATERTHAN, duckdb::Value::BIGINT(40)));
+    for(int start: {0, 3, 8, 13}) {
+        for(int rangeLength: {0, 1, 7, 8, 9, 20, length - start}) {
+            if(start + rangeLength > length) {
+                continue;
+            }
+            PixelsBitMask mask(length);
+            PixelsFilter::ApplyFilter(vector, lessThan, mask, type, start, rangeLength);
+            PixelsBitMask orMask(length);
+            PixelsFilter::ApplyFilter(vector, equalsOr, orMask, type, start, rangeLength);
+            for(int i = 0; i < length; i++) {
+                bool inRange = i >= start && i < start + rangeLength;
+                ASSERT_EQ(!inRange || i < 30, mask.get(i)) << "row " << i << " start " << start;
+                ASSERT_EQ(!inRange || i == 5 || i > 40, orMask.get(i)) << "row " << i << " start " << start;
+            }
+        }
+    }
+}
+
+TEST(reader, filterPushDownRoundTrip) {
+    // row batches span row groups of different sizes, the filtered columns are read first
+    const int pixelStride = 10;
+    const std::vector<int> rowGroupRows = {25, 30, 17};
+    const int numRows = 72;
+    auto schema = TypeDescription::fromString("struct<id:bigint,name:string,score:int>");
+    std::remove(TestFilePath.c_str());
+    // the row group size of one byte closes a row group for each row batch
+    auto writer = std::make_shared<PixelsWriterImpl>(schema, pixelStride, 1, TestFilePath, 1 << 20,
+                                                     true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+    int row = 0;
+    for(int rows: rowGroupRows) {
+        auto rowBatch = schema->createRowBatch(rows);
+        for(int i = 0; i < rows; i++, row++) {
+            rowBatch->cols[0]->add((int64_t) row);
+            if(row % 11 == 4) {
+                rowBatch->cols[1]->addNull();
+            } else {
+                std::string name = "name-" + std::to_string(row);
+                rowBatch->cols[1]->add(name);
+            }
+            rowBatch->cols[2]->add(row % 10);
+            rowBatch->rowCount++;
+        }
+        writer->addRowBatch(rowBatch);
+    }
+    writer->close();
+
+    // id >= 7 and id < 60 and (score == 3 or score > 8)
+    duckdb::TableFilterSet filters;
+    auto idFilter = std::make_unique<duckdb::ConjunctionAndFilter>();
+    idFilter->child_filters.emplace_back(std::make_unique<duckdb::ConstantFilter>(
+            duckdb::ExpressionType::COMPARE_GREATERTHANOREQUALTO, duckdb::Value::BIGINT(7)));
+    idFilter->child_filters.emplace_back(std::make_unique<duckdb::ConstantFilter>(
+            duckdb::ExpressionType::COMPARE_LESSTHAN, duckdb::Value::BIGINT(60)));
+    filters.filters[0] = std::move(idFilter);
+    auto scoreFilter = std::make_unique<duckdb::ConjunctionOrFilter>();
+    scoreFilter->child_filters.emplace_back(std::make_unique<duckdb::ConstantFilter>(
+            duckdb::ExpressionType::COMPARE_EQUAL, duckdb::Value::INTEGER(3)));
+    scoreFilter->child_filters.emplace_back(std::make_unique<duckdb::ConstantFilter>(
+            duckdb::ExpressionType::COMPARE_GREATERTHAN, duckdb::Value::INTEGER(8)));
+    filters.filters[2] = std::move(scoreFilter);
+    auto passes = [](int row) { return row >= 7 && row < 60 && (row % 10 == 3 || row % 10 > 8); };
+
+    for(int batchSize: {16, 32, numRows}) {
+        auto reader = openTestFile();
+        EXPECT_EQ((int) rowGroupRows.size(), reader->getRowGroupNum());
+        auto option = testReaderOption(reader, batchSize);
+        option.setEnabledFilterPushDown(true);
+        option.setFilter(&filters);
+        auto recordReader = std::static_pointer_cast<PixelsRecordReaderImpl>(reader->read(option));
+        row = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            // only the last batch is short
+            ASSERT_EQ(std::min(batchSize, numRows - row), (int) result->rowCount) << "batch size " << batchSize;
+            auto ids = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+            auto names = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+            auto scores = std::static_pointer_cast<LongColumnVector>(result->cols[2]);
+            for(int i = 0; i < result->rowCount; i++, row++) {
+                ASSERT_EQ(passes(row), recordReader->getFilterMask()->get(i)) << "row " << row;
+                ASSERT_EQ(row, ids->longVector[i]) << "row " << row;
+                ASSERT_EQ(row % 10, scores->intVector[i]) << "row " << row;
+                if(passes(row)) {
+                    ASSERT_EQ(row % 11 != 4, names->checkValid(i)) << "row " << row;
+                    if(row % 11 != 4) {
+                        ASSERT_EQ("name-" + std::to_string(row), names->vector[i].GetString()) << "row " << row;
+                    }
+                }
+            }
+        }
+        EXPECT_EQ(numRows, row) << "batch size " << batchSize;
+    }
+}
+
+TEST(writer, threadPoolTest) {
+    // a queue of two tasks blocks the producer until the workers catch up
+    ThreadPool pool(2, 2);
+    std::atomic<int> sum(0);
+    std::vector<std::future<void>> futures;
+    for(int i = 1; i <= 100; i++) {
+        futures.emplace_back(pool.submit([&sum, i]() { sum += i; }));
+    }
+    for(auto& future: futures) {
+        future.get();
+    }
+    EXPECT_EQ(5050, sum.load());
+    auto failed = pool.submit([]() { throw InvalidArgumentException("task failed"); });
+    EXPECT_THROW(failed.get(), InvalidArgumentException);
+    // a flush waits for the tasks it submits to the shared pool
+    auto flush = ThreadPool::FlushInstance().submit([]() {
+        ThreadPool::Instance().submit([]() {}).get();
+    });
+    flush.get();
+}
+
+TEST(writer, pipelinedRowGroupsRoundTrip) {
+    // each row batch closes a row group, which is flushed while the next row batch is encoded
+    const int pixelStride = 10;
+    const int numRowGroups = 12;
+    const int rowsPerGroup = 23;
+    auto schema = TypeDescription::fromString("struct<id:bigint,name:string>");
+    std::remove(TestFilePath.c_str());
+    auto writer = std::make_shared<PixelsWriterImpl>(schema, pixelStride, 1, TestFilePath, 1 << 20,
+                                                     true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+    for(int rg = 0; rg < numRowGroups; rg++) {
+        auto rowBatch = schema->createRowBatch(rowsPerGroup);
+        for(int i = 0; i < rowsPerGroup; i++) {
+            int row = rg * rowsPerGroup + i;
+            rowBatch->cols[0]->add((int64_t) row);
+            std::string name = "name-" + std::to_string(row);
+            rowBatch->cols[1]->add(name);
+            rowBatch->rowCount++;
+        }
+        EXPECT_FALSE(writer->addRowBatch(rowBatch));
+    }
+    writer->close();
+
+    auto reader = openTestFile();
+    ASSERT_EQ(numRowGroups, reader->getRowGroupNum());
+    auto recordReader = reader->read(testReaderOption(reader, 64));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto ids = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        auto names = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            ASSERT_EQ(row, ids->longVector[i]);
+            ASSERT_EQ("name-" + std::to_string(row), names->vector[i].GetString());
+        }
+    }
+    EXPECT_EQ(numRowGroups * rowsPerGroup, row);
+}
+
+TEST(writer, destroyWithPendingRowGroup) {
+    // the writer is destroyed without close() while its last row group is being flushed
+    auto schema = TypeDescription::fromString("struct<id:bigint,name:string>");
+    std::int64_t bytesBefore = WriterMemoryManager::Instance().getTotalBytes();
+    std::remove(TestFilePath.c_str());
+    {
+        auto writer = std::make_shared<PixelsWriterImpl>(schema, 10, 1, TestFilePath, 1 << 20,
+                                                         true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+        auto rowBatch = schema->createRowBatch(4096);
+        for(int i = 0; i < 4096; i++) {
+            rowBatch->cols[0]->add((int64_t) i);
+            std::string name = "name-" + std::to_string(i);
+            rowBatch->cols[1]->add(name);
+            rowBatch->rowCount++;
+        }
+        EXPECT_FALSE(writer->addRowBatch(rowBatch));
+    }
+    EXPECT_EQ(bytesBefore, WriterMemoryManager::Instance().getTotalBytes());
+}
+
+TEST(writer, gatherWriteTest) {
+    // more buffers than IOV_MAX, which are written by several pwritev calls
+    const int numBuffers = 3000;
+    std::string path = TestFilePath + ".gather";
+    std::vector<std::vector<uint8_t>> contents(numBuffers);
+    std::vector<struct iovec> buffers(numBuffers);
+    std::string expected = "head";
+    for(int i = 0; i < numBuffers; i++) {
+        contents[i].assign(i % 7 + 1, (uint8_t) ('a' + i % 26));
+        buffers[i].iov_base = contents[i].data();
+        buffers[i].iov_len = contents[i].size();
+        expected.append(contents[i].begin(), contents[i].end());
+    }
+    {
+        PhysicalLocalWriter writer(path, true);
+        writer.append((const uint8_t *) "head", 0, 4);
+        EXPECT_EQ(4, writer.append(buffers));
+        writer.flush();
+        writer.close();
+    }
+    FILE * file = fopen(path.c_str(), "rb");
+    ASSERT_NE(nullptr, file);
+    std::string actual(expected.size() + 1, '\0');
+    actual.resize(fread(&actual[0], 1, actual.size(), file));
+    fclose(file);
+    std::remove(path.c_str());
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(writer, segmentedOutputStreamTest) {
+    SegmentedOutputStream stream;
+    std::vector<uint8_t> expected;
+    // across the first segments, put by bytes and by arrays
+    const size_t length = 3 * SegmentedOutputStream::MIN_SEGMENT_SIZE + 17;
+    std::vector<uint8_t> block(1000);
+    while(expected.size() < length) {
+        if(expected.size() % 3 == 0) {
+            uint8_t value = (uint8_t) expected.size();
+            stream.put(value);
+            expected.push_back(value);
+        } else {
+            size_t n = std::min(block.size(), length - expected.size());
+            for(size_t i = 0; i < n; i++) {
+                block[i] = (uint8_t) (expected.size() * 7 + i);
+            }
+            stream.putBytes(block.data(), n);
+            expected.insert(expected.end(), block.begin(), block.begin() + n);
+        }
+    }
+    EXPECT_EQ(expected.size(), stream.getWritePos());
+    std::vector<struct iovec> buffers;
+    stream.getBuffers(buffers);
+    EXPECT_GT(buffers.size(), 1u);
+    std::vector<uint8_t> gathered;
+    for(const auto& buffer: buffers) {
+        auto data = (const uint8_t *) buffer.iov_base;
+        gathered.insert(gathered.end(), data, data + buffer.iov_len);
+    }
+    EXPECT_EQ(expected, gathered);
+    std::vector<uint8_t> scratch;
+    const uint8_t * content = stream.getContent(scratch);
+    EXPECT_EQ(0, std::memcmp(expected.data(), content, expected.size()));
+
+    // a single segment is returned in place
+    stream.resetPosition();
+    EXPECT_EQ(0u, stream.getWritePos());
+    stream.putBytes(expected.data(), 100);
+    scratch.clear();
+    content = stream.getContent(scratch);
+    EXPECT_TRUE(scratch.empty());
+    EXPECT_EQ(0, std::memcmp(expected.data(), content, 100));
+    stream.clear();
+    EXPECT_EQ(0u, stream.getWritePos());
+    buffers.clear();
+    stream.getBuffers(buffers);
+    EXPECT_TRUE(buffers.empty());
+}
+
+TEST(writer, segmentArenaTest) {
+    // the segments released beyond the cache size of the arena are freed
+    const size_t maxFreeBytes = SegmentedOutputStream::getMaxFreeBytes();
+    std::vector<uint8_t> block(SegmentedOutputStream::MAX_SEGMENT_SIZE);
+    std::vector<std::unique_ptr<SegmentedOutputStream>> streams;
+    size_t capacity = 0;
+    while(capacity <= maxFreeBytes + SegmentedOutputStream::MAX_SEGMENT_SIZE) {
+        streams.emplace_back(new SegmentedOutputStream());
+        streams.back()->putBytes(block.data(), block.size());
+        capacity += streams.back()->getCapacity();
+    }
+    streams.clear();
+    size_t freeBytes = SegmentedOutputStream::getFreeBytes();
+    EXPECT_GT(freeBytes, 0u);
+    EXPECT_LE(freeBytes, maxFreeBytes);
+    // a new stream takes its first segment from the arena
+    SegmentedOutputStream stream;
+    stream.put(1);
+    EXPECT_EQ(freeBytes - SegmentedOutputStream::MIN_SEGMENT_SIZE, SegmentedOutputStream::getFreeBytes());
+}
+
+TEST(writer, largeChunkRoundTrip) {
+    // the column chunks are larger than the first segments of the column writer streams
+    const int pixelStride = 10000;
+    const int numRows = 30000;
+    auto schema = TypeDescription::fromString("struct<id:bigint,name:string>");
+    auto rowBatch = schema->createRowBatch(numRows);
+    std::default_random_engine e(43);
+    std::uniform_int_distribution<int64_t> dist;
+    std::vector<int64_t> ids;
+    for(int i = 0; i < numRows; i++) {
+        ids.push_back(dist(e));
+        rowBatch->cols[0]->add(ids[i]);
+        std::string name = "name-" + std::to_string(i);
+        rowBatch->cols[1]->add(name);
+        rowBatch->rowCount++;
+    }
+    writeTestFile(schema, rowBatch, pixelStride);
+
+    auto reader = openTestFile();
+    auto recordReader = reader->read(testReaderOption(reader, 4096));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto longs = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        auto names = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            ASSERT_EQ(ids[row], longs->longVector[i]) << "row " << row;
+            ASSERT_EQ("name-" + std::to_string(row), names->vector[i].GetString()) << "row " << row;
+        }
+    }
+    EXPECT_EQ(numRows, row);
+}
+
+TEST(writer, rowGroupSizingTest) {
+    // the encoded size of a row group accumulates over the row batches, a flush can be requested early
+    const int pixelStride = 10;
+    const int batchRows = 100;
+    auto schema = TypeDescription::fromString("struct<id:bigint>");
+    std::default_random_engine e(44);
+    std::uniform_int_distribution<int64_t> dist;
+    std::vector<int64_t> ids;
+    std::int64_t bytesBefore = WriterMemoryManager::Instance().getTotalBytes();
+    std::remove(TestFilePath.c_str());
+    {
+        // full-width values, so that three batches of 800 bytes fill a row group of 2000 bytes
+        auto writer = std::make_shared<PixelsWriterImpl>(schema, pixelStride, 2000, TestFilePath, 1 << 20,
+                                                         true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+        std::vector<bool> expectOpen = {true, true, false, true, true, false, true};
+        for(size_t batch = 0; batch < expectOpen.size() + 2; batch++) {
+            auto rowBatch = schema->createRowBatch(batchRows);
+            for(int i = 0; i < batchRows; i++) {
+                ids.push_back(dist(e));
+                rowBatch->cols[0]->add(ids.back());
+                rowBatch->rowCount++;
+            }
+            if(batch == expectOpen.size()) {
+                // as if the memory budget of the writers were exceeded
+                writer->requestRowGroupFlush();
+                EXPECT_FALSE(writer->addRowBatch(rowBatch)) << "batch " << batch;
+            } else if(batch < expectOpen.size()) {
+                EXPECT_EQ(expectOpen[batch], writer->addRowBatch(rowBatch)) << "batch " << batch;
+                if(expectOpen[batch]) {
+                    // a full row group may already be flushed in the background
+                    EXPECT_GT(WriterMemoryManager::Instance().getTotalBytes(), bytesBefore);
+                }
+            } else {
+                EXPECT_TRUE(writer->addRowBatch(rowBatch)) << "batch " << batch;
+            }
+        }
+        writer->close();
+        EXPECT_EQ(bytesBefore, WriterMemoryManager::Instance().getTotalBytes());
+    }
+
+    auto reader = openTestFile();
+    // two full row groups, the one cut early and the last one written by close
+    EXPECT_EQ(4, reader->getRowGroupNum());
+    auto recordReader = reader->read(testReaderOption(reader, 256));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto longs = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            ASSERT_EQ(ids[row], longs->longVector[i]) << "row " << row;
+        }
+    }
+    EXPECT_EQ((int) ids.size(), row);
+}
+
+TEST(writer, sortedRowBufferTest) {
+    // strings longer than the normalized prefix, ties are ordered by the second key, nulls come first
+    auto schema = TypeDescription::fromString("struct<k:string,v:bigint,d:double>");
+    std::default_random_engine e(45);
+    std::uniform_int_distribution<int> keyDist(0, 20);
+    std::uniform_int_distribution<int64_t> valueDist(-50, 50);
+    std::vector<std::tuple<bool, std::string, int64_t>> rows;
+    SortedRowBuffer buffer(schema, {0, 1});
+    for(int batch = 0; batch < 3; batch++) {
+        auto rowBatch = schema->createRowBatch(700);
+        for(int i = 0; i < 700; i++) {
+            int64_t value = valueDist(e);
+            int key = keyDist(e);
+            if(key == 0) {
+                rowBatch->cols[0]->addNull();
+                rows.emplace_back(true, "", value);
+            } else {
+                std::string s = "prefix-of-the-key-" + std::to_string(key);
+                rowBatch->cols[0]->add(s);
+                rows.emplace_back(false, s, value);
+            }
+            rowBatch->cols[1]->add(value);
+            std::static_pointer_cast<DoubleColumnVector>(rowBatch->cols[2])->add(value * 0.5);
+            rowBatch->rowCount++;
+        }
+        buffer.add(rowBatch);
+    }
+    EXPECT_EQ((int) rows.size(), buffer.getNumRows());
+    EXPECT_GT(buffer.getMemoryUsage(), 0u);
+    std::stable_sort(rows.begin(), rows.end(), [](const auto &l, const auto &r) {
+        if(std::get<0>(l) != std::get<0>(r)) {
+            return std::get<0>(l);
+        }
+        if(std::get<1>(l) != std::get<1>(r)) {
+            return std::get<1>(l) < std::get<1>(r);
+        }
+        return std::get<2>(l) < std::get<2>(r);
+    });
+
+    int row = 0;
+    buffer.drain(512, [&](const std::shared_ptr<VectorizedRowBatch> &sorted) {
+        ASSERT_LE(sorted->count(), 512);
+        auto keys = std::static_pointer_cast<BinaryColumnVector>(sorted->cols[0]);
+        auto values = std::static_pointer_cast<LongColumnVector>(sorted->cols[1]);
+        auto doubles = std::static_pointer_cast<DoubleColumnVector>(sorted->cols[2]);
+        for(int i = 0; i < sorted->count(); i++, row++) {
+            ASSERT_EQ(std::get<0>(rows[row]), (bool) keys->isNull[i]) << "row " << row;
+            if(!std::get<0>(rows[row])) {
+                ASSERT_EQ(std::get<1>(rows[row]), keys->vector[i].GetString()) << "row " << row;
+            }
+            ASSERT_EQ(std::get<2>(rows[row]), values->longVector[i]) << "row " << row;
+            ASSERT_EQ(std::get<2>(rows[row]) * 0.5, doubles->doubleVector[i]) << "row " << row;
+        }
+    });
+    EXPECT_EQ((int) rows.size(), row);
+    EXPECT_EQ(0, buffer.getNumRows());
+}
+
+TEST(writer, sortedRowGroupsRoundTrip) {
+    // each row group is sorted by the key on its own, the flush requested by the memory manager cuts the first one
+    const int batchRows = 300;
+    auto schema = TypeDescription::fromString("struct<id:bigint,k:int>");
+    std::default_random_engine e(46);
+    std::uniform_int_distribution<int> keyDist(-1000, 1000);
+    std::vector<std::pair<int, int64_t>> firstRowGroup, secondRowGroup;
+    std::remove(TestFilePath.c_str());
+    {
+        auto writer = std::make_shared<PixelsWriterImpl>(schema, 64, 1 << 28, TestFilePath, 1 << 20,
+                                                         true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+        writer->getColumnWriterOption()->setSortKeyColumns({1});
+        int64_t id = 0;
+        for(int batch = 0; batch < 4; batch++) {
+            auto rowBatch = schema->createRowBatch(batchRows);
+            for(int i = 0; i < batchRows; i++, id++) {
+                int key = keyDist(e);
+                rowBatch->cols[0]->add(id);
+                rowBatch->cols[1]->add(key);
+                rowBatch->rowCount++;
+                (batch < 2 ? firstRowGroup : secondRowGroup).emplace_back(key, id);
+            }
+            if(batch == 1) {
+                writer->requestRowGroupFlush();
+                EXPECT_FALSE(writer->addRowBatch(rowBatch));
+            } else {
+                EXPECT_TRUE(writer->addRowBatch(rowBatch));
+            }
+        }
+        writer->close();
+    }
+    // the sort is stable within the row group, the ids were added in increasing order
+    std::sort(firstRowGroup.begin(), firstRowGroup.end());
+    std::sort(secondRowGroup.begin(), secondRowGroup.end());
+    std::vector<std::pair<int, int64_t>> expected(firstRowGroup);
+    expected.insert(expected.end(), secondRowGroup.begin(), secondRowGroup.end());
+
+    auto reader = openTestFile();
+    EXPECT_EQ(2, reader->getRowGroupNum());
+    auto recordReader = reader->read(testReaderOption(reader, 256));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto ids = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        auto keys = std::static_pointer_cast<LongColumnVector>(result->cols[1]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            ASSERT_EQ(expected[row].first, keys->intVector[i]) << "row " << row;
+            ASSERT_EQ(expected[row].second, ids->longVector[i]) << "row " << row;
+        }
+    }
+    EXPECT_EQ((int) expected.size(), row);
+}
+
+TEST(writer, bloomFilterTest) {
+    // no false negatives, and the false positive rate is around the configured one
+    BloomFilter filter(10000, 0.01);
+    for(int64_t i = 0; i < 10000; i++) {
+        filter.insert(BloomFilter::hash(i * 7));
+    }
+    std::string bitset = filter.serialize();
+    EXPECT_EQ(filter.getMemoryUsage(), bitset.size());
+    int falsePositives = 0;
+    for(int64_t i = 0; i < 10000; i++) {
+        ASSERT_TRUE(filter.mightContain(BloomFilter::hash(i * 7))) << i;
+        ASSERT_TRUE(BloomFilter::mightContain(bitset, BloomFilter::hash(i * 7))) << i;
+        EXPECT_EQ(filter.mightContain(BloomFilter::hash(i * 7 + 3)), BloomFilter::mightContain(bitset, BloomFilter::hash(i * 7 + 3)));
+        falsePositives += BloomFilter::mightContain(bitset, BloomFilter::hash(i * 7 + 3));
+    }
+    EXPECT_LT(falsePositives, 300);
+
+    // the hashes of a column chunk with few distinct values are deduplicated while it is written
+    auto schema = TypeDescription::fromString("struct<id:bigint>");
+    auto writerOption = std::make_shared<PixelsWriterOption>();
+    writerOption->setPixelsStride(1000)->setEncodingLevel(EncodingLevel(EncodingLevel::EL2))
+            ->setBloomFilter(true)->setBloomFilterFpp(0.01);
+    auto writer = ColumnWriterBuilder::newColumnWriter(schema->getChildren()[0], writerOption);
+    const int batchRows = 1000;
+    for(int batch = 0; batch < 50; batch++) {
+        auto rowBatch = schema->createRowBatch(batchRows);
+        for(int i = 0; i < batchRows; i++) {
+            rowBatch->cols[0]->add((int64_t) (i % 100));
+        }
+        writer->write(rowBatch->cols[0], batchRows);
+    }
+    EXPECT_LE(writer->getBloomFilterMemoryUsage(), 2 * 4096 * (int64_t) sizeof(uint64_t));
+    writer->flush();
+    EXPECT_EQ(BloomFilter(100, 0.01).serialize().size(), writer->getColumnChunkIndex().bloomfilter().size());
+    EXPECT_EQ(0, writer->getBloomFilterMemoryUsage());
+}
+
+TEST(reader, bloomFilterRowGroupRoundTrip) {
+    // the row groups that can not have the values of the equality filters are not read
+    const int rowGroupRows = 100;
+    auto schema = TypeDescription::fromString("struct<id:bigint,name:string>");
+    ConfigFactory::Instance().addProperty("column.chunk.bloom.filter", "true");
+    std::remove(TestFilePath.c_str());
+    // the row group size of one byte closes a row group for each row batch
+    auto writer = std::make_shared<PixelsWriterImpl>(schema, 10, 1, TestFilePath, 1 << 20,
+                                                     true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+    for(int rowGroup = 0; rowGroup < 3; rowGroup++) {
+        auto rowBatch = schema->createRowBatch(rowGroupRows);
+        for(int i = 0; i < rowGroupRows; i++) {
+            int64_t id = rowGroup * rowGroupRows + i;
+            rowBatch->cols[0]->add(id);
+            std::string name = "name-" + std::to_string(id);
+            rowBatch->cols[1]->add(name);
+            rowBatch->rowCount++;
+        }
+        writer->addRowBatch(rowBatch);
+    }
+    writer->close();
+    ConfigFactory::Instance().addProperty("column.chunk.bloom.filter", "false");
+
+    // id in (150, 160) reads the second row group, name = 'name-250' the third one, id = 1000 none
+    duckdb::TableFilterSet idFilters;
+    auto inList = std::make_unique<duckdb::ConjunctionOrFilter>();
+    for(int64_t id: {150, 160}) {
+        inList->child_filters.emplace_back(std::make_unique<duckdb::ConstantFilter>(
+                duckdb::ExpressionType::COMPARE_EQUAL, duckdb::Value::BIGINT(id)));
+    }
+    idFilters.filters[0] = std::move(inList);
+    duckdb::TableFilterSet nameFilters;
+    nameFilters.filters[1] = std::make_unique<duckdb::ConstantFilter>(
+            duckdb::ExpressionType::COMPARE_EQUAL, duckdb::Value("name-250"));
+    duckdb::TableFilterSet missingFilters;
+    missingFilters.filters[0] = std::make_unique<duckdb::ConstantFilter>(
+            duckdb::ExpressionType::COMPARE_EQUAL, duckdb::Value::BIGINT(1000));
+
+    for(auto test: std::vector<std::pair<duckdb::TableFilterSet *, int>>{
+            {&idFilters, 1}, {&nameFilters, 2}, {&missingFilters, -1}}) {
+        auto reader = openTestFile();
+        EXPECT_EQ(3, reader->getRowGroupNum());
+        auto option = testReaderOption(reader, rowGroupRows);
+        option.setEnabledFilterPushDown(true);
+        option.setFilter(test.first);
+        auto recordReader = reader->read(option);
+        int rows = 0;
+        while(!recordReader->isEndOfFile()) {
+            auto result = recordReader->readBatch(false);
+            if(result->rowCount == 0) {
+                // the empty batch of a file whose row groups are all skipped has no columns
+                continue;
+            }
+            auto ids = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+            for(int i = 0; i < result->rowCount; i++, rows++) {
+                ASSERT_EQ(test.second * rowGroupRows + rows, ids->longVector[i]);
+            }
+        }
+        EXPECT_EQ(test.second < 0 ? 0 : rowGroupRows, rows) << "row group " << test.second;
+    }
+}
+
+TEST(reader, hashConstantTest) {
+    // constants narrower than int64 are hashed by their value, not by the bytes beyond their type
+    uint64_t hash;
+    auto shortType = TypeDescription::fromString("struct<a:smallint>")->getChildren()[0];
+    ASSERT_TRUE(PixelsFilter::HashConstant(duckdb::Value::SMALLINT(-5), shortType, hash));
+    EXPECT_EQ(BloomFilter::hash((int64_t) -5), hash);
+    auto intType = TypeDescription::fromString("struct<a:int>")->getChildren()[0];
+    ASSERT_TRUE(PixelsFilter::HashConstant(duckdb::Value::INTEGER(-70000), intType, hash));
+    EXPECT_EQ(BloomFilter::hash((int64_t) -70000), hash);
+
+    // decimal(4,2) is stored as int16 and decimal(9,2) as int32 by DuckDB
+    auto shortDecimalType = TypeDescription::fromString("struct<a:decimal(4,2)>")->getChildren()[0];
+    ASSERT_TRUE(PixelsFilter::HashConstant(duckdb::Value::DECIMAL((int16_t) -1234, 4, 2), shortDecimalType, hash));
+    EXPECT_EQ(BloomFilter::hash((int64_t) -1234), hash);
+    auto decimalType = TypeDescription::fromString("struct<a:decimal(9,2)>")->getChildren()[0];
+    ASSERT_TRUE(PixelsFilter::HashConstant(duckdb::Value::DECIMAL((int32_t) 123456789, 9, 2), decimalType, hash));
+    EXPECT_EQ(BloomFilter::hash((int64_t) 123456789), hash);
+
+    // long decimals are hashed by both words, even if the constant fits in int64
+    auto longDecimalType = TypeDescription::fromString("struct<a:decimal(30,2)>")->getChildren()[0];
+    ASSERT_TRUE(PixelsFilter::HashConstant(duckdb::Value::DECIMAL(duckdb::hugeint_t(-7), 30, 2), longDecimalType, hash));
+    EXPECT_EQ(BloomFilter::hash((int64_t) -1, (uint64_t) -7), hash);
+
+    // a constant beyond the range of the column is not hashed
+    auto longType = TypeDescription::fromString("struct<a:bigint>")->getChildren()[0];
+    duckdb::hugeint_t huge;
+    huge.upper = 1;
+    huge.lower = 0;
+    EXPECT_FALSE(PixelsFilter::HashConstant(duckdb::Value::HUGEINT(huge), longType, hash));
+}
+
+TEST(writer, hashPartitionRoundTrip) {
+    // each row group holds one partition, an equality filter on the key only reads the row groups of its partition
+    const int numPartitions = 4;
+    const int numRows = 1000;
+    auto schema = TypeDescription::fromString("struct<id:bigint,name:string>");
+    std::remove(TestFilePath.c_str());
+    std::map<int64_t, int> partitionOf;
+    {
+        auto writer = std::make_shared<PixelsWriterImpl>(schema, 10, 1 << 20, TestFilePath, 1 << 20,
+                                                         true, EncodingLevel(EncodingLevel::EL2), false, true, 65536);
+        auto unpartitioned = schema->createRowBatch(1);
+        EXPECT_THROW(writer->addRowBatch(unpartitioned), InvalidArgumentException);
+        writer->getColumnWriterOption()->setPartitionKeyColumns({0})->setNumPartitions(numPartitions);
+        Partitioner partitioner(numPartitions, 64, schema, {0});
+        auto addBatches = [&](const std::vector<std::pair<int, std::shared_ptr<VectorizedRowBatch>>> &batches) {
+            for(const auto &batch: batches) {
+                auto ids = std::static_pointer_cast<LongColumnVector>(batch.second->cols[0]);
+                for(int i = 0; i < batch.second->count(); i++) {
+                    partitionOf[ids->longVector[i]] = batch.first;
+                }
+                writer->addRowBatch(batch.second, batch.first);
+            }
+        };
+        EXPECT_THROW(writer->addRowBatch(schema->createRowBatch(1), numPartitions), InvalidArgumentException);
+        for(int start = 0; start < numRows; start += 100) {
+            auto rowBatch = schema->createRowBatch(100);
+            for(int64_t id = start; id < start + 100; id++) {
+                rowBatch->cols[0]->add(id);
+                std::string name = "name-" + std::to_string(id);
+                rowBatch->cols[1]->add(name);
+                rowBatch->rowCount++;
+            }
+            addBatches(partitioner.partition(rowBatch));
+        }
+        addBatches(partitioner.getRowBatches());
+        writer->close();
+    }
+    ASSERT_EQ(numRows, (int) partitionOf.size());
+
+    auto reader = openTestFile();
+    EXPECT_TRUE(reader->isPartitioned());
+    EXPECT_EQ(std::vector<int>{0}, reader->getPartitionKeyColumns());
+    EXPECT_EQ(numPartitions, reader->getNumPartitions());
+
+    // id in (17, 400): the rows of the partitions of the two ids are read
+    duckdb::TableFilterSet filters;
+    auto inList = std::make_unique<duckdb::ConjunctionOrFilter>();
+    for(int64_t id: {17, 400}) {
+        inList->child_filters.emplace_back(std::make_unique<duckdb::ConstantFilter>(
+                duckdb::ExpressionType::COMPARE_EQUAL, duckdb::Value::BIGINT(id)));
+    }
+    filters.filters[0] = std::move(inList);
+    std::set<int> targetPartitions = {partitionOf[17], partitionOf[400]};
+    int expectedRows = 0;
+    for(const auto &entry: partitionOf) {
+        expectedRows += targetPartitions.count(entry.second);
+    }
+    auto option = testReaderOption(reader, 128);
+    option.setEnabledFilterPushDown(true);
+    option.setFilter(&filters);
+    auto recordReader = std::static_pointer_cast<PixelsRecordReaderImpl>(reader->read(option));
+    int rows = 0;
+    int matches = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        if(result->rowCount == 0) {
+            continue;
+        }
+        auto ids = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        auto names = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+        for(int i = 0; i < result->rowCount; i++, rows++) {
+            int64_t id = ids->longVector[i];
+            ASSERT_EQ(1, targetPartitions.count(partitionOf[id])) << "id " << id;
+            // the other columns are only read for the rows passing the filter
+            ASSERT_EQ(id == 17 || id == 400, recordReader->getFilterMask()->get(i)) << "id " << id;
+            if(id == 17 || id == 400) {
+                ASSERT_EQ("name-" + std::to_string(id), names->vector[i].GetString());
+                matches++;
+            }
+        }
+    }
+    EXPECT_EQ(expectedRows, rows);
+    EXPECT_EQ(2, matches);
+}
+
+TEST(writer, statsRecorderTest) {
+    // the batch update skips the nulls, the sum is dropped once it overflows
+    IntegerStatsRecorder integers;
+    const long values[] = {5, -3, 100, 7, -50};
+    const uint8_t nulls[] = {0, 0, 1, 0, 1};
+    integers.updateInteger(values, nulls, 5);
+    EXPECT_EQ(3, integers.getNumberOfValues());
+    EXPECT_EQ(-3, integers.getMinimum());
+    EXPECT_EQ(7, integers.getMaximum());
+    EXPECT_EQ(9, integers.getSum());
+    integers.updateInteger(std::numeric_limits<long>::max(), 1);
+    EXPECT_FALSE(integers.isSumDefined());
+    EXPECT_FALSE(integers.serialize().intstatistics().has_sum());
+    EXPECT_EQ(std::numeric_limits<long>::max(), integers.serialize().intstatistics().maximum());
+
+    // long strings are truncated to bounds of MAX_LENGTH bytes
+    StringStatsRecorder strings;
+    std::string low(100, 'a');
+    std::string high(100, 'x');
+    strings.updateString(low, 1);
+    strings.updateString(high, 2);
+    strings.updateString("m", 1);
+    EXPECT_EQ(4, strings.getNumberOfValues());
+    EXPECT_EQ(std::string(StringStatsRecorder::MAX_LENGTH, 'a'), strings.getMinimum());
+    EXPECT_EQ(std::string(StringStatsRecorder::MAX_LENGTH - 1, 'x') + 'y', strings.getMaximum());
+    EXPECT_EQ(301, strings.getSum());
+    std::string allHigh(100, '\xff');
+    EXPECT_EQ(allHigh, StringStatsRecorder::truncateMaximum(allHigh.data(), allHigh.size()));
+
+    // merged statistics keep the bounds of both
+    IntegerStatsRecorder other;
+    other.updateInteger(-1000, 2);
+    other.merge(integers);
+    EXPECT_EQ(-1000, other.getMinimum());
+    EXPECT_EQ(std::numeric_limits<long>::max(), other.getMaximum());
+    EXPECT_EQ(6, other.getNumberOfValues());
+}
+
+TEST(writer, columnStatisticsRoundTrip) {
+    // the statistics of each row group and of the file are written in the footer
+    auto schema = TypeDescription::fromString("struct<id:bigint,score:int,name:string>");
+    std::remove(TestFilePath.c_str());
+    {
+        // the row group size of one byte closes a row group for each row batch
+        auto writer = std::make_shared<PixelsWriterImpl>(schema, 10, 1, TestFilePath, 1 << 20,
+                                                         true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+        for(int rowGroup = 0; rowGroup < 2; rowGroup++) {
+            auto rowBatch = schema->createRowBatch(50);
+            for(int i = 0; i < 50; i++) {
+                int64_t id = rowGroup * 50 + i;
+                rowBatch->cols[0]->add(id);
+                if(i % 7 == 3) {
+                    rowBatch->cols[1]->addNull();
+                } else {
+                    rowBatch->cols[1]->add((int) (id % 13) - 6);
+                }
+                std::string name = "n" + std::to_string(id);
+                rowBatch->cols[2]->add(name);
+                rowBatch->rowCount++;
+            }
+            writer->addRowBatch(rowBatch);
+        }
+        writer->close();
+    }
+
+    auto reader = openTestFile();
+    ASSERT_EQ(2, reader->getRowGroupNum());
+    auto id = reader->getColumnStat("id");
+    EXPECT_EQ(100, id.numberofvalues());
+    EXPECT_FALSE(id.hasnull());
+    EXPECT_EQ(0, id.intstatistics().minimum());
+    EXPECT_EQ(99, id.intstatistics().maximum());
+    EXPECT_EQ(4950, id.intstatistics().sum());
+    auto score = reader->getColumnStat("score");
+    EXPECT_TRUE(score.hasnull());
+    EXPECT_EQ(100 - 2 * 7, score.numberofvalues());
+    EXPECT_EQ(-6, score.intstatistics().minimum());
+    EXPECT_EQ(6, score.intstatistics().maximum());
+    auto name = reader->getColumnStat("name");
+    EXPECT_EQ(100, name.numberofvalues());
+    EXPECT_EQ("n0", name.stringstatistics().minimum());
+    EXPECT_EQ("n99", name.stringstatistics().maximum());
+
+    for(int rowGroup = 0; rowGroup < 2; rowGroup++) {
+        auto stat = reader->getRowGroupStat(rowGroup);
+        ASSERT_EQ(3, stat.columnchunkstats_size());
+        EXPECT_EQ(rowGroup * 50, stat.columnchunkstats(0).intstatistics().minimum());
+        EXPECT_EQ(rowGroup * 50 + 49, stat.columnchunkstats(0).intstatistics().maximum());
+        EXPECT_EQ(50, stat.columnchunkstats(2).numberofvalues());
+    }
+}
+
+TEST(writer, reusedColumnWritersRoundTrip) {
+    // the column writers are reused every other row group, the encodings are chosen again for each one
+    const int numRowGroups = 6;
+    const int rowGroupRows = 120;
+    auto schema = TypeDescription::fromString("struct<v:bigint,name:string,s:struct<x:int,y:string>>");
+    std::default_random_engine e(49);
+    std::uniform_int_distribution<int64_t> dist;
+    std::vector<int64_t> vs;
+    std::vector<std::string> names;
+    std::int64_t bytesBefore = WriterMemoryManager::Instance().getTotalBytes();
+    std::remove(TestFilePath.c_str());
+    {
+        // the row group size of one byte closes a row group for each row batch
+        auto writer = std::make_shared<PixelsWriterImpl>(schema, 16, 1, TestFilePath, 1 << 20,
+                                                         true, EncodingLevel(EncodingLevel::EL2), false, false, 65536);
+        for(int rowGroup = 0; rowGroup < numRowGroups; rowGroup++) {
+            bool runs = rowGroup % 2 == 0;
+            auto rowBatch = schema->createRowBatch(rowGroupRows);
+            auto structs = std::static_pointer_cast<StructColumnVector>(rowBatch->cols[2]);
+            for(int i = 0; i < rowGroupRows; i++) {
+                int row = (int) vs.size();
+                // runs and a few distinct strings, or random values and unique strings
+                vs.push_back(runs ? i / 30 : dist(e));
+                names.push_back(runs ? "name-" + std::to_string(i % 3) : "unique-" + std::to_string(row));
+                rowBatch->cols[0]->add(vs.back());
+                rowBatch->cols[1]->add(names.back());
+                if(i % (runs ? 7 : 5) == 2) {
+                    structs->addNull();
+                } else {
+                    structs->addRow();
+                    structs->fields[0]->add(row);
+                    std::string y = "y" + std::to_string(row);
+                    structs->fields[1]->add(y);
+                }
+                rowBatch->rowCount++;
+            }
+            EXPECT_FALSE(writer->addRowBatch(rowBatch)) << "row group " << rowGroup;
+        }
+        writer->close();
+        EXPECT_EQ(bytesBefore, WriterMemoryManager::Instance().getTotalBytes());
+    }
+
+    auto reader = openTestFile();
+    EXPECT_EQ(numRowGroups, reader->getRowGroupNum());
+    auto recordReader = reader->read(testReaderOption(reader, 100));
+    int row = 0;
+    while(!recordReader->isEndOfFile()) {
+        auto result = recordReader->readBatch(false);
+        auto longs = std::static_pointer_cast<LongColumnVector>(result->cols[0]);
+        auto strings = std::static_pointer_cast<BinaryColumnVector>(result->cols[1]);
+        auto structResult = std::static_pointer_cast<StructColumnVector>(result->cols[2]);
+        auto xs = std::static_pointer_cast<LongColumnVector>(structResult->fields[0]);
+        auto ys = std::static_pointer_cast<BinaryColumnVector>(structResult->fields[1]);
+        for(int i = 0; i < result->rowCount; i++, row++) {
+            bool runs = (row / rowGroupRows) % 2 == 0;
+            ASSERT_EQ(vs[row], longs->longVector[i]) << "row " << row;
+            ASSERT_EQ(names[row], strings->vector[i].GetString()) << "row " << row;
+            bool isNull = (row % rowGroupRows) % (runs ? 7 : 5) == 2;
+            ASSERT_EQ(!isNull, structResult->checkValid(i)) << "row " << row;
+            if(!isNull) {
+                ASSERT_EQ(row, xs->intVector[i]) << "row " << row;
+                ASSERT_EQ("y" + std::to_string(row), ys->vector[i].GetString()) << "row " << row;
+            }
+        }
+    }
+    EXPECT_EQ(numRowGroups * rowGroupRows, row);
+}